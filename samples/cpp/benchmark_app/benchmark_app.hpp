@@ -252,6 +252,16 @@ static const char load_config_message[] =
     "                                               }\n"
     "                                       }";
 
+// @brief message for co-location mode
+static const char colocate_message[] =
+    "Optional. Path to JSON file describing a set of models to be run concurrently on one OpenVINO Runtime "
+    "instance. Per-model throughput, latency percentiles and CPU utilization are reported. "
+    "-m, -d, -hint, -nireq and other model-specific options are ignored in this mode, -t sets the duration.\n"
+    "                              Example: {\"models\": [{\"path\": \"a.xml\", \"device\": \"CPU\", "
+    "\"nireq\": 2, \"rate\": 100, \"properties\": {\"NUM_STREAMS\": \"2\"}}, {\"path\": \"b.onnx\"}]}\n"
+    "                              \"rate\" is a target number of requests per second, 0 or missing means "
+    "running as fast as possible.";
+
 /// @brief Define flag for showing help message <br>
 DEFINE_bool(h, false, help_message);
 
@@ -382,6 +392,9 @@ DEFINE_string(load_config, "", load_config_message);
 /// @brief Define flag for dumping configuration file <br>
 DEFINE_string(dump_config, "", dump_config_message);
 
+/// @brief Define flag for co-location benchmark config file <br>
+DEFINE_string(colocate, "", colocate_message);
+
 /**
  * @brief This function show a help message
  */
@@ -441,4 +454,7 @@ static void show_usage() {
     std::cout << "    -exec_graph_path        " << exec_graph_path_message << std::endl;
     std::cout << "    -dump_config            " << dump_config_message << std::endl;
     std::cout << "    -load_config            " << load_config_message << std::endl;
+    std::cout << std::endl;
+    std::cout << "Co-location options:" << std::endl;
+    std::cout << "    -colocate  <path>       " << colocate_message << std::endl;
 }
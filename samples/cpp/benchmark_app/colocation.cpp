@@ -0,0 +1,288 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#ifdef _WIN32
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <windows.h>
+#else
+#    include <sys/resource.h>
+#endif
+
+// clang-format off
+#include "samples/common.hpp"
+#include "samples/latency_metrics.hpp"
+#include "samples/slog.hpp"
+
+#include "colocation.hpp"
+#include "infer_request_wrap.hpp"
+#include "inputs_filling.hpp"
+#include "utils.hpp"
+// clang-format on
+
+namespace benchmark_app {
+namespace {
+
+struct CpuTimes {
+    double user_seconds = 0.0;
+    double system_seconds = 0.0;
+};
+
+CpuTimes get_process_cpu_times() {
+    CpuTimes times;
+#ifdef _WIN32
+    FILETIME creation_time, exit_time, kernel_time, user_time;
+    if (GetProcessTimes(GetCurrentProcess(), &creation_time, &exit_time, &kernel_time, &user_time)) {
+        auto to_seconds = [](const FILETIME& ft) {
+            ULARGE_INTEGER value;
+            value.LowPart = ft.dwLowDateTime;
+            value.HighPart = ft.dwHighDateTime;
+            // FILETIME is measured in 100-nanosecond intervals
+            return static_cast<double>(value.QuadPart) * 1e-7;
+        };
+        times.user_seconds = to_seconds(user_time);
+        times.system_seconds = to_seconds(kernel_time);
+    }
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+        times.user_seconds = usage.ru_utime.tv_sec + usage.ru_utime.tv_usec * 1e-6;
+        times.system_seconds = usage.ru_stime.tv_sec + usage.ru_stime.tv_usec * 1e-6;
+    }
+#endif
+    return times;
+}
+
+/// @brief Runtime state of a single co-located model
+struct ColocatedModel {
+    ColocatedModelConfig config;
+    ov::CompiledModel compiled_model;
+    std::unique_ptr<InferRequestsQueue> queue;
+    size_t iterations = 0;
+    /// @brief Number of paced requests not submitted because all infer requests were busy at their issue time
+    size_t queueing_misses = 0;
+    double busy_time_ms = 0.0;
+};
+
+void fill_random_inputs(ColocatedModel& model) {
+    for (const auto& input : model.compiled_model.inputs()) {
+        if (input.get_partial_shape().is_dynamic()) {
+            throw std::logic_error("Model " + model.config.path +
+                                   " has dynamic input shapes which are not supported in co-location mode. "
+                                   "Please reshape the model to static shapes.");
+        }
+        InputInfo info;
+        info.type = input.get_element_type();
+        info.partialShape = input.get_partial_shape();
+        info.dataShape = input.get_shape();
+        const auto name = input.get_any_name();
+        for (auto& request : model.queue->requests) {
+            request->set_tensor(name, get_random_tensor({name, info}));
+        }
+    }
+}
+
+void run_model(ColocatedModel& model, const Time::time_point& start_time, const Time::time_point& end_time) {
+    const bool paced = model.config.rate > 0.0;
+    const auto period = paced ? std::chrono::duration_cast<Time::duration>(
+                                    std::chrono::duration<double>(1.0 / model.config.rate))
+                              : Time::duration::zero();
+    auto next_issue_time = start_time;
+    while (Time::now() < end_time) {
+        if (!paced) {
+            // Closed loop: the next request is submitted as soon as any previous one completes
+            model.queue->get_idle_request()->start_async();
+            model.iterations++;
+            continue;
+        }
+        // Open loop: requests are issued on the schedule regardless of the completion time of previous ones.
+        // A request which would have to wait for an idle infer request is counted as a queueing miss
+        // instead of delaying the schedule.
+        if (next_issue_time >= end_time)
+            break;
+        std::this_thread::sleep_until(next_issue_time);
+        next_issue_time += period;
+        auto request = model.queue->try_get_idle_request();
+        if (!request) {
+            model.queueing_misses++;
+            continue;
+        }
+        request->start_async();
+        model.iterations++;
+    }
+    model.queue->wait_all();
+}
+
+}  // namespace
+
+std::vector<ColocatedModelConfig> load_colocation_config(const std::string& filename) {
+    std::ifstream ifs(filename);
+    if (!ifs.is_open()) {
+        throw std::runtime_error("Can't load co-location config file \"" + filename + "\".");
+    }
+
+    nlohmann::json json_config;
+    try {
+        ifs >> json_config;
+    } catch (const std::exception& e) {
+        throw std::runtime_error("Can't parse co-location config file \"" + filename + "\".\n" + e.what());
+    }
+
+    if (!json_config.contains("models") || !json_config.at("models").is_array() || json_config.at("models").empty()) {
+        throw std::runtime_error("Co-location config file \"" + filename +
+                                 "\" must contain non-empty \"models\" array.");
+    }
+
+    std::vector<ColocatedModelConfig> models;
+    for (const auto& item : json_config.at("models")) {
+        ColocatedModelConfig model;
+        if (!item.contains("path")) {
+            throw std::runtime_error("Each model in co-location config must have \"path\" field.");
+        }
+        model.path = item.at("path").get<std::string>();
+        if (item.contains("device"))
+            model.device = item.at("device").get<std::string>();
+        if (item.contains("nireq"))
+            model.nireq = item.at("nireq").get<size_t>();
+        if (item.contains("rate"))
+            model.rate = item.at("rate").get<double>();
+        if (item.contains("properties")) {
+            const auto& properties = item.at("properties");
+            for (auto option = properties.cbegin(), end = properties.cend(); option != end; ++option) {
+                model.properties[option.key()] =
+                    option.value().is_string() ? option.value().get<std::string>() : option.value().dump();
+            }
+        }
+        models.push_back(std::move(model));
+    }
+    return models;
+}
+
+void run_colocation_benchmark(ov::Core& core,
+                              const std::vector<ColocatedModelConfig>& configs,
+                              uint64_t duration_seconds,
+                              size_t latency_percentile) {
+    std::vector<ColocatedModel> models(configs.size());
+    for (size_t i = 0; i < configs.size(); ++i) {
+        auto& model = models[i];
+        model.config = configs[i];
+
+        auto start_time = Time::now();
+        model.compiled_model = core.compile_model(model.config.path, model.config.device, model.config.properties);
+        slog::info << "Compile model " << model.config.path << " took "
+                   << double_to_string(get_duration_ms_till_now(start_time)) << " ms" << slog::endl;
+
+        size_t nireq = model.config.nireq;
+        if (nireq == 0) {
+            nireq = model.compiled_model.get_property(ov::optimal_number_of_infer_requests);
+        }
+        model.queue.reset(new InferRequestsQueue(model.compiled_model, nireq, 1, false));
+        fill_random_inputs(model);
+
+        slog::info << "Model " << model.config.path << ": device " << model.config.device << ", " << nireq
+                   << " infer requests, "
+                   << (model.config.rate > 0.0 ? double_to_string(model.config.rate) + " requests/s"
+                                               : std::string("closed loop"))
+                   << slog::endl;
+    }
+
+    // Warm up every model once, so the first inference is not accounted in the results
+    for (auto& model : models) {
+        model.queue->get_idle_request()->infer();
+        model.queue->reset_times();
+    }
+
+    slog::info << "Start co-located inference of " << models.size() << " models for " << duration_seconds
+               << " seconds" << slog::endl;
+
+    const auto cpu_times_start = get_process_cpu_times();
+    auto start_time = Time::now();
+    const auto end_time = start_time + std::chrono::seconds(duration_seconds);
+
+    std::vector<std::thread> drivers;
+    std::vector<std::exception_ptr> errors(models.size());
+    for (size_t i = 0; i < models.size(); ++i) {
+        drivers.emplace_back([&, i] {
+            try {
+                run_model(models[i], start_time, end_time);
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        });
+    }
+    for (auto& driver : drivers) {
+        driver.join();
+    }
+    const double wall_time_ms = get_duration_ms_till_now(start_time);
+    const auto cpu_times_end = get_process_cpu_times();
+
+    for (const auto& error : errors) {
+        if (error)
+            std::rethrow_exception(error);
+    }
+
+    double total_busy_time_ms = 0.0;
+    for (auto& model : models) {
+        const auto latencies = model.queue->get_latencies();
+        for (const auto latency : latencies)
+            model.busy_time_ms += latency;
+        total_busy_time_ms += model.busy_time_ms;
+    }
+
+    for (auto& model : models) {
+        const auto latencies = model.queue->get_latencies();
+        slog::info << "Model: " << model.config.path << " (" << model.config.device << ")" << slog::endl;
+        slog::info << "   Count:            " << model.iterations << " iterations" << slog::endl;
+        if (model.config.rate > 0.0) {
+            const size_t scheduled = model.iterations + model.queueing_misses;
+            slog::info << "   Queueing misses:  " << model.queueing_misses << " of " << scheduled
+                       << " scheduled requests ("
+                       << double_to_string(scheduled ? 100.0 * model.queueing_misses / scheduled : 0.0) << " %)"
+                       << slog::endl;
+        }
+        if (latencies.empty()) {
+            slog::warn << "   No inference requests were completed" << slog::endl;
+            continue;
+        }
+        const double duration_ms = model.queue->get_duration_in_milliseconds();
+        slog::info << "   Throughput:       " << double_to_string(1000.0 * latencies.size() / duration_ms) << " FPS"
+                   << slog::endl;
+        LatencyMetrics(latencies, "", latency_percentile).write_to_slog();
+        for (size_t percentile : {90, 99}) {
+            if (percentile == latency_percentile)
+                continue;
+            slog::info << "   " << percentile << " percentile:     "
+                       << double_to_string(LatencyMetrics(latencies, "", percentile).median_or_percentile) << " ms"
+                       << slog::endl;
+        }
+        if (total_busy_time_ms > 0.0) {
+            slog::info << "   Share of in-flight time: "
+                       << double_to_string(100.0 * model.busy_time_ms / total_busy_time_ms) << " %" << slog::endl;
+        }
+    }
+
+    const double wall_time_seconds = wall_time_ms / 1000.0;
+    const double cores = std::max(1u, std::thread::hardware_concurrency());
+    const double user_seconds = cpu_times_end.user_seconds - cpu_times_start.user_seconds;
+    const double system_seconds = cpu_times_end.system_seconds - cpu_times_start.system_seconds;
+    slog::info << "Duration:            " << double_to_string(wall_time_ms) << " ms" << slog::endl;
+    slog::info << "CPU utilization (" << static_cast<size_t>(cores) << " logical cores):" << slog::endl;
+    slog::info << "   User:             " << double_to_string(100.0 * user_seconds / (wall_time_seconds * cores))
+               << " %" << slog::endl;
+    slog::info << "   System:           " << double_to_string(100.0 * system_seconds / (wall_time_seconds * cores))
+               << " %" << slog::endl;
+}
+
+}  // namespace benchmark_app
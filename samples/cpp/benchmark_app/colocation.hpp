@@ -0,0 +1,46 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <openvino/openvino.hpp>
+#include <string>
+#include <vector>
+
+namespace benchmark_app {
+
+/// @brief Description of a single model participating in the co-location benchmark
+struct ColocatedModelConfig {
+    std::string path;
+    std::string device = "CPU";
+    /// @brief Number of infer requests; 0 means ov::optimal_number_of_infer_requests
+    size_t nireq = 0;
+    /// @brief Target request rate (requests per second) of the open loop; 0 means closed loop (as fast as possible).
+    /// Requests issued while all infer requests are busy are not submitted and reported as queueing misses.
+    double rate = 0.0;
+    ov::AnyMap properties;
+};
+
+/**
+ * @brief Parses co-location JSON config of the following format:
+ *   {
+ *       "models": [
+ *           {"path": "a.xml", "device": "CPU", "nireq": 2, "rate": 100, "properties": {"NUM_STREAMS": "2"}},
+ *           {"path": "b.onnx", "properties": {"INFERENCE_NUM_THREADS": "4"}}
+ *       ]
+ *   }
+ */
+std::vector<ColocatedModelConfig> load_colocation_config(const std::string& filename);
+
+/**
+ * @brief Loads all models to the single ov::Core, runs them concurrently for the given time and
+ * reports per-model throughput, latency percentiles and process CPU utilization
+ */
+void run_colocation_benchmark(ov::Core& core,
+                              const std::vector<ColocatedModelConfig>& models,
+                              uint64_t duration_seconds,
+                              size_t latency_percentile);
+
+}  // namespace benchmark_app
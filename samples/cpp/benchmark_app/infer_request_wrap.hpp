@@ -178,6 +178,21 @@ public:
         return request;
     }
 
+    /// @brief Returns an idle request without waiting for one, nullptr if all requests are busy
+    InferReqWrap::Ptr try_get_idle_request() {
+        std::unique_lock<std::mutex> lock(_mutex);
+        if (inferenceException) {
+            std::rethrow_exception(inferenceException);
+        }
+        if (_idleIds.empty()) {
+            return nullptr;
+        }
+        auto request = requests.at(_idleIds.front());
+        _idleIds.pop();
+        _startTime = std::min(Time::now(), _startTime);
+        return request;
+    }
+
     void wait_all() {
         std::unique_lock<std::mutex> lock(_mutex);
         _cv.wait(lock, [this] {
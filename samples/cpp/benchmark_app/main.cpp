@@ -32,6 +32,7 @@
 #include "samples/slog.hpp"
 
 #include "benchmark_app.hpp"
+#include "colocation.hpp"
 #include "infer_request_wrap.hpp"
 #include "inputs_filling.hpp"
 #include "remote_tensors_filling.hpp"
@@ -51,7 +52,7 @@ bool parse_and_check_command_line(int argc, char* argv[]) {
         return false;
     }
 
-    if (FLAGS_m.empty()) {
+    if (FLAGS_m.empty() && FLAGS_colocate.empty()) {
         show_usage();
         throw std::logic_error("Model is required but not set. Please set -m option.");
     }
@@ -248,6 +249,25 @@ int main(int argc, char* argv[]) {
             return 0;
         }
 
+        if (!FLAGS_colocate.empty()) {
+            auto colocated_models = benchmark_app::load_colocation_config(FLAGS_colocate);
+            ov::Core core;
+            if (!FLAGS_extensions.empty()) {
+                core.add_extension(FLAGS_extensions);
+                slog::info << "Extensions are loaded: " << FLAGS_extensions << slog::endl;
+            }
+            if (!FLAGS_cache_dir.empty()) {
+                core.set_property(ov::cache_dir(FLAGS_cache_dir));
+            }
+            slog::info << "OpenVINO:" << slog::endl;
+            slog::info << ov::get_openvino_version() << slog::endl;
+            benchmark_app::run_colocation_benchmark(core,
+                                                    colocated_models,
+                                                    FLAGS_t != 0 ? FLAGS_t : 60,
+                                                    FLAGS_latency_percentile);
+            return 0;
+        }
+
         bool isNetworkCompiled = fileExt(FLAGS_m) == "blob";
         if (isNetworkCompiled) {
             slog::info << "Model is compiled" << slog::endl;
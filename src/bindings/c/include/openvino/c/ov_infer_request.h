@@ -13,6 +13,7 @@
 #include "openvino/c/ov_common.h"
 #include "openvino/c/ov_node.h"
 #include "openvino/c/ov_tensor.h"
+#include "openvino/c/ov_tensor_pool.h"
 
 /**
  * @struct ov_infer_request_t
@@ -70,6 +71,53 @@ typedef struct {
 OPENVINO_C_API(ov_status_e)
 ov_infer_request_set_tensor(ov_infer_request_t* infer_request, const char* tensor_name, const ov_tensor_t* tensor);
 
+/**
+ * @brief Set an input/output tensor to infer on by the name of tensor from a buffer of the tensor pool.
+ * The tensor of the pool is reused, no wrapper or tensor is allocated. When the next inference of the request
+ * is done, the callback of the pool is called with the index of the buffer.
+ * @ingroup ov_infer_request_c_api
+ * @param infer_request A pointer to the ov_infer_request_t.
+ * @param tensor_name  Name of the input or output tensor.
+ * @param pool A pointer to the ov_tensor_pool_t.
+ * @param index Index of the buffer acquired from the pool.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_infer_request_set_tensor_from_pool(ov_infer_request_t* infer_request,
+                                      const char* tensor_name,
+                                      ov_tensor_pool_t* pool,
+                                      const size_t index);
+
+/**
+ * @brief Set an input tensor to infer on by the index of tensor from a buffer of the tensor pool.
+ * @ingroup ov_infer_request_c_api
+ * @param infer_request A pointer to the ov_infer_request_t.
+ * @param idx Index of the input port.
+ * @param pool A pointer to the ov_tensor_pool_t.
+ * @param index Index of the buffer acquired from the pool.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_infer_request_set_input_tensor_from_pool(ov_infer_request_t* infer_request,
+                                            const size_t idx,
+                                            ov_tensor_pool_t* pool,
+                                            const size_t index);
+
+/**
+ * @brief Set an output tensor to infer on by the index of tensor from a buffer of the tensor pool.
+ * @ingroup ov_infer_request_c_api
+ * @param infer_request A pointer to the ov_infer_request_t.
+ * @param idx Index of the output port.
+ * @param pool A pointer to the ov_tensor_pool_t.
+ * @param index Index of the buffer acquired from the pool.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_infer_request_set_output_tensor_from_pool(ov_infer_request_t* infer_request,
+                                             const size_t idx,
+                                             ov_tensor_pool_t* pool,
+                                             const size_t index);
+
 /**
  * @brief Set an input/output tensor to infer request for the port.
  * @ingroup ov_infer_request_c_api
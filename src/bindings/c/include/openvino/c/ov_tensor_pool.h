@@ -0,0 +1,102 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief This is a header file for ov_tensor_pool C API, which binds a ring of user-managed host buffers
+ * to infer requests without per-inference allocations
+ * @file ov_tensor_pool.h
+ */
+
+#pragma once
+
+#include "openvino/c/ov_common.h"
+#include "openvino/c/ov_shape.h"
+
+/**
+ * @struct ov_tensor_pool_t
+ * @ingroup ov_tensor_c_api
+ * @brief type define ov_tensor_pool_t from ov_tensor_pool
+ */
+typedef struct ov_tensor_pool ov_tensor_pool_t;
+
+/**
+ * @struct ov_tensor_pool_callback_t
+ * @ingroup ov_tensor_c_api
+ * @brief Callback called when an infer request using a buffer of the pool is done with it.
+ * The buffer is owned by the user again: it may be read, refilled and bound again or
+ * returned to the pool with ov_tensor_pool_release.
+ */
+typedef struct {
+    void(OPENVINO_C_API_CALLBACK* callback_func)(void* args, size_t index);  //!< The callback func
+    void* args;                                                              //!< The args of callback func
+} ov_tensor_pool_callback_t;
+
+/**
+ * @brief Constructs a pool of tensors on top of pre-allocated host buffers.
+ * Tensors are created once, the buffers stay owned by the user and must outlive the pool.
+ * The pool may be shared by several infer requests of a compiled model.
+ * @ingroup ov_tensor_c_api
+ * @param type Element type of the tensors
+ * @param shape Shape of the tensors
+ * @param host_ptrs Array of pointers to pre-allocated host memory, each big enough to hold a tensor
+ * @param count Number of buffers in the array
+ * @param pool A pointer to the newly created ov_tensor_pool_t
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_tensor_pool_create(const ov_element_type_e type,
+                      const ov_shape_t shape,
+                      void** host_ptrs,
+                      const size_t count,
+                      ov_tensor_pool_t** pool);
+
+/**
+ * @brief Set callback function, which will be called when an infer request is done with a buffer of the pool.
+ * The callback is called from the thread completing the inference.
+ * @ingroup ov_tensor_c_api
+ * @param pool A pointer to the ov_tensor_pool_t.
+ * @param callback A function to be called, the structure is copied.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_tensor_pool_set_callback(ov_tensor_pool_t* pool, const ov_tensor_pool_callback_t* callback);
+
+/**
+ * @brief Take the next free buffer from the pool. Buffers are handed out in the order they were released.
+ * @ingroup ov_tensor_c_api
+ * @param pool A pointer to the ov_tensor_pool_t.
+ * @param index Index of the buffer in the array passed to ov_tensor_pool_create.
+ * @return Status code of the operation: OK(0) for success, NOT_ALLOCATED if all buffers are in use.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_tensor_pool_acquire(ov_tensor_pool_t* pool, size_t* index);
+
+/**
+ * @brief Return a buffer taken with ov_tensor_pool_acquire to the pool.
+ * @ingroup ov_tensor_c_api
+ * @param pool A pointer to the ov_tensor_pool_t.
+ * @param index Index of the buffer.
+ * @return Status code of the operation: OK(0) for success, OUT_OF_BOUNDS if the buffer is not acquired.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_tensor_pool_release(ov_tensor_pool_t* pool, const size_t index);
+
+/**
+ * @brief Get the number of free buffers in the pool.
+ * @ingroup ov_tensor_c_api
+ * @param pool A pointer to the ov_tensor_pool_t.
+ * @param count Number of free buffers.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_tensor_pool_get_free_count(const ov_tensor_pool_t* pool, size_t* count);
+
+/**
+ * @brief Free ov_tensor_pool_t. Buffers still bound to infer requests stay valid until the requests
+ * are done with them, the callback of the pool is not called anymore.
+ * @ingroup ov_tensor_c_api
+ * @param pool A pointer to the ov_tensor_pool_t to free memory.
+ */
+OPENVINO_C_API(void)
+ov_tensor_pool_free(ov_tensor_pool_t* pool);
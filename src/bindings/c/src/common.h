@@ -6,9 +6,13 @@
 #include <cassert>
 #include <fstream>
 #include <iterator>
+#include <functional>
 #include <map>
+#include <mutex>
 #include <streambuf>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "details/ie_exception.hpp"
 #include "openvino/core/except.hpp"
@@ -90,12 +94,67 @@ struct ov_compiled_model {
     std::shared_ptr<ov::CompiledModel> object;
 };
 
+/**
+ * @struct tensor_pool
+ * @brief Ring of tensors created on top of user-managed host buffers
+ */
+struct tensor_pool {
+    explicit tensor_pool(std::vector<ov::Tensor> pool_tensors);
+
+    bool acquire(size_t& index);
+    bool release(size_t index);
+    bool is_acquired(size_t index);
+    size_t get_free_count();
+    void set_callback(std::function<void(size_t)> callback);
+    // Called when an infer request is done with the buffer
+    void notify_done(size_t index);
+
+    const std::vector<ov::Tensor> tensors;
+
+private:
+    std::mutex mutex;
+    // free buffers in the release order, the capacity is the number of buffers so nothing is allocated later
+    std::vector<size_t> free_ring;
+    size_t free_begin = 0;
+    size_t free_size = 0;
+    std::vector<bool> acquired;
+    std::function<void(size_t)> on_done;
+};
+
+/**
+ * @struct ov_tensor_pool
+ * @brief This is an interface of tensor_pool
+ */
+struct ov_tensor_pool {
+    std::shared_ptr<tensor_pool> object;
+};
+
+/**
+ * @struct pooled_tensors
+ * @brief Buffers of tensor pools bound to an infer request until its inference is done
+ */
+struct pooled_tensors {
+    void bind(const std::shared_ptr<tensor_pool>& pool, size_t index);
+    void set_callback(std::function<void()> callback);
+    // Returns the bound buffers to their pools
+    void release();
+    // Completion of the asynchronous inference: releases the buffers and calls the user callback
+    void complete();
+
+private:
+    std::mutex mutex;
+    std::vector<std::pair<std::shared_ptr<tensor_pool>, size_t>> bound;
+    std::function<void()> on_complete;
+};
+
 /**
  * @struct ov_infer_request
  * @brief This is an interface of ov::InferRequest
  */
 struct ov_infer_request {
     std::shared_ptr<ov::InferRequest> object;
+    // Created on the first use of the completion callback or of a tensor pool
+    std::shared_ptr<pooled_tensors> pooled;
 };
 
 /**
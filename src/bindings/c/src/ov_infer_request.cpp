@@ -5,6 +5,86 @@
 
 #include "common.h"
 
+void pooled_tensors::bind(const std::shared_ptr<tensor_pool>& pool, size_t index) {
+    std::lock_guard<std::mutex> lock(mutex);
+    bound.emplace_back(pool, index);
+}
+
+void pooled_tensors::set_callback(std::function<void()> callback) {
+    std::lock_guard<std::mutex> lock(mutex);
+    on_complete = std::move(callback);
+}
+
+void pooled_tensors::release() {
+    std::vector<std::pair<std::shared_ptr<tensor_pool>, size_t>> done;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        done.swap(bound);
+    }
+    for (const auto& buffer : done) {
+        buffer.first->notify_done(buffer.second);
+    }
+    done.clear();
+    // give the storage back, so binding the buffers for the next inference doesn't allocate
+    std::lock_guard<std::mutex> lock(mutex);
+    if (bound.empty()) {
+        bound.swap(done);
+    }
+}
+
+void pooled_tensors::complete() {
+    release();
+    std::function<void()> callback;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        callback = on_complete;
+    }
+    if (callback) {
+        callback();
+    }
+}
+
+namespace {
+
+pooled_tensors& get_pooled_tensors(ov_infer_request_t* infer_request) {
+    if (!infer_request->pooled) {
+        auto pooled = std::make_shared<pooled_tensors>();
+        infer_request->object->set_callback([pooled](std::exception_ptr ex) {
+            pooled->complete();
+        });
+        infer_request->pooled = std::move(pooled);
+    }
+    return *infer_request->pooled;
+}
+
+template <typename SetTensor>
+ov_status_e set_tensor_from_pool(ov_infer_request_t* infer_request,
+                                 ov_tensor_pool_t* pool,
+                                 const size_t index,
+                                 SetTensor&& set_tensor) {
+    if (!pool->object->is_acquired(index)) {
+        return ov_status_e::OUT_OF_BOUNDS;
+    }
+    try {
+        set_tensor(pool->object->tensors[index]);
+        get_pooled_tensors(infer_request).bind(pool->object, index);
+    }
+    CATCH_OV_EXCEPTIONS
+
+    return ov_status_e::OK;
+}
+
+ov_status_e infer(ov::InferRequest& request) {
+    try {
+        request.infer();
+    }
+    CATCH_OV_EXCEPTIONS
+
+    return ov_status_e::OK;
+}
+
+}  // namespace
+
 void ov_infer_request_free(ov_infer_request_t* infer_request) {
     if (infer_request)
         delete infer_request;
@@ -25,6 +105,45 @@ ov_status_e ov_infer_request_set_tensor(ov_infer_request_t* infer_request,
     return ov_status_e::OK;
 }
 
+ov_status_e ov_infer_request_set_tensor_from_pool(ov_infer_request_t* infer_request,
+                                                  const char* tensor_name,
+                                                  ov_tensor_pool_t* pool,
+                                                  const size_t index) {
+    if (!infer_request || !tensor_name || !pool) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+
+    return set_tensor_from_pool(infer_request, pool, index, [&](const ov::Tensor& tensor) {
+        infer_request->object->set_tensor(tensor_name, tensor);
+    });
+}
+
+ov_status_e ov_infer_request_set_input_tensor_from_pool(ov_infer_request_t* infer_request,
+                                                        const size_t idx,
+                                                        ov_tensor_pool_t* pool,
+                                                        const size_t index) {
+    if (!infer_request || !pool) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+
+    return set_tensor_from_pool(infer_request, pool, index, [&](const ov::Tensor& tensor) {
+        infer_request->object->set_input_tensor(idx, tensor);
+    });
+}
+
+ov_status_e ov_infer_request_set_output_tensor_from_pool(ov_infer_request_t* infer_request,
+                                                         const size_t idx,
+                                                         ov_tensor_pool_t* pool,
+                                                         const size_t index) {
+    if (!infer_request || !pool) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+
+    return set_tensor_from_pool(infer_request, pool, index, [&](const ov::Tensor& tensor) {
+        infer_request->object->set_output_tensor(idx, tensor);
+    });
+}
+
 ov_status_e ov_infer_request_set_tensor_by_port(ov_infer_request_t* infer_request,
                                                 const ov_output_port_t* port,
                                                 const ov_tensor_t* tensor) {
@@ -238,12 +357,14 @@ ov_status_e ov_infer_request_infer(ov_infer_request_t* infer_request) {
         return ov_status_e::INVALID_C_PARAM;
     }
 
-    try {
-        infer_request->object->infer();
+    const auto status = infer(*infer_request->object);
+    // the completion callback isn't called for the synchronous inference, so the buffers are returned here,
+    // whatever the result of the inference is
+    if (infer_request->pooled) {
+        infer_request->pooled->release();
     }
-    CATCH_OV_EXCEPTIONS
 
-    return ov_status_e::OK;
+    return status;
 }
 
 ov_status_e ov_infer_request_cancel(ov_infer_request_t* infer_request) {
@@ -304,10 +425,10 @@ ov_status_e ov_infer_request_set_callback(ov_infer_request_t* infer_request, con
     }
 
     try {
-        auto func = [callback](std::exception_ptr ex) {
+        auto func = [callback]() {
             callback->callback_func(callback->args);
         };
-        infer_request->object->set_callback(func);
+        get_pooled_tensors(infer_request).set_callback(func);
     }
     CATCH_OV_EXCEPTIONS
 
@@ -35,3 +35,4 @@ const char* ov_property_key_device_priorities = "MULTI_DEVICE_PRIORITIES";
 const char* ov_property_key_hint_execution_mode = "EXECUTION_MODE_HINT";
 const char* ov_property_key_force_tbb_terminate = "FORCE_TBB_TERMINATE";
 const char* ov_property_key_enable_mmap = "ENABLE_MMAP";
+const char* ov_property_key_enable_tensor_memory_pool = "ENABLE_TENSOR_MEMORY_POOL";
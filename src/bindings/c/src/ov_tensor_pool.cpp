@@ -0,0 +1,147 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#include "openvino/c/ov_tensor_pool.h"
+
+#include "common.h"
+
+tensor_pool::tensor_pool(std::vector<ov::Tensor> pool_tensors)
+    : tensors(std::move(pool_tensors)),
+      free_ring(tensors.size()),
+      free_size(tensors.size()),
+      acquired(tensors.size(), false) {
+    for (size_t i = 0; i < free_ring.size(); i++) {
+        free_ring[i] = i;
+    }
+}
+
+bool tensor_pool::acquire(size_t& index) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (free_size == 0) {
+        return false;
+    }
+    index = free_ring[free_begin];
+    free_begin = (free_begin + 1) % free_ring.size();
+    free_size--;
+    acquired[index] = true;
+    return true;
+}
+
+bool tensor_pool::release(size_t index) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (index >= acquired.size() || !acquired[index]) {
+        return false;
+    }
+    acquired[index] = false;
+    free_ring[(free_begin + free_size) % free_ring.size()] = index;
+    free_size++;
+    return true;
+}
+
+bool tensor_pool::is_acquired(size_t index) {
+    std::lock_guard<std::mutex> lock(mutex);
+    return index < acquired.size() && acquired[index];
+}
+
+size_t tensor_pool::get_free_count() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return free_size;
+}
+
+void tensor_pool::set_callback(std::function<void(size_t)> callback) {
+    std::lock_guard<std::mutex> lock(mutex);
+    on_done = std::move(callback);
+}
+
+void tensor_pool::notify_done(size_t index) {
+    std::function<void(size_t)> callback;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        callback = on_done;
+    }
+    // the user may acquire or release buffers from the callback, so it's called without the lock
+    if (callback) {
+        callback(index);
+    }
+}
+
+ov_status_e ov_tensor_pool_create(const ov_element_type_e type,
+                                  const ov_shape_t shape,
+                                  void** host_ptrs,
+                                  const size_t count,
+                                  ov_tensor_pool_t** pool) {
+    if (!pool || !host_ptrs || count == 0) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    for (size_t i = 0; i < count; i++) {
+        if (!host_ptrs[i]) {
+            return ov_status_e::INVALID_C_PARAM;
+        }
+    }
+    try {
+        std::unique_ptr<ov_tensor_pool_t> _pool(new ov_tensor_pool_t);
+        auto tmp_type = get_element_type(type);
+        ov::Shape tmp_shape;
+        std::copy_n(shape.dims, shape.rank, std::back_inserter(tmp_shape));
+        std::vector<ov::Tensor> tensors;
+        tensors.reserve(count);
+        for (size_t i = 0; i < count; i++) {
+            tensors.emplace_back(tmp_type, tmp_shape, host_ptrs[i]);
+        }
+        _pool->object = std::make_shared<tensor_pool>(std::move(tensors));
+        *pool = _pool.release();
+    }
+    CATCH_OV_EXCEPTIONS
+    return ov_status_e::OK;
+}
+
+ov_status_e ov_tensor_pool_set_callback(ov_tensor_pool_t* pool, const ov_tensor_pool_callback_t* callback) {
+    if (!pool || !callback || !callback->callback_func) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    try {
+        const auto func = callback->callback_func;
+        const auto args = callback->args;
+        pool->object->set_callback([func, args](size_t index) {
+            func(args, index);
+        });
+    }
+    CATCH_OV_EXCEPTIONS
+    return ov_status_e::OK;
+}
+
+ov_status_e ov_tensor_pool_acquire(ov_tensor_pool_t* pool, size_t* index) {
+    if (!pool || !index) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    if (!pool->object->acquire(*index)) {
+        return ov_status_e::NOT_ALLOCATED;
+    }
+    return ov_status_e::OK;
+}
+
+ov_status_e ov_tensor_pool_release(ov_tensor_pool_t* pool, const size_t index) {
+    if (!pool) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    if (!pool->object->release(index)) {
+        return ov_status_e::OUT_OF_BOUNDS;
+    }
+    return ov_status_e::OK;
+}
+
+ov_status_e ov_tensor_pool_get_free_count(const ov_tensor_pool_t* pool, size_t* count) {
+    if (!pool || !count) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    *count = pool->object->get_free_count();
+    return ov_status_e::OK;
+}
+
+void ov_tensor_pool_free(ov_tensor_pool_t* pool) {
+    if (pool) {
+        // infer requests may still hold the pool, they must not call back into the user code
+        pool->object->set_callback(nullptr);
+        delete pool;
+    }
+}
@@ -387,6 +387,96 @@ TEST_P(ov_infer_request_test, infer_request_set_callback) {
     }
 }
 
+inline void tensor_pool_callback(void* args, size_t index) {
+    auto released = static_cast<std::vector<size_t>*>(args);
+    std::lock_guard<std::mutex> lock(ov_infer_request_test::m);
+    released->push_back(index);
+}
+
+TEST_P(ov_infer_request_test, infer_with_tensor_pool) {
+    ov_shape_t tensor_shape = {0, nullptr};
+    ov_element_type_e tensor_type;
+    OV_EXPECT_OK(ov_tensor_get_shape(input_tensor, &tensor_shape));
+    OV_EXPECT_OK(ov_tensor_get_element_type(input_tensor, &tensor_type));
+    size_t byte_size = 0;
+    OV_EXPECT_OK(ov_tensor_get_byte_size(input_tensor, &byte_size));
+
+    std::vector<std::vector<uint8_t>> buffers(2, std::vector<uint8_t>(byte_size));
+    void* host_ptrs[2] = {buffers[0].data(), buffers[1].data()};
+    ov_tensor_pool_t* pool = nullptr;
+    OV_ASSERT_OK(ov_tensor_pool_create(tensor_type, tensor_shape, host_ptrs, 2, &pool));
+    ov_shape_free(&tensor_shape);
+
+    std::vector<size_t> released;
+    ov_tensor_pool_callback_t callback = {tensor_pool_callback, &released};
+    OV_EXPECT_OK(ov_tensor_pool_set_callback(pool, &callback));
+
+    // the buffer must be acquired before binding
+    EXPECT_EQ(ov_status_e::OUT_OF_BOUNDS, ov_infer_request_set_tensor_from_pool(infer_request, in_tensor_name, pool, 0));
+
+    for (size_t i = 0; i < 3; i++) {
+        size_t index = 0;
+        OV_EXPECT_OK(ov_tensor_pool_acquire(pool, &index));
+        OV_EXPECT_OK(ov_infer_request_set_tensor_from_pool(infer_request, in_tensor_name, pool, index));
+
+        ov_tensor_t* tensor = nullptr;
+        OV_EXPECT_OK(ov_infer_request_get_tensor(infer_request, in_tensor_name, &tensor));
+        void* data = nullptr;
+        OV_EXPECT_OK(ov_tensor_data(tensor, &data));
+        EXPECT_EQ(host_ptrs[index], data);
+        ov_tensor_free(tensor);
+
+        OV_ASSERT_OK(ov_infer_request_infer(infer_request));
+        ASSERT_EQ(i + 1, released.size());
+        EXPECT_EQ(index, released.back());
+        OV_EXPECT_OK(ov_tensor_pool_release(pool, index));
+    }
+    ov_tensor_pool_free(pool);
+}
+
+TEST_P(ov_infer_request_test, infer_async_with_tensor_pool) {
+    size_t byte_size = 0;
+    OV_EXPECT_OK(ov_tensor_get_byte_size(input_tensor, &byte_size));
+    ov_shape_t tensor_shape = {0, nullptr};
+    ov_element_type_e tensor_type;
+    OV_EXPECT_OK(ov_tensor_get_shape(input_tensor, &tensor_shape));
+    OV_EXPECT_OK(ov_tensor_get_element_type(input_tensor, &tensor_type));
+
+    std::vector<uint8_t> buffer(byte_size);
+    void* host_ptrs[1] = {buffer.data()};
+    ov_tensor_pool_t* pool = nullptr;
+    OV_ASSERT_OK(ov_tensor_pool_create(tensor_type, tensor_shape, host_ptrs, 1, &pool));
+    ov_shape_free(&tensor_shape);
+
+    std::vector<size_t> released;
+    ov_tensor_pool_callback_t pool_callback = {tensor_pool_callback, &released};
+    OV_EXPECT_OK(ov_tensor_pool_set_callback(pool, &pool_callback));
+
+    size_t index = 0;
+    OV_EXPECT_OK(ov_tensor_pool_acquire(pool, &index));
+    OV_EXPECT_OK(ov_infer_request_set_input_tensor_from_pool(infer_request, 0, pool, index));
+
+    ov_infer_request_test::ready = false;
+    ov_callback_t callback;
+    callback.callback_func = infer_request_callback;
+    callback.args = infer_request;
+    OV_EXPECT_OK(ov_infer_request_set_callback(infer_request, &callback));
+
+    OV_ASSERT_OK(ov_infer_request_start_async(infer_request));
+
+    if (!HasFatalFailure()) {
+        std::unique_lock<std::mutex> lock(ov_infer_request_test::m);
+        ov_infer_request_test::condVar.wait(lock, [] {
+            return ov_infer_request_test::ready;
+        });
+        ASSERT_EQ(1u, released.size());
+        EXPECT_EQ(index, released[0]);
+    }
+    OV_EXPECT_OK(ov_infer_request_wait(infer_request));
+    OV_EXPECT_OK(ov_tensor_pool_release(pool, index));
+    ov_tensor_pool_free(pool);
+}
+
 TEST_P(ov_infer_request_test, get_profiling_info) {
     auto device_name = GetParam();
     OV_EXPECT_OK(ov_infer_request_set_tensor(infer_request, in_tensor_name, input_tensor));
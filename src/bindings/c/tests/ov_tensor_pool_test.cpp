@@ -0,0 +1,88 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#include "ov_test.hpp"
+
+namespace {
+
+inline void setup_pool(ov_tensor_pool_t** pool, float (*buffers)[12], size_t count) {
+    int64_t dims[2] = {3, 4};
+    ov_shape_t shape;
+    OV_EXPECT_OK(ov_shape_create(2, dims, &shape));
+    std::vector<void*> host_ptrs;
+    for (size_t i = 0; i < count; i++) {
+        host_ptrs.push_back(buffers[i]);
+    }
+    OV_EXPECT_OK(ov_tensor_pool_create(ov_element_type_e::F32, shape, host_ptrs.data(), count, pool));
+    EXPECT_NE(nullptr, *pool);
+    ov_shape_free(&shape);
+}
+
+}  // namespace
+
+TEST(ov_tensor_pool, ov_tensor_pool_create) {
+    float buffers[3][12] = {};
+    ov_tensor_pool_t* pool = nullptr;
+    setup_pool(&pool, buffers, 3);
+
+    size_t count = 0;
+    OV_EXPECT_OK(ov_tensor_pool_get_free_count(pool, &count));
+    EXPECT_EQ(3u, count);
+    ov_tensor_pool_free(pool);
+}
+
+TEST(ov_tensor_pool, ov_tensor_pool_create_error_handling) {
+    int64_t dims[2] = {3, 4};
+    ov_shape_t shape;
+    OV_EXPECT_OK(ov_shape_create(2, dims, &shape));
+    float buffer[12] = {};
+    void* host_ptrs[2] = {buffer, nullptr};
+    ov_tensor_pool_t* pool = nullptr;
+    OV_EXPECT_NOT_OK(ov_tensor_pool_create(ov_element_type_e::F32, shape, host_ptrs, 2, &pool));
+    OV_EXPECT_NOT_OK(ov_tensor_pool_create(ov_element_type_e::F32, shape, host_ptrs, 0, &pool));
+    OV_EXPECT_NOT_OK(ov_tensor_pool_create(ov_element_type_e::F32, shape, nullptr, 1, &pool));
+    OV_EXPECT_NOT_OK(ov_tensor_pool_create(ov_element_type_e::F32, shape, host_ptrs, 1, nullptr));
+    EXPECT_EQ(nullptr, pool);
+    ov_shape_free(&shape);
+}
+
+TEST(ov_tensor_pool, ov_tensor_pool_acquire_in_release_order) {
+    float buffers[3][12] = {};
+    ov_tensor_pool_t* pool = nullptr;
+    setup_pool(&pool, buffers, 3);
+
+    size_t first = 0, second = 0, third = 0, index = 0;
+    OV_EXPECT_OK(ov_tensor_pool_acquire(pool, &first));
+    OV_EXPECT_OK(ov_tensor_pool_acquire(pool, &second));
+    OV_EXPECT_OK(ov_tensor_pool_acquire(pool, &third));
+    EXPECT_EQ(0u, first);
+    EXPECT_EQ(1u, second);
+    EXPECT_EQ(2u, third);
+    EXPECT_EQ(ov_status_e::NOT_ALLOCATED, ov_tensor_pool_acquire(pool, &index));
+
+    OV_EXPECT_OK(ov_tensor_pool_release(pool, second));
+    OV_EXPECT_OK(ov_tensor_pool_release(pool, first));
+    EXPECT_EQ(ov_status_e::OUT_OF_BOUNDS, ov_tensor_pool_release(pool, first));
+    EXPECT_EQ(ov_status_e::OUT_OF_BOUNDS, ov_tensor_pool_release(pool, 3));
+
+    OV_EXPECT_OK(ov_tensor_pool_acquire(pool, &index));
+    EXPECT_EQ(second, index);
+    OV_EXPECT_OK(ov_tensor_pool_acquire(pool, &index));
+    EXPECT_EQ(first, index);
+
+    size_t count = 0;
+    OV_EXPECT_OK(ov_tensor_pool_get_free_count(pool, &count));
+    EXPECT_EQ(0u, count);
+    ov_tensor_pool_free(pool);
+}
+
+TEST(ov_tensor_pool, ov_tensor_pool_set_callback_error_handling) {
+    float buffers[1][12] = {};
+    ov_tensor_pool_t* pool = nullptr;
+    setup_pool(&pool, buffers, 1);
+
+    ov_tensor_pool_callback_t callback = {nullptr, nullptr};
+    OV_EXPECT_NOT_OK(ov_tensor_pool_set_callback(pool, &callback));
+    OV_EXPECT_NOT_OK(ov_tensor_pool_set_callback(pool, nullptr));
+    ov_tensor_pool_free(pool);
+}
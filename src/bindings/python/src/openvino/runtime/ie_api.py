@@ -2,8 +2,9 @@
 # Copyright (C) 2018-2023 Intel Corporation
 # SPDX-License-Identifier: Apache-2.0
 
-from typing import Any, Iterable, Union, Optional, Dict
+from typing import Any, Iterable, List, Union, Optional, Dict
 from pathlib import Path
+import asyncio
 import warnings
 
 import numpy as np
@@ -21,6 +22,7 @@ from openvino.runtime.utils.data_helpers import (
     _data_dispatch,
     tensor_from_file,
 )
+from openvino.runtime.utils.data_helpers.event_loop import _EventLoopNotifier, get_event_loop_notifier
 
 
 def _deprecated_memory_arg(shared_memory: bool, share_inputs: bool) -> bool:
@@ -219,6 +221,64 @@ class InferRequest(_InferRequestWrapper):
             userdata,
         )
 
+    async def infer_async(
+        self,
+        inputs: Any = None,
+        share_inputs: bool = False,
+    ) -> OVDict:
+        """Infers specified input(s) asynchronously and awaits the results in asyncio event loop.
+
+        Inference is started immediately, the coroutine is resumed on the event loop thread
+        when the inference is finished. Completions are delivered through a pipe read by
+        the event loop, so OpenVINO threads don't acquire the GIL.
+
+        Replaces the callback set by `set_callback`. `set_callback` raises an error while
+        the result is awaited.
+
+        .. code-block:: python
+
+            async def run(request, data):
+                results = await request.infer_async(data)
+
+        :param inputs: Data to be set on input tensors, see `start_async` for allowed types.
+        :type inputs: Any, optional
+        :param share_inputs: Enables `share_inputs` mode, see `start_async`.
+                             Default value: False
+        :type share_inputs: bool, optional
+        :return: Dictionary of results from output tensors with port/int/str keys.
+        :rtype: OVDict
+        """
+        loop = asyncio.get_running_loop()
+        notifier = get_event_loop_notifier(loop)
+        future = loop.create_future()
+
+        def on_completion(offsets: List[int]) -> None:
+            notifier.detach(self)
+            notifier.unregister(token)
+            if future.cancelled():
+                return
+            try:
+                # Rethrows the error of the inference, if any
+                self.wait()
+                future.set_result(self.results)
+            except Exception as error:
+                future.set_exception(error)
+
+        token = notifier.register(on_completion)
+        try:
+            # Fails if the request is running, e.g. awaited by another coroutine
+            notifier.attach(self, token)
+        except Exception:
+            notifier.unregister(token)
+            raise
+        try:
+            self.start_async(inputs, share_inputs=share_inputs)
+        except Exception:
+            notifier.detach(self)
+            notifier.unregister(token)
+            raise
+        return await future
+
     def get_compiled_model(self) -> "CompiledModel":
         """Gets the compiled model this InferRequest is using.
 
@@ -396,6 +456,16 @@ class AsyncInferQueue(AsyncInferQueueBase):
     a simple pipeline.
     """
 
+    def __init__(self, *args: Any, **kwargs: Any) -> None:
+        super().__init__(*args, **kwargs)
+        # State of the asyncio mode, set by infer_async and reset when no call is in progress
+        self._loop: Optional[asyncio.AbstractEventLoop] = None
+        self._notifier: Optional[_EventLoopNotifier] = None
+        self._first_token = 0
+        self._active_calls = 0
+        self._pending: Dict[int, asyncio.Future] = {}
+        self._idle_waiters: List[asyncio.Future] = []
+
     def __iter__(self) -> Iterable[InferRequest]:
         """Allows to iterate over AsyncInferQueue.
 
@@ -491,6 +561,120 @@ class AsyncInferQueue(AsyncInferQueueBase):
             userdata,
         )
 
+    async def infer_async(
+        self,
+        inputs: Any = None,
+        share_inputs: bool = False,
+    ) -> OVDict:
+        """Infers specified input(s) on the next available InferRequest and awaits the results.
+
+        Waits for an idle InferRequest without blocking the event loop. Completions of all requests
+        from the pool are delivered to the event loop thread in batches, each wake-up of the loop
+        processes all requests finished by that time.
+
+        The pool is switched to asyncio mode bound to the running event loop while any call
+        is in progress: callbacks set by `set_callback` are replaced, `set_callback` raises
+        an error and requests are returned to the pool by the event loop. The pool is unbound
+        from the event loop when the last call is finished, so it may be used with synchronous
+        functions or another event loop afterwards. All requests have to be idle when the pool
+        is switched to asyncio mode, e.g. after `wait_all`.
+
+        .. code-block:: python
+
+            async def run(queue, images):
+                return await asyncio.gather(*(queue.infer_async(image) for image in images))
+
+        :param inputs: Data to be set on input tensors, see `start_async` for allowed types.
+        :type inputs: Any, optional
+        :param share_inputs: Enables `share_inputs` mode, see `start_async`.
+                             Default value: False
+        :type share_inputs: bool, optional
+        :return: Dictionary of results from output tensors with port/int/str keys.
+        :rtype: OVDict
+        """
+        loop = asyncio.get_running_loop()
+        if self._loop is not None and self._loop.is_closed():
+            self._unbind_closed_loop()
+        if self._loop is None:
+            self._bind(loop)
+        elif self._loop is not loop:
+            raise RuntimeError("AsyncInferQueue is already bound to another event loop!")
+
+        self._active_calls += 1
+        waiter = None
+        try:
+            while not self.is_ready():
+                waiter = loop.create_future()
+                self._idle_waiters.append(waiter)
+                await waiter
+            waiter = None
+
+            request_id = self.get_idle_request_id()
+            future = loop.create_future()
+            self._pending[request_id] = future
+            try:
+                self.start_async(inputs, share_inputs=share_inputs)
+            except Exception:
+                self._pending.pop(request_id)
+                raise
+            return await future
+        finally:
+            if waiter is not None and waiter in self._idle_waiters:
+                self._idle_waiters.remove(waiter)
+            self._active_calls -= 1
+            self._unbind_if_idle()
+
+    def _bind(self, loop: asyncio.AbstractEventLoop) -> None:
+        notifier = get_event_loop_notifier(loop)
+        first_token = notifier.register(self._on_completions, len(self))
+        try:
+            # Fails if any request is running
+            notifier.attach(self, first_token)
+        except Exception:
+            notifier.unregister(first_token, len(self))
+            raise
+        self._loop = loop
+        self._notifier = notifier
+        self._first_token = first_token
+
+    def _unbind_if_idle(self) -> None:
+        # Requests of cancelled calls are still running and their completions are awaited
+        if self._notifier is None or self._active_calls > 0 or self._pending:
+            return
+        notifier, self._notifier, self._loop = self._notifier, None, None
+        # Further completions return requests to the pool without the event loop
+        notifier.detach(self)
+        notifier.unregister(self._first_token, len(self))
+
+    def _unbind_closed_loop(self) -> None:
+        # Completions of requests started by cancelled calls will never be processed by the closed loop,
+        # closing the notifier returns the requests to the pool
+        if self._notifier is not None:
+            self._notifier.close()
+        self._loop, self._notifier = None, None
+        self._active_calls = 0
+        self._pending.clear()
+        self._idle_waiters.clear()
+
+    def _on_completions(self, ids: List[int]) -> None:
+        for request_id in ids:
+            future = self._pending.pop(request_id, None)
+            if future is None or future.cancelled():
+                continue
+            request = self[request_id]
+            try:
+                # Rethrows the error of the inference, if any
+                request.wait()
+                future.set_result(request.results)
+            except Exception as error:
+                future.set_exception(error)
+        self._release_requests(ids)
+        waiters, self._idle_waiters = self._idle_waiters, []
+        for waiter in waiters:
+            if not waiter.done():
+                waiter.set_result(None)
+        self._unbind_if_idle()
+
 
 class Core(CoreBase):
     """Core class represents OpenVINO runtime Core entity.
@@ -35,7 +35,17 @@ def value_to_tensor(
     request: Optional[_InferRequestWrapper] = None,
     is_shared: bool = False,
     key: Optional[ValidKeys] = None,
-) -> None:
+) -> Tensor:
+    # Objects implementing DLPack protocol (e.g. torch.Tensor) are shared without a copy
+    if hasattr(value, "__dlpack__"):
+        tensor = Tensor.from_dlpack(value)
+        request_tensor = get_request_tensor(request, key)
+        # Scalars are reshaped to the shape of the input the same way as numpy scalar arrays are.
+        is_reshaped = len(tensor.shape) == 0 and tuple(request_tensor.shape) != ()
+        if is_shared and not is_reshaped and tensor.get_element_type() == request_tensor.get_element_type() and tensor.is_continuous():
+            return tensor
+        # Otherwise, fallback to numpy view of the shared memory, which is converted and copied.
+        return value_to_tensor(np.ascontiguousarray(tensor.data), request=request, is_shared=False, key=key)
     raise TypeError(f"Incompatible inputs of type: {type(value)}")
 
 
@@ -103,6 +113,9 @@ def _(
 
 def to_c_style(value: Any, is_shared: bool = False) -> Any:
     if not isinstance(value, np.ndarray):
+        # DLPack capable objects are shared by Tensor directly, see value_to_tensor
+        if hasattr(value, "__dlpack__"):
+            return value
         if hasattr(value, "__array__"):
             return to_c_style(np.array(value, copy=False)) if is_shared else np.array(value, copy=True)
         return value
@@ -117,7 +130,9 @@ def normalize_arrays(
     inputs: Any,
     is_shared: bool = False,
 ) -> Any:
-    # Check the special case of the array-interface
+    # Check the special case of the DLPack and array-interface
+    if is_shared and hasattr(inputs, "__dlpack__"):
+        return inputs
     if hasattr(inputs, "__array__"):
         return to_c_style(np.array(inputs, copy=False)) if is_shared else np.array(inputs, copy=True)
     # Error should be raised if type does not match any dispatchers
@@ -163,8 +178,8 @@ def create_shared(
     inputs: Any,
     request: _InferRequestWrapper,
 ) -> None:
-    # Check the special case of the array-interface
-    if hasattr(inputs, "__array__"):
+    # Check the special case of the DLPack and array-interface
+    if hasattr(inputs, "__dlpack__") or hasattr(inputs, "__array__"):
         request._inputs_data = normalize_arrays(inputs, is_shared=True)
         return value_to_tensor(request._inputs_data, request=request, is_shared=True)
     # Error should be raised if type does not match any dispatchers
@@ -232,6 +247,10 @@ def update_tensor(
     if hasattr(inputs, "__array__"):
         update_tensor(normalize_arrays(inputs, is_shared=False), request, key)
         return None
+    # Objects implementing only DLPack protocol are copied from numpy view of their memory
+    if hasattr(inputs, "__dlpack__"):
+        update_tensor(Tensor.from_dlpack(inputs).data, request, key)
+        return None
     raise TypeError(f"Incompatible inputs of type: {type(inputs)} under {key} key!")
 
 
@@ -276,7 +295,7 @@ def update_inputs(inputs: dict, request: _InferRequestWrapper) -> dict:
     """Helper function to prepare inputs for inference.
 
     It creates copy of Tensors or copy data to already allocated Tensors on device
-    if the item is of type `np.ndarray`, `np.number`, `int`, `float` or has numpy __array__ attribute.
+    if the item is of type `np.ndarray`, `np.number`, `int`, `float` or has numpy __array__ or __dlpack__ attribute.
     """
     # Create new temporary dictionary.
     # new_inputs will be used to transfer data to inference calls,
@@ -285,13 +304,14 @@ def update_inputs(inputs: dict, request: _InferRequestWrapper) -> dict:
     for key, value in inputs.items():
         if not isinstance(key, (str, int, ConstOutput)):
             raise TypeError(f"Incompatible key type for input: {key}")
-        # Copy numpy arrays to already allocated Tensors.
-        # If value object has __array__ attribute, load it to Tensor using np.array
-        if isinstance(value, (np.ndarray, np.number, int, float)) or hasattr(value, "__array__"):
-            update_tensor(value, request, key)
         # If value is of Tensor type, put it into temporary dictionary.
-        elif isinstance(value, Tensor):
+        # Tensor implements DLPack protocol itself, so it's checked first.
+        if isinstance(value, Tensor):
             new_inputs[key] = value
+        # Copy numpy arrays to already allocated Tensors.
+        # If value object has __array__ or __dlpack__ attribute, load it to Tensor using numpy
+        elif isinstance(value, (np.ndarray, np.number, int, float)) or hasattr(value, "__array__") or hasattr(value, "__dlpack__"):
+            update_tensor(value, request, key)
         # Throw error otherwise.
         else:
             raise TypeError(f"Incompatible inputs of type: {type(value)} under {key} key!")
@@ -307,6 +327,9 @@ def create_copied(
     if hasattr(inputs, "__array__"):
         update_tensor(normalize_arrays(inputs, is_shared=False), request, key=None)
         return {}
+    if hasattr(inputs, "__dlpack__"):
+        update_tensor(inputs, request, key=None)
+        return {}
     # Error should be raised if type does not match any dispatchers
     raise TypeError(f"Incompatible inputs of type: {type(inputs)}")
 
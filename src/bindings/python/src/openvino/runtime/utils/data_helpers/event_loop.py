@@ -0,0 +1,124 @@
+# -*- coding: utf-8 -*-
+# Copyright (C) 2018-2023 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+
+import asyncio
+import os
+import struct
+import weakref
+from typing import Any, Callable, Dict, List, Tuple
+
+# Native callbacks write tokens as uint64 in native byte order, see Common::NotificationFd
+_TOKEN = struct.Struct("=Q")
+# Maximum number of tokens read by a single wake-up of the event loop
+_MAX_BATCH = 4096
+
+
+def _close_pipe(read_fd: int, write_fd: int, owners: "weakref.WeakSet[Any]") -> None:
+    # Native callbacks must stop writing before the descriptor is closed and possibly reused
+    for owner in list(owners):
+        owner._clear_notification_fd(write_fd)
+    os.close(read_fd)
+    os.close(write_fd)
+
+
+class _EventLoopNotifier:
+    """Delivers completions of asynchronous inference to the asyncio event loop.
+
+    Completion callbacks of InferRequests write tokens to a pipe without acquiring the GIL.
+    The event loop reads all pending tokens on a single wake-up and passes them to
+    the registered handlers in batches, so there is no GIL hand-off per finished request.
+
+    The notifier is closed when it has no registered handlers left: the pipe is removed
+    from the event loop, the owners stop writing to it and only then it's closed.
+    """
+
+    def __init__(self, loop: asyncio.AbstractEventLoop) -> None:
+        self._loop = loop
+        self._read_fd, self._write_fd = os.pipe()
+        # Objects (InferRequest, AsyncInferQueue) whose native callbacks write to the pipe
+        self._owners: "weakref.WeakSet[Any]" = weakref.WeakSet()
+        self._finalizer = weakref.finalize(self, _close_pipe, self._read_fd, self._write_fd, self._owners)
+        os.set_blocking(self._read_fd, False)
+        # token -> (handler, first token registered for the handler)
+        self._handlers: Dict[int, Tuple[Callable[[List[int]], None], int]] = {}
+        self._next_token = 0
+        self._close_scheduled = False
+        try:
+            loop.add_reader(self._read_fd, self._dispatch)
+        except NotImplementedError:
+            self._finalizer()
+            raise NotImplementedError("Asynchronous inference with asyncio requires an event loop "
+                                      "supporting add_reader(), e.g. asyncio.SelectorEventLoop.")
+
+    @property
+    def closed(self) -> bool:
+        return not self._finalizer.alive
+
+    def register(self, handler: Callable[[List[int]], None], count: int = 1) -> int:
+        """Registers handler for `count` consecutive tokens and returns the first one.
+
+        Handler is called with the list of offsets of received tokens from the first one.
+        """
+        first = self._next_token
+        self._next_token += count
+        for token in range(first, first + count):
+            self._handlers[token] = (handler, first)
+        return first
+
+    def unregister(self, first: int, count: int = 1) -> None:
+        for token in range(first, first + count):
+            self._handlers.pop(token, None)
+        if not self._handlers and not self._close_scheduled:
+            # Deferred, so awaiting code resumed by the handler may register again without reopening the pipe
+            self._close_scheduled = True
+            self._loop.call_soon(self._close_if_unused)
+
+    def attach(self, owner: Any, token: int) -> None:
+        """Makes native callbacks of `owner` write tokens starting from `token` to the pipe."""
+        owner._set_notification_fd(self._write_fd, token)
+        self._owners.add(owner)
+
+    def detach(self, owner: Any) -> None:
+        """Stops native callbacks of `owner` from writing to the pipe."""
+        owner._clear_notification_fd(self._write_fd)
+        self._owners.discard(owner)
+
+    def close(self) -> None:
+        if self.closed:
+            return
+        if _notifiers.get(self._loop) is self:
+            del _notifiers[self._loop]
+        if not self._loop.is_closed():
+            self._loop.remove_reader(self._read_fd)
+        self._finalizer()
+
+    def _close_if_unused(self) -> None:
+        self._close_scheduled = False
+        if not self._handlers:
+            self.close()
+
+    def _dispatch(self) -> None:
+        try:
+            data = os.read(self._read_fd, _TOKEN.size * _MAX_BATCH)
+        except BlockingIOError:
+            return
+        batches: Dict[Callable[[List[int]], None], List[int]] = {}
+        for (token,) in _TOKEN.iter_unpack(data):
+            # Tokens of unregistered handlers (e.g. cancelled calls) are dropped
+            if token in self._handlers:
+                handler, first = self._handlers[token]
+                batches.setdefault(handler, []).append(token - first)
+        for handler, offsets in batches.items():
+            handler(offsets)
+
+
+_notifiers: "weakref.WeakKeyDictionary[asyncio.AbstractEventLoop, _EventLoopNotifier]" = weakref.WeakKeyDictionary()
+
+
+def get_event_loop_notifier(loop: asyncio.AbstractEventLoop) -> _EventLoopNotifier:
+    notifier = _notifiers.get(loop)
+    if notifier is None:
+        notifier = _EventLoopNotifier(loop)
+        _notifiers[loop] = notifier
+    return notifier
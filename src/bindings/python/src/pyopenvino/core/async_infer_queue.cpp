@@ -12,6 +12,7 @@
 #include <mutex>
 #include <queue>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 #include "pyopenvino/core/common.hpp"
@@ -111,6 +112,9 @@ public:
     }
 
     void set_custom_callbacks(py::function f_callback) {
+        if (m_notification) {
+            OPENVINO_THROW("Cannot set callback while AsyncInferQueue is used by infer_async!");
+        }
         for (size_t handle = 0; handle < m_requests.size(); handle++) {
             m_requests[handle].m_request.set_callback([this, f_callback, handle](std::exception_ptr exception_ptr) {
                 *m_requests[handle].m_end_time = Time::now();
@@ -151,6 +155,65 @@ public:
         }
     }
 
+    void set_notification_fd(int fd, uint64_t first_token) {
+        {
+            // acquire the mutex to access m_idle_handles
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_idle_handles.size() != m_requests.size()) {
+                OPENVINO_THROW("AsyncInferQueue has running requests, call wait_all() before infer_async!");
+            }
+        }
+        auto notification = std::make_shared<Common::NotificationFd>(fd);
+        for (size_t handle = 0; handle < m_requests.size(); handle++) {
+            m_requests[handle].m_request.set_callback(
+                [this, notification, first_token, handle](std::exception_ptr exception_ptr) {
+                    *m_requests[handle].m_end_time = Time::now();
+                    {
+                        // acquire the mutex to access m_notified_handles
+                        std::lock_guard<std::mutex> lock(m_mutex);
+                        m_notified_handles.insert(handle);
+                    }
+                    // GIL is not acquired here, request stays busy until the event loop
+                    // processes the batch of completions and calls release_requests().
+                    // Once the descriptor is cleared, the request is returned to the pool here.
+                    if (!notification->write(first_token + handle)) {
+                        release_requests({handle});
+                    }
+                });
+        }
+        m_notification = notification;
+    }
+
+    void clear_notification_fd(int fd) {
+        if (!m_notification || m_notification->fd() != fd) {
+            return;
+        }
+        m_notification->clear();
+        m_notification.reset();
+        // Requests which have notified the event loop won't be released by it anymore
+        std::vector<size_t> handles;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            handles.assign(m_notified_handles.begin(), m_notified_handles.end());
+        }
+        release_requests(handles);
+    }
+
+    void release_requests(const std::vector<size_t>& handles) {
+        {
+            // acquire the mutex to access m_idle_handles and m_notified_handles
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (const auto handle : handles) {
+                // a request can be released either by the event loop or by clear_notification_fd()
+                if (m_notified_handles.erase(handle) > 0) {
+                    m_idle_handles.push(handle);
+                }
+            }
+        }
+        // Notify locks in getIdleRequestId()
+        m_cv.notify_all();
+    }
+
     // AsyncInferQueue is the owner of all requests. When AsyncInferQueue is destroyed,
     // all of requests are destroyed as well.
     std::vector<InferRequestWrapper> m_requests;
@@ -159,6 +222,10 @@ public:
     std::mutex m_mutex;
     std::condition_variable m_cv;
     std::queue<py::error_already_set> m_errors;
+    // Pipe of asyncio event loop which is notified on completions, set in asyncio mode
+    std::shared_ptr<Common::NotificationFd> m_notification;
+    // Finished requests which are not returned to the pool by the event loop yet
+    std::unordered_set<size_t> m_notified_handles;
 };
 
 void regclass_AsyncInferQueue(py::module m) {
@@ -318,6 +385,46 @@ void regclass_AsyncInferQueue(py::module m) {
             :type callback: function
         )");
 
+    cls.def("_set_notification_fd",
+            &AsyncInferQueue::set_notification_fd,
+            py::arg("fd"),
+            py::arg("first_token"),
+            R"(
+            Sets callbacks on all InferRequests from queue's pool which write `first_token` + id
+            of the finished request to file descriptor `fd`. Used to deliver completions to asyncio
+            event loop in batches, replaces callback set by `set_callback`.
+
+            Finished requests are not returned to the pool until `_release_requests` or
+            `_clear_notification_fd` is called. Requires all requests to be idle.
+
+            :param fd: File descriptor, e.g. write end of a pipe.
+            :type fd: int
+            :param first_token: Token written for the InferRequest with id 0.
+            :type first_token: int
+        )");
+
+    cls.def("_clear_notification_fd",
+            &AsyncInferQueue::clear_notification_fd,
+            py::arg("fd"),
+            R"(
+            Stops writing to file descriptor `fd` set by `_set_notification_fd`. Nothing is written
+            to the descriptor after the call, so it can be closed. Finished requests are returned
+            to the pool, further completions return requests to the pool without the event loop.
+
+            :param fd: File descriptor, e.g. write end of a pipe.
+            :type fd: int
+        )");
+
+    cls.def("_release_requests",
+            &AsyncInferQueue::release_requests,
+            py::arg("ids"),
+            R"(
+            Returns InferRequests with given ids to the pool of idle requests.
+
+            :param ids: Ids of InferRequests.
+            :type ids: List[int]
+        )");
+
     cls.def(
         "__len__",
         [](AsyncInferQueue& self) {
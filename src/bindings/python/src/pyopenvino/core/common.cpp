@@ -4,11 +4,19 @@
 
 #include "common.hpp"
 
+#include <cerrno>
 #include <unordered_map>
 
+#ifdef _WIN32
+#    include <io.h>
+#else
+#    include <unistd.h>
+#endif
+
 #include "Python.h"
 #include "openvino/core/except.hpp"
 #include "openvino/util/common_util.hpp"
+#include "pyopenvino/core/dlpack.hpp"
 
 #define C_CONTIGUOUS py::detail::npy_api::constants::NPY_ARRAY_C_CONTIGUOUS_
 
@@ -151,6 +159,185 @@ py::array array_from_tensor(ov::Tensor&& t, bool is_shared) {
 
 };  // namespace array_helpers
 
+namespace dlpack_helpers {
+
+namespace {
+
+// Keeps exported tensor alive together with shape and strides arrays referenced by DLTensor
+struct ExportContext {
+    ov::Tensor tensor;
+    std::vector<int64_t> shape;
+    std::vector<int64_t> strides;
+    dlpack::DLManagedTensor managed;
+};
+
+dlpack::DLDataType to_dl_type(const ov::element::Type& type) {
+    dlpack::DLDataType dl_type{0, static_cast<uint8_t>(type.bitwidth()), 1};
+    if (type == ov::element::boolean) {
+        dl_type.code = dlpack::kDLBool;
+    } else if (type == ov::element::bf16) {
+        dl_type.code = dlpack::kDLBfloat;
+    } else if (type.is_real()) {
+        dl_type.code = dlpack::kDLFloat;
+    } else if (type.is_signed()) {
+        dl_type.code = dlpack::kDLInt;
+    } else {
+        dl_type.code = dlpack::kDLUInt;
+    }
+    return dl_type;
+}
+
+ov::element::Type from_dl_type(const dlpack::DLDataType& dl_type) {
+    OPENVINO_ASSERT(dl_type.lanes == 1, "DLPack tensors with vector element types are not supported!");
+    switch (dl_type.code) {
+    case dlpack::kDLBool:
+        return ov::element::boolean;
+    case dlpack::kDLBfloat:
+        if (dl_type.bits == 16)
+            return ov::element::bf16;
+        break;
+    case dlpack::kDLFloat:
+        switch (dl_type.bits) {
+        case 16:
+            return ov::element::f16;
+        case 32:
+            return ov::element::f32;
+        case 64:
+            return ov::element::f64;
+        }
+        break;
+    case dlpack::kDLInt:
+        switch (dl_type.bits) {
+        case 8:
+            return ov::element::i8;
+        case 16:
+            return ov::element::i16;
+        case 32:
+            return ov::element::i32;
+        case 64:
+            return ov::element::i64;
+        }
+        break;
+    case dlpack::kDLUInt:
+        switch (dl_type.bits) {
+        case 8:
+            return ov::element::u8;
+        case 16:
+            return ov::element::u16;
+        case 32:
+            return ov::element::u32;
+        case 64:
+            return ov::element::u64;
+        }
+        break;
+    }
+    OPENVINO_THROW("Unsupported DLPack data type: code ",
+                   static_cast<int>(dl_type.code),
+                   ", bits ",
+                   static_cast<int>(dl_type.bits),
+                   ".");
+}
+
+void release_capsule(PyObject* capsule) {
+    // Capsule which was consumed is renamed and owned by the consumer
+    if (PyCapsule_IsValid(capsule, dlpack::capsule_name)) {
+        auto managed = static_cast<dlpack::DLManagedTensor*>(PyCapsule_GetPointer(capsule, dlpack::capsule_name));
+        if (managed && managed->deleter) {
+            managed->deleter(managed);
+        }
+    }
+}
+
+}  // namespace
+
+py::capsule tensor_to_dlpack(const ov::Tensor& tensor) {
+    const auto& type = tensor.get_element_type();
+    OPENVINO_ASSERT(type.bitwidth() >= Common::values::min_bitwidth,
+                    "Tensor with element type ",
+                    type,
+                    " can't be exported to DLPack!");
+
+    auto context = new ExportContext{tensor, {}, {}, {}};
+    const auto& shape = tensor.get_shape();
+    context->shape.assign(shape.begin(), shape.end());
+    if (!tensor.is_continuous()) {
+        for (const auto& stride : tensor.get_strides()) {
+            context->strides.push_back(static_cast<int64_t>(stride / type.size()));
+        }
+    }
+
+    auto& dl_tensor = context->managed.dl_tensor;
+    dl_tensor.data = tensor.data();
+    dl_tensor.device = {dlpack::kDLCPU, 0};
+    dl_tensor.ndim = static_cast<int32_t>(context->shape.size());
+    dl_tensor.dtype = to_dl_type(type);
+    dl_tensor.shape = context->shape.data();
+    dl_tensor.strides = context->strides.empty() ? nullptr : context->strides.data();
+    dl_tensor.byte_offset = 0;
+    context->managed.manager_ctx = context;
+    context->managed.deleter = [](dlpack::DLManagedTensor* self) {
+        delete static_cast<ExportContext*>(self->manager_ctx);
+    };
+
+    auto capsule = PyCapsule_New(&context->managed, dlpack::capsule_name, release_capsule);
+    if (!capsule) {
+        delete context;
+        throw py::error_already_set();
+    }
+    return py::reinterpret_steal<py::capsule>(capsule);
+}
+
+ov::Tensor tensor_from_dlpack(const py::object& obj) {
+    // Objects implementing the protocol are asked for a capsule, capsule itself is accepted as well
+    py::object capsule = py::hasattr(obj, "__dlpack__") ? obj.attr("__dlpack__")() : obj;
+    if (!PyCapsule_IsValid(capsule.ptr(), dlpack::capsule_name)) {
+        throw py::type_error("Expected an object implementing __dlpack__ or an unused DLPack capsule!");
+    }
+    auto managed = static_cast<dlpack::DLManagedTensor*>(PyCapsule_GetPointer(capsule.ptr(), dlpack::capsule_name));
+    const auto& dl_tensor = managed->dl_tensor;
+    OPENVINO_ASSERT(dl_tensor.device.device_type == dlpack::kDLCPU,
+                    "Only host memory DLPack tensors are supported, device type: ",
+                    static_cast<int>(dl_tensor.device.device_type),
+                    ".");
+
+    const auto type = from_dl_type(dl_tensor.dtype);
+    ov::Shape shape(dl_tensor.shape, dl_tensor.shape + dl_tensor.ndim);
+    ov::Strides strides;
+    if (dl_tensor.strides) {
+        // Compact row-major strides are dropped to keep the tensor continuous
+        bool is_compact = true;
+        int64_t expected = 1;
+        for (int32_t i = dl_tensor.ndim - 1; i >= 0; --i) {
+            if (dl_tensor.shape[i] != 1 && dl_tensor.strides[i] != expected) {
+                is_compact = false;
+            }
+            expected *= dl_tensor.shape[i];
+        }
+        if (!is_compact) {
+            for (int32_t i = 0; i < dl_tensor.ndim; ++i) {
+                OPENVINO_ASSERT(dl_tensor.strides[i] >= 0, "DLPack tensors with negative strides are not supported!");
+                strides.push_back(static_cast<size_t>(dl_tensor.strides[i]) * type.size());
+            }
+        }
+    }
+    auto data = static_cast<char*>(dl_tensor.data) + dl_tensor.byte_offset;
+    ov::Tensor view(type, shape, data, strides);
+
+    // From now on the producer's memory is owned by the returned tensor
+    PyCapsule_SetName(capsule.ptr(), dlpack::used_capsule_name);
+    std::shared_ptr<void> owner(managed, [](void* ptr) {
+        auto managed = static_cast<dlpack::DLManagedTensor*>(ptr);
+        if (managed->deleter && Py_IsInitialized()) {
+            // Producer's deleter may release Python objects
+            py::gil_scoped_acquire acquire;
+            managed->deleter(managed);
+        }
+    });
+    return ov::Tensor(view, owner);
+}
+
+};  // namespace dlpack_helpers
+
 template <>
 ov::op::v0::Constant create_copied(py::array& array) {
     // Convert to contiguous array if not already in C-style.
@@ -336,6 +523,31 @@ py::dict outputs_to_dict(InferRequestWrapper& request, bool share_outputs) {
     return res;
 }
 
+bool NotificationFd::write(uint64_t token) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_fd < 0) {
+        return false;
+    }
+    // Tokens are smaller than PIPE_BUF, so writes are atomic and never interleave
+#ifdef _WIN32
+    _write(m_fd, &token, sizeof(token));
+#else
+    while (::write(m_fd, &token, sizeof(token)) < 0 && errno == EINTR) {
+    }
+#endif
+    return true;
+}
+
+void NotificationFd::clear() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_fd = -1;
+}
+
+int NotificationFd::fd() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_fd;
+}
+
 ov::pass::Serialize::Version convert_to_version(const std::string& version) {
     using Version = ov::pass::Serialize::Version;
 
@@ -14,6 +14,7 @@
 #include <string>
 #include <iterator>
 #include <climits>
+#include <mutex>
 
 #include "Python.h"
 #include "openvino/runtime/compiled_model.hpp"
@@ -62,6 +63,15 @@ py::array array_from_tensor(ov::Tensor&& t, bool is_shared);
 
 }; // namespace array_helpers
 
+// Helpers for zero-copy exchange with other frameworks through DLPack
+namespace dlpack_helpers {
+
+py::capsule tensor_to_dlpack(const ov::Tensor& tensor);
+
+ov::Tensor tensor_from_dlpack(const py::object& obj);
+
+}; // namespace dlpack_helpers
+
 template <typename T>
 T create_copied(py::array& array);
 
@@ -96,6 +106,27 @@ uint32_t get_optimal_number_of_requests(const ov::CompiledModel& actual);
 
 py::dict outputs_to_dict(InferRequestWrapper& request, bool share_outputs);
 
+// Write end of a pipe read by Python's event loop, shared by completion callbacks.
+// The descriptor is cleared under the mutex before the pipe is closed, so callbacks
+// never write to a closed (or reused) descriptor.
+class NotificationFd {
+public:
+    explicit NotificationFd(int fd) : m_fd{fd} {}
+
+    // Writes token unless the descriptor is cleared, returns false in such case.
+    // Doesn't require GIL, so it's safe to call from completion callbacks.
+    bool write(uint64_t token);
+
+    // No write to the descriptor happens after the call returns.
+    void clear();
+
+    int fd() const;
+
+private:
+    mutable std::mutex m_mutex;
+    int m_fd;
+};
+
 ov::pass::Serialize::Version convert_to_version(const std::string& version);
 
 template <typename T>
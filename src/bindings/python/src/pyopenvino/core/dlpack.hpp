@@ -0,0 +1,58 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+
+// Subset of the DLPack ABI (https://github.com/dmlc/dlpack, v0.8) which is required
+// to exchange host tensors with other frameworks through `__dlpack__` capsules.
+// Layout of the structures must match dlpack.h exactly.
+namespace dlpack {
+
+enum DLDeviceType : int32_t {
+    kDLCPU = 1,
+};
+
+struct DLDevice {
+    DLDeviceType device_type;
+    int32_t device_id;
+};
+
+enum DLDataTypeCode : uint8_t {
+    kDLInt = 0U,
+    kDLUInt = 1U,
+    kDLFloat = 2U,
+    kDLBfloat = 4U,
+    kDLBool = 6U,
+};
+
+struct DLDataType {
+    uint8_t code;
+    uint8_t bits;
+    uint16_t lanes;
+};
+
+struct DLTensor {
+    void* data;
+    DLDevice device;
+    int32_t ndim;
+    DLDataType dtype;
+    int64_t* shape;
+    // Strides are counted in elements, nullptr means compact row-major layout
+    int64_t* strides;
+    uint64_t byte_offset;
+};
+
+struct DLManagedTensor {
+    DLTensor dl_tensor;
+    void* manager_ctx;
+    void (*deleter)(DLManagedTensor* self);
+};
+
+// Capsule names defined by the Python specification of DLPack
+constexpr const char* capsule_name = "dltensor";
+constexpr const char* used_capsule_name = "used_dltensor";
+
+};  // namespace dlpack
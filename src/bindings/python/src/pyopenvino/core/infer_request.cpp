@@ -334,6 +334,9 @@ void regclass_InferRequest(py::module m) {
     cls.def(
         "set_callback",
         [](InferRequestWrapper& self, py::function callback, py::object& userdata) {
+            if (self.m_notification && self.m_notification->fd() >= 0) {
+                OPENVINO_THROW("Cannot set callback while InferRequest is awaited by infer_async!");
+            }
             self.m_userdata = userdata;
             self.m_user_callback_defined = true;
             self.m_request.set_callback([&self, callback](std::exception_ptr exception_ptr) {
@@ -361,6 +364,52 @@ void regclass_InferRequest(py::module m) {
             :type userdata: Any
         )");
 
+    cls.def(
+        "_set_notification_fd",
+        [](InferRequestWrapper& self, int fd, uint64_t token) {
+            auto notification = std::make_shared<Common::NotificationFd>(fd);
+            auto end_time = self.m_end_time;
+            // Throws if the request is running, the previous notification stays in place then
+            self.m_request.set_callback([end_time, notification, token](std::exception_ptr exception_ptr) {
+                *end_time = Time::now();
+                // GIL is not acquired here, errors are reported by wait() called on the event loop
+                notification->write(token);
+            });
+            if (self.m_notification) {
+                self.m_notification->clear();
+            }
+            self.m_notification = notification;
+            self.m_user_callback_defined = false;
+        },
+        py::arg("fd"),
+        py::arg("token"),
+        R"(
+            Sets a callback which writes `token` to file descriptor `fd` on completion.
+            Used to integrate InferRequest with asyncio event loop, replaces any previously set callback.
+
+            :param fd: File descriptor, e.g. write end of a pipe.
+            :type fd: int
+            :param token: Token that identifies the request.
+            :type token: int
+        )");
+
+    cls.def(
+        "_clear_notification_fd",
+        [](InferRequestWrapper& self, int fd) {
+            if (self.m_notification && self.m_notification->fd() == fd) {
+                self.m_notification->clear();
+                self.m_notification.reset();
+            }
+        },
+        py::arg("fd"),
+        R"(
+            Stops writing to file descriptor `fd` set by `_set_notification_fd`.
+            Nothing is written to the descriptor after the call, so it can be closed.
+
+            :param fd: File descriptor, e.g. write end of a pipe.
+            :type fd: int
+        )");
+
     cls.def(
         "get_tensor",
         [](InferRequestWrapper& self, const std::string& name) {
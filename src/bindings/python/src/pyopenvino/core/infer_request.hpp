@@ -13,6 +13,10 @@
 
 namespace py = pybind11;
 
+namespace Common {
+class NotificationFd;
+}  // namespace Common
+
 typedef std::chrono::high_resolution_clock Time;
 typedef std::chrono::nanoseconds ns;
 
@@ -84,6 +88,8 @@ public:
     // Times of inference's start and finish
     std::shared_ptr<Time::time_point> m_start_time;  // proposal: change to unique_ptr
     std::shared_ptr<Time::time_point> m_end_time;
+    // Pipe of asyncio event loop which is notified on completion, set while infer_async is awaited
+    std::shared_ptr<Common::NotificationFd> m_notification;
 
 private:
     inline std::vector<ov::Tensor> get_tensors_from(const std::vector<ov::Output<const ov::Node>>& v) {
@@ -31,6 +31,8 @@ void regmodule_properties(py::module m) {
     wrap_property_RW(m_properties, ov::affinity, "affinity");
     wrap_property_RW(m_properties, ov::force_tbb_terminate, "force_tbb_terminate");
     wrap_property_RW(m_properties, ov::enable_mmap, "enable_mmap");
+    wrap_property_RW(m_properties, ov::enable_read_model_cache, "enable_read_model_cache");
+    wrap_property_RW(m_properties, ov::enable_tensor_memory_pool, "enable_tensor_memory_pool");
 
     wrap_property_RO(m_properties, ov::supported_properties, "supported_properties");
     wrap_property_RO(m_properties, ov::available_devices, "available_devices");
@@ -40,6 +42,7 @@ void regmodule_properties(py::module m) {
     wrap_property_RO(m_properties, ov::optimal_batch_size, "optimal_batch_size");
     wrap_property_RO(m_properties, ov::max_batch_size, "max_batch_size");
     wrap_property_RO(m_properties, ov::range_for_async_infer_requests, "range_for_async_infer_requests");
+    wrap_property_RO(m_properties, ov::tensor_memory_pool_statistics, "tensor_memory_pool_statistics");
 
     // Submodule hint
     py::module m_hint =
@@ -91,6 +94,9 @@ void regmodule_properties(py::module m) {
     wrap_property_RW(m_intel_cpu,
                      ov::intel_cpu::sparse_weights_decompression_rate,
                      "sparse_weights_decompression_rate");
+    wrap_property_RW(m_intel_cpu, ov::intel_cpu::huge_pages, "huge_pages");
+    wrap_property_RW(m_intel_cpu, ov::intel_cpu::numa_memory_placement, "numa_memory_placement");
+    wrap_property_RW(m_intel_cpu, ov::intel_cpu::numa_sub_devices, "numa_sub_devices");
 
     // Submodule intel_gpu
     py::module m_intel_gpu =
@@ -9,6 +9,7 @@
 
 #include "openvino/runtime/tensor.hpp"
 #include "pyopenvino/core/common.hpp"
+#include "pyopenvino/core/dlpack.hpp"
 
 namespace py = pybind11;
 
@@ -277,6 +278,72 @@ void regclass_Tensor(py::module m) {
             :rtype: numpy.array
         )");
 
+    cls.def_property_readonly(
+        "__array_interface__",
+        [](ov::Tensor& self) {
+            return Common::array_helpers::array_from_tensor(std::forward<ov::Tensor>(self), true)
+                .attr("__array_interface__");
+        },
+        R"(
+            NumPy array interface of Tensor's data.
+
+            Allows `numpy.asarray(tensor)` and other consumers of the array
+            interface to access Tensor's memory without a copy.
+
+            :rtype: dict
+        )");
+
+    cls.def(
+        "__dlpack__",
+        [](ov::Tensor& self, py::object& stream) {
+            return Common::dlpack_helpers::tensor_to_dlpack(self);
+        },
+        py::arg("stream") = py::none(),
+        R"(
+            Exports Tensor as a DLPack capsule without copying the data.
+
+            The capsule keeps Tensor's memory alive until the consumer releases it.
+            Tensors with u1, u4 and i4 element types can't be exported.
+
+            :param stream: Ignored, only host memory tensors are exported.
+            :rtype: PyCapsule
+        )");
+
+    cls.def(
+        "__dlpack_device__",
+        [](ov::Tensor& self) {
+            return py::make_tuple(static_cast<int>(dlpack::kDLCPU), 0);
+        },
+        R"(
+            Gets DLPack device of Tensor's memory.
+
+            :rtype: tuple
+        )");
+
+    cls.def_static("from_dlpack",
+                   &Common::dlpack_helpers::tensor_from_dlpack,
+                   py::arg("ext_tensor"),
+                   R"(
+                    Creates Tensor sharing memory of the object implementing DLPack protocol.
+
+                    Memory of the producer is kept alive as long as the Tensor exists,
+                    any action performed on it is reflected in the Tensor's memory!
+                    Only host (CPU) memory is supported.
+
+                    :param ext_tensor: Object with `__dlpack__` method (e.g. torch.Tensor)
+                                       or DLPack capsule.
+                    :type ext_tensor: Any
+                    :rtype: openvino.runtime.Tensor
+
+                    :Example:
+                    .. code-block:: python
+
+                        import openvino.runtime as ov
+                        import torch
+
+                        t = ov.Tensor.from_dlpack(torch.ones((1, 3, 224, 224)))
+                   )");
+
     cls.def("get_shape",
             &ov::Tensor::get_shape,
             R"(
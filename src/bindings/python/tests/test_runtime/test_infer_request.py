@@ -3,6 +3,7 @@
 # SPDX-License-Identifier: Apache-2.0
 
 from collections.abc import Iterable
+import asyncio
 from copy import deepcopy
 import numpy as np
 import os
@@ -654,6 +655,163 @@ def test_infer_queue_get_idle_handle(device):
     queue.wait_all()
 
 
+@pytest.mark.parametrize("share_inputs", [True, False])
+def test_infer_async_awaitable(device, share_inputs):
+    request, arr_1, arr_2 = create_simple_request_and_inputs(device)
+
+    async def run():
+        first = await request.infer_async({0: arr_1, 1: arr_2}, share_inputs=share_inputs)
+        second = await request.infer_async({0: arr_2, 1: arr_2}, share_inputs=share_inputs)
+        return first, second
+
+    first, second = asyncio.run(run())
+    assert np.array_equal(first[0], arr_1 + arr_2)
+    assert np.array_equal(second[0], arr_2 + arr_2)
+
+
+def test_infer_queue_infer_async(device):
+    jobs = 16
+    param = ops.parameter([10], np.float32)
+    model = Model(ops.relu(param), [param])
+    core = Core()
+    compiled_model = core.compile_model(model, device)
+    infer_queue = AsyncInferQueue(compiled_model, 3)
+    inputs = [np.arange(-5, 5, dtype=np.float32) * i for i in range(jobs)]
+
+    async def run():
+        return await asyncio.gather(*(infer_queue.infer_async({0: data}) for data in inputs))
+
+    results = asyncio.run(run())
+    assert len(results) == jobs
+    for data, result in zip(inputs, results):
+        assert np.array_equal(result[0], np.maximum(data, 0))
+    assert infer_queue.is_ready()
+
+
+def test_infer_async_loop_reuse_and_sync_calls(device):
+    request, arr_1, arr_2 = create_simple_request_and_inputs(device)
+
+    async def run():
+        return await request.infer_async({0: arr_1, 1: arr_2})
+
+    # each asyncio.run creates a new event loop
+    for _ in range(3):
+        assert np.array_equal(asyncio.run(run())[0], arr_1 + arr_2)
+        # synchronous API and callbacks work after the awaited call is finished
+        callback_results = []
+        request.set_callback(lambda userdata: callback_results.append(userdata), 42)
+        request.start_async({0: arr_2, 1: arr_2})
+        request.wait()
+        assert callback_results == [42]
+        assert np.array_equal(request.results[0], arr_2 + arr_2)
+        assert np.array_equal(request.infer({0: arr_1, 1: arr_1})[0], arr_1 + arr_1)
+
+
+def test_infer_async_set_callback_while_awaited(device):
+    request, arr_1, arr_2 = create_simple_request_and_inputs(device)
+
+    async def run():
+        task = asyncio.ensure_future(request.infer_async({0: arr_1, 1: arr_2}))
+        await asyncio.sleep(0)
+        with pytest.raises(RuntimeError) as e:
+            request.set_callback(lambda userdata: None, None)
+        assert "awaited by infer_async" in str(e.value)
+        return await task
+
+    assert np.array_equal(asyncio.run(run())[0], arr_1 + arr_2)
+
+
+def test_infer_async_notifier_teardown(device):
+    from openvino.runtime.utils.data_helpers.event_loop import _notifiers
+
+    request, arr_1, arr_2 = create_simple_request_and_inputs(device)
+    notifiers = []
+
+    async def run():
+        results = await request.infer_async({0: arr_1, 1: arr_2})
+        notifiers.extend(_notifiers.values())
+        return results
+
+    assert np.array_equal(asyncio.run(run())[0], arr_1 + arr_2)
+    # the pipe is closed when no calls are in progress, further completions don't write to it
+    assert len(notifiers) == 1
+    assert notifiers[0].closed
+    assert len(_notifiers) == 0
+    request.start_async({0: arr_2, 1: arr_2})
+    request.wait()
+    assert np.array_equal(request.results[0], arr_2 + arr_2)
+
+
+def test_infer_queue_infer_async_loop_reuse_and_sync_calls(device):
+    jobs = 8
+    param = ops.parameter([10], np.float32)
+    model = Model(ops.relu(param), [param])
+    core = Core()
+    compiled_model = core.compile_model(model, device)
+    infer_queue = AsyncInferQueue(compiled_model, 3)
+    inputs = [np.arange(-5, 5, dtype=np.float32) * i for i in range(jobs)]
+
+    async def run():
+        return await asyncio.gather(*(infer_queue.infer_async({0: data}) for data in inputs))
+
+    async def set_callback_while_bound():
+        task = asyncio.ensure_future(infer_queue.infer_async({0: inputs[0]}))
+        await asyncio.sleep(0)
+        with pytest.raises(RuntimeError) as e:
+            infer_queue.set_callback(lambda request, userdata: None)
+        assert "used by infer_async" in str(e.value)
+        return await task
+
+    for _ in range(3):
+        # the queue is unbound from the event loop when all calls are finished
+        results = asyncio.run(run())
+        for data, result in zip(inputs, results):
+            assert np.array_equal(result[0], np.maximum(data, 0))
+        assert infer_queue.is_ready()
+
+        # the requests are returned to the pool by synchronous API again
+        callback_results = {}
+
+        def callback(request, userdata):
+            callback_results[userdata] = request.results[0].copy()
+
+        infer_queue.set_callback(callback)
+        for i, data in enumerate(inputs):
+            infer_queue.start_async({0: data}, userdata=i)
+        infer_queue.wait_all()
+        assert len(callback_results) == jobs
+        for i, data in enumerate(inputs):
+            assert np.array_equal(callback_results[i], np.maximum(data, 0))
+
+        assert np.array_equal(asyncio.run(set_callback_while_bound())[0], np.maximum(inputs[0], 0))
+
+
+def test_infer_queue_infer_async_cancelled(device):
+    param = ops.parameter([10], np.float32)
+    model = Model(ops.relu(param), [param])
+    core = Core()
+    compiled_model = core.compile_model(model, device)
+    infer_queue = AsyncInferQueue(compiled_model, 2)
+    data = np.arange(-5, 5, dtype=np.float32)
+
+    async def cancel():
+        task = asyncio.ensure_future(infer_queue.infer_async({0: data}))
+        await asyncio.sleep(0)
+        task.cancel()
+
+    # the loop is closed before the completion of the cancelled call is processed
+    asyncio.run(cancel())
+    infer_queue.wait_all()
+
+    async def run():
+        return await asyncio.gather(*(infer_queue.infer_async({0: data}) for _ in range(4)))
+
+    for result in asyncio.run(run()):
+        assert np.array_equal(result[0], np.maximum(data, 0))
+    infer_queue.wait_all()
+    assert infer_queue.is_ready()
+
+
 @pytest.mark.parametrize("data_type",
                          [np.float32,
                           np.int32,
@@ -1171,6 +1329,54 @@ def test_not_writable_inputs_infer(device, share_inputs, input_data, change_flag
     assert not np.shares_memory(input_data[0], input_tensor.data)
 
 
+class DLPackProducer:
+    """Exposes memory of numpy array through DLPack protocol only, without __array__."""
+
+    def __init__(self, array):
+        self.array = array
+
+    def __dlpack__(self, stream=None):
+        return self.array.__dlpack__()
+
+    def __dlpack_device__(self):
+        return self.array.__dlpack_device__()
+
+
+@pytest.mark.skipif(not hasattr(np, "from_dlpack"), reason="DLPack is not supported by numpy")
+@pytest.mark.parametrize("share_inputs", [True, False])
+@pytest.mark.parametrize("as_dict", [True, False])
+@pytest.mark.parametrize(("input_shape", "array"), [
+    ([2, 3], np.array([[-1, 2, -3], [4, -5, 6]], dtype=np.float32)),
+    ([2, 3], np.array([[-1, 2, -3], [4, -5, 6]], dtype=np.int32)),
+    ([], np.array(-2.0, dtype=np.float32)),
+    ([], np.array(3, dtype=np.int32)),
+    ([1, 1], np.array(3.0, dtype=np.float32)),
+    ([1, 1], np.array(-3, dtype=np.int32)),
+])
+def test_dlpack_infer(device, share_inputs, as_dict, input_shape, array):
+    core = Core()
+    param = ops.parameter(input_shape, np.float32, name="data")
+    relu = ops.relu(param, name="relu")
+    model = Model([relu], [param], "dlpack_model")
+
+    compiled = core.compile_model(model=model, device_name=device)
+    request = compiled.create_infer_request()
+
+    input_data = {0: DLPackProducer(array)} if as_dict else DLPackProducer(array)
+    res = request.infer(input_data, share_inputs=share_inputs)
+
+    expected = np.maximum(array, 0).astype(np.float32).reshape(input_shape)
+    assert np.array_equal(res[request.model_outputs[0]], expected)
+
+    input_tensor = request.get_input_tensor()
+    assert list(input_tensor.shape) == input_shape
+    # Scalars reshaped to the input shape and inputs of other types are copied
+    if share_inputs and array.dtype == np.float32 and list(array.shape) == input_shape:
+        assert np.shares_memory(array, input_tensor.data)
+    else:
+        assert not np.shares_memory(array, input_tensor.data)
+
+
 @pytest.mark.parametrize("shared_flag", [True, False])
 def test_shared_memory_deprecation(device, shared_flag):
     compiled, request, _, input_data = abs_model_with_data(device, Type.f32, np.float32)
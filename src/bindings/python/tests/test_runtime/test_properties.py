@@ -153,6 +153,7 @@ def test_conflicting_enum(proxy_enums, expected_values):
         (properties.optimal_batch_size, "OPTIMAL_BATCH_SIZE"),
         (properties.max_batch_size, "MAX_BATCH_SIZE"),
         (properties.range_for_async_infer_requests, "RANGE_FOR_ASYNC_INFER_REQUESTS"),
+        (properties.tensor_memory_pool_statistics, "TENSOR_MEMORY_POOL_STATISTICS"),
         (properties.device.full_name, "FULL_DEVICE_NAME"),
         (properties.device.architecture, "DEVICE_ARCHITECTURE"),
         (properties.device.type, "DEVICE_TYPE"),
@@ -223,6 +224,8 @@ def test_properties_ro(ov_property_ro, expected_value):
         ),
         (properties.force_tbb_terminate, "FORCE_TBB_TERMINATE", ((True, True), (False, False))),
         (properties.enable_mmap, "ENABLE_MMAP", ((True, True), (False, False))),
+        (properties.enable_read_model_cache, "ENABLE_READ_MODEL_CACHE", ((True, True), (False, False))),
+        (properties.enable_tensor_memory_pool, "ENABLE_TENSOR_MEMORY_POOL", ((True, True), (False, False))),
         (properties.hint.inference_precision, "INFERENCE_PRECISION_HINT", ((Type.f32, Type.f32),)),
         (
             properties.hint.model_priority,
@@ -287,6 +290,21 @@ def test_properties_ro(ov_property_ro, expected_value):
                 (2.0, 2.0),
             ),
         ),
+        (
+            properties.intel_cpu.huge_pages,
+            "CPU_HUGE_PAGES",
+            ((True, True),),
+        ),
+        (
+            properties.intel_cpu.numa_memory_placement,
+            "CPU_NUMA_MEMORY_PLACEMENT",
+            ((True, True),),
+        ),
+        (
+            properties.intel_cpu.numa_sub_devices,
+            "CPU_NUMA_SUB_DEVICES",
+            ((True, True),),
+        ),
         (
             properties.intel_auto.device_bind_buffer,
             "DEVICE_BIND_BUFFER",
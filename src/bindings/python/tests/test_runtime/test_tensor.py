@@ -485,3 +485,59 @@ def test_copy_to(dtype, element_type):
 def test_is_continuous(element_type):
     tensor = ov.Tensor(shape=ov.Shape([3, 2, 2]), type=element_type)
     assert tensor.is_continuous()
+
+
+@pytest.mark.parametrize(("element_type", "dtype"), [
+    (ov.Type.f32, np.float32),
+    (ov.Type.f16, np.float16),
+    (ov.Type.i8, np.int8),
+    (ov.Type.u8, np.uint8),
+    (ov.Type.i64, np.int64),
+    (ov.Type.boolean, bool),
+])
+def test_array_interface_shares_memory(element_type, dtype):
+    tensor = ov.Tensor(shape=ov.Shape([3, 2, 2]), type=element_type)
+    array = np.asarray(tensor)
+    assert array.dtype == dtype
+    assert array.shape == (3, 2, 2)
+    array[:] = np.ones((3, 2, 2), dtype)
+    assert np.array_equal(tensor.data, np.ones((3, 2, 2), dtype))
+
+
+@pytest.mark.skipif(not hasattr(np, "from_dlpack"), reason="DLPack is not supported by numpy")
+@pytest.mark.parametrize(("element_type", "dtype"), [
+    (ov.Type.f32, np.float32),
+    (ov.Type.f64, np.float64),
+    (ov.Type.f16, np.float16),
+    (ov.Type.i8, np.int8),
+    (ov.Type.u8, np.uint8),
+    (ov.Type.i32, np.int32),
+    (ov.Type.u64, np.uint64),
+])
+def test_dlpack_roundtrip(element_type, dtype):
+    array = np.arange(12).astype(dtype).reshape(3, 2, 2)
+    tensor = ov.Tensor.from_dlpack(array)
+    assert tensor.element_type == element_type
+    assert tuple(tensor.shape) == array.shape
+    assert np.shares_memory(tensor.data, array)
+
+    exported = np.from_dlpack(tensor)
+    assert np.shares_memory(exported, array)
+    del array, tensor
+    assert np.array_equal(exported, np.arange(12).astype(dtype).reshape(3, 2, 2))
+
+
+@pytest.mark.skipif(not hasattr(np, "from_dlpack"), reason="DLPack is not supported by numpy")
+def test_dlpack_roi_tensor():
+    tensor = ov.Tensor(np.arange(24, dtype=np.float32).reshape(4, 6))
+    roi = ov.Tensor(tensor, [1, 2], [3, 5])
+    assert not roi.is_continuous()
+    exported = np.from_dlpack(roi)
+    assert np.array_equal(exported, np.arange(24, dtype=np.float32).reshape(4, 6)[1:3, 2:5])
+
+
+def test_dlpack_packed_tensor_is_not_exported():
+    tensor = ov.Tensor(ov.Type.u4, [2, 4])
+    with pytest.raises(RuntimeError) as e:
+        tensor.__dlpack__()
+    assert "can't be exported to DLPack" in str(e.value)
@@ -52,7 +52,8 @@ public:
 /**
  * @ingroup ie_transformation_common_api
  * @brief Disables ConstantFolding for Convert operation (just before MatMul operation only) and prevents conversion
- * of f16 Consts to f32.
+ * of f16 Consts to f32. Layout operations (Transpose, Reshape, Squeeze, Unsqueeze) between decompression Convert and
+ * MatMul are moved before the Convert and folded over compressed weights.
  */
 class ov::pass::KeepConstAndDecompressionForMatMul : public MatcherPass {
 public:
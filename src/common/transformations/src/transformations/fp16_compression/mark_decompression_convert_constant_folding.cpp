@@ -8,14 +8,69 @@
 #include "openvino/op/constant.hpp"
 #include "openvino/op/convert.hpp"
 #include "openvino/op/matmul.hpp"
+#include "openvino/op/reshape.hpp"
+#include "openvino/op/squeeze.hpp"
+#include "openvino/op/transpose.hpp"
+#include "openvino/op/unsqueeze.hpp"
 #include "openvino/pass/pattern/op/wrap_type.hpp"
 #include "transformations/rt_info/decompression.hpp"
 #include "transformations/rt_info/disable_constant_folding.hpp"
 #include "transformations/rt_info/is_shape_subgraph.hpp"
 #include "transformations/rt_info/keep_fp16_const.hpp"
+#include "transformations/utils/utils.hpp"
 
 using namespace ov;
 
+namespace {
+// Data movement operations don't depend on the element type, so they may be executed on compressed weights
+bool is_layout_only_op(const std::shared_ptr<Node>& node) {
+    if (!is_type<ov::op::v1::Transpose>(node) && !is_type<ov::op::v1::Reshape>(node) &&
+        !is_type<ov::op::v0::Squeeze>(node) && !is_type<ov::op::v0::Unsqueeze>(node))
+        return false;
+    for (size_t i = 1; i < node->get_input_size(); ++i) {
+        if (!is_type<ov::op::v0::Constant>(node->get_input_node_shared_ptr(i)))
+            return false;
+    }
+    return node->get_output_target_inputs(0).size() == 1;
+}
+
+// Moves decompression Convert from Convert -> {Transpose, Reshape, ...} -> MatMul chain closer to MatMul,
+// so layout operations are folded over compressed weights and the decompression is fused into the plugin weights
+// repacking instead of materializing decompressed weights copy for each operation in the chain.
+std::shared_ptr<Node> move_decompression_to_matmul(const Output<Node>& weights) {
+    std::vector<std::shared_ptr<Node>> layout_ops;
+    auto node = weights.get_node_shared_ptr();
+    while (is_layout_only_op(node)) {
+        layout_ops.push_back(node);
+        node = node->get_input_node_shared_ptr(0);
+    }
+
+    if (layout_ops.empty() || !is_type<ov::op::v0::Convert>(node) || !is_decompression(node) ||
+        node->get_output_target_inputs(0).size() != 1)
+        return nullptr;
+
+    const auto& convert = node;
+    auto compressed = convert->input_value(0);
+    for (auto it = layout_ops.rbegin(); it != layout_ops.rend(); ++it) {
+        auto inputs = (*it)->input_values();
+        inputs[0] = compressed;
+        auto new_op = ov::op::util::clone_try_fold(*it, inputs);
+        new_op->set_friendly_name((*it)->get_friendly_name());
+        copy_runtime_info(*it, new_op);
+        compressed = new_op;
+    }
+    compressed.get_node()->set_friendly_name(convert->get_friendly_name());
+
+    const auto& last_layout_op = layout_ops.front();
+    auto new_convert = convert->clone_with_new_inputs({compressed});
+    new_convert->set_friendly_name(last_layout_op->get_friendly_name());
+    copy_runtime_info({convert, last_layout_op}, new_convert);
+    mark_as_decompression(new_convert);
+    replace_node(last_layout_op, new_convert);
+    return new_convert;
+}
+}  // namespace
+
 pass::EnableDecompressionConvertConstantFolding::EnableDecompressionConvertConstantFolding() {
     MATCHER_SCOPE(EnableDecompressionConvertConstantFolding);
     auto convert = pattern::wrap_type<ov::op::v0::Convert>();
@@ -78,18 +133,22 @@ pass::KeepConstAndDecompressionForMatMul::KeepConstAndDecompressionForMatMul() {
     matcher_pass_callback callback = [=](pass::pattern::Matcher& m) {
         auto node = m.get_match_root();
 
+        auto inp_convert = move_decompression_to_matmul(node->input_value(1));
+        const bool rewritten = inp_convert != nullptr;
+        if (!rewritten)
+            inp_convert = node->input_value(1).get_node_shared_ptr();
+
         // input to matmul is decompression Convert
-        const auto& inp_convert = node->input_value(1).get_node_shared_ptr();
         if (!is_type<ov::op::v0::Convert>(inp_convert) || !is_decompression(inp_convert))
-            return false;
+            return rewritten;
 
         disable_constant_folding(inp_convert);
 
         if (!is_type<ov::op::v0::Constant>(inp_convert->input_value(0).get_node_shared_ptr()))
-            return false;
+            return rewritten;
         enable_keep_fp16_const(inp_convert->input_value(0).get_node_shared_ptr());
 
-        return false;
+        return rewritten;
     };
 
     auto m = std::make_shared<pass::pattern::Matcher>(matmul, matcher_name);
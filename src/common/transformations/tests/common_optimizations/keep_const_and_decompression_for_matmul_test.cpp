@@ -0,0 +1,75 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+#include "openvino/core/model.hpp"
+#include "openvino/opsets/opset10.hpp"
+#include "openvino/pass/manager.hpp"
+#include "transformations/fp16_compression/mark_decompression_convert_constant_folding.hpp"
+#include "transformations/init_node_info.hpp"
+#include "transformations/rt_info/decompression.hpp"
+#include "transformations/rt_info/disable_constant_folding.hpp"
+#include "transformations/rt_info/keep_fp16_const.hpp"
+
+using namespace testing;
+
+TEST(TransformationTests, KeepConstAndDecompressionForMatMul) {
+    auto input = std::make_shared<ov::opset10::Parameter>(ov::element::f32, ov::Shape{1, 2});
+    auto weights = ov::opset10::Constant::create(ov::element::f16, ov::Shape{2, 3}, {1, 2, 3, 4, 5, 6});
+    auto convert = std::make_shared<ov::opset10::Convert>(weights, ov::element::f32);
+    ov::mark_as_decompression(convert);
+    auto matmul = std::make_shared<ov::opset10::MatMul>(input, convert);
+    auto model = std::make_shared<ov::Model>(ov::NodeVector{matmul}, ov::ParameterVector{input});
+
+    ov::pass::Manager manager;
+    manager.register_pass<ov::pass::InitNodeInfo>();
+    manager.register_pass<ov::pass::KeepConstAndDecompressionForMatMul>();
+    manager.run_passes(model);
+    ASSERT_NO_THROW(check_rt_info(model));
+
+    EXPECT_TRUE(ov::pass::constant_folding_is_disabled(convert));
+    EXPECT_TRUE(ov::is_keep_fp16_const(weights));
+}
+
+TEST(TransformationTests, KeepConstAndDecompressionForMatMulThroughLayoutOps) {
+    std::shared_ptr<ov::Model> model(nullptr), model_ref(nullptr);
+    {
+        auto input = std::make_shared<ov::opset10::Parameter>(ov::element::f32, ov::Shape{1, 3});
+        auto weights = ov::opset10::Constant::create(ov::element::f16, ov::Shape{1, 2, 3}, {1, 2, 3, 4, 5, 6});
+        auto convert = std::make_shared<ov::opset10::Convert>(weights, ov::element::f32);
+        ov::mark_as_decompression(convert);
+        auto squeeze_axis = ov::opset10::Constant::create(ov::element::i64, ov::Shape{1}, {0});
+        auto squeeze = std::make_shared<ov::opset10::Squeeze>(convert, squeeze_axis);
+        auto order = ov::opset10::Constant::create(ov::element::i64, ov::Shape{2}, {1, 0});
+        auto transpose = std::make_shared<ov::opset10::Transpose>(squeeze, order);
+        auto matmul = std::make_shared<ov::opset10::MatMul>(input, transpose);
+        model = std::make_shared<ov::Model>(ov::NodeVector{matmul}, ov::ParameterVector{input});
+
+        ov::pass::Manager manager;
+        manager.register_pass<ov::pass::InitNodeInfo>();
+        manager.register_pass<ov::pass::KeepConstAndDecompressionForMatMul>();
+        manager.run_passes(model);
+        ASSERT_NO_THROW(check_rt_info(model));
+    }
+    {
+        auto input = std::make_shared<ov::opset10::Parameter>(ov::element::f32, ov::Shape{1, 3});
+        auto weights = ov::opset10::Constant::create(ov::element::f16, ov::Shape{3, 2}, {1, 4, 2, 5, 3, 6});
+        auto convert = std::make_shared<ov::opset10::Convert>(weights, ov::element::f32);
+        auto matmul = std::make_shared<ov::opset10::MatMul>(input, convert);
+        model_ref = std::make_shared<ov::Model>(ov::NodeVector{matmul}, ov::ParameterVector{input});
+    }
+
+    auto res = compare_functions(model, model_ref, true);
+    ASSERT_TRUE(res.first) << res.second;
+
+    auto convert = model->get_results()[0]->get_input_node_shared_ptr(0)->get_input_node_shared_ptr(1);
+    ASSERT_TRUE(ov::is_type<ov::opset10::Convert>(convert));
+    EXPECT_TRUE(ov::is_decompression(convert));
+    EXPECT_TRUE(ov::pass::constant_folding_is_disabled(convert));
+    EXPECT_TRUE(ov::is_keep_fp16_const(convert->get_input_node_shared_ptr(0)));
+}
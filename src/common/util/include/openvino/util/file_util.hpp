@@ -237,6 +237,13 @@ void convert_path_win_style(std::string& path);
 
 std::string get_ov_lib_path();
 
+/**
+ * @brief Returns path to the shared library or executable which contains the given address
+ * @param address - address of a function or an object in the module
+ * @return path to the module or empty string if it can't be found
+ */
+std::string get_module_path(const void* address);
+
 #ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
 
 using FilePath = std::wstring;
@@ -475,6 +475,28 @@ std::string ov::util::get_ov_lib_path() {
 #endif
 }
 
+std::string ov::util::get_module_path(const void* address) {
+#ifdef _WIN32
+    CHAR module_path[MAX_PATH];
+    HMODULE hm = NULL;
+    if (!GetModuleHandleExA(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS | GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT,
+                            reinterpret_cast<LPCSTR>(address),
+                            &hm)) {
+        return {};
+    }
+    const auto size = GetModuleFileNameA(hm, module_path, sizeof(module_path));
+    return std::string(module_path, size);
+#elif defined(__APPLE__) || defined(__linux__) || defined(__EMSCRIPTEN__)
+    Dl_info info;
+    if (dladdr(address, &info) == 0 || info.dli_fname == nullptr) {
+        return {};
+    }
+    return info.dli_fname;
+#else
+#    error "Unsupported OS"
+#endif  // _WIN32
+}
+
 #ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
 
 std::wstring ov::util::get_ov_lib_path_w() {
@@ -0,0 +1,52 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+
+#include "openvino/core/core_visibility.hpp"
+
+namespace ov {
+namespace util {
+
+/**
+ * @brief Counters of the process-wide host memory pool used by default ov::Allocator
+ */
+struct MemoryPoolStatistics {
+    size_t bytes_cached = 0;  //!< Bytes of free blocks kept by the pool and thread caches
+    size_t allocations = 0;   //!< Number of allocations served by the pool
+    size_t hits = 0;          //!< Number of allocations served from cached blocks
+};
+
+/**
+ * @brief Switches default ov::Allocator between plain heap allocations and the pooling allocator.
+ *
+ * The pooling allocator keeps freed blocks in size classes (thread caches backed by the global pool) and reuses them
+ * for subsequent allocations of the same class. Large blocks are advised to be backed by transparent huge pages.
+ * Allocators created before the switch keep working with the memory they allocated.
+ *
+ * @param enable true to make newly created default allocators use the pool
+ */
+OPENVINO_API void set_memory_pool_enabled(bool enable);
+
+/**
+ * @brief Checks whether default ov::Allocator uses the pooling allocator
+ */
+OPENVINO_API bool is_memory_pool_enabled();
+
+/**
+ * @brief Returns current counters of the pooling allocator
+ */
+OPENVINO_API MemoryPoolStatistics get_memory_pool_statistics();
+
+/**
+ * @brief Frees blocks cached in the global pool and in the cache of the calling thread.
+ *
+ * Caches of other threads are returned to the global pool when those threads exit.
+ */
+OPENVINO_API void release_memory_pool();
+
+}  // namespace util
+}  // namespace ov
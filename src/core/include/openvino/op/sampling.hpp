@@ -0,0 +1,122 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <mutex>
+
+#include "openvino/op/op.hpp"
+
+namespace ov {
+namespace op {
+namespace v13 {
+/// \brief Sampling operation selects the next token ids from the logits.
+///
+/// The logits of each row are scaled by 1 / temperature and normalized by Softmax. The candidates are restricted
+/// to the top_k most probable tokens (0 - no restriction) and then to the smallest prefix of them with the cumulative
+/// probability not less than top_p (1 - no restriction). The token id is drawn from the renormalized probabilities
+/// of the candidates by a uniform random number generated the way RandomUniform with the same seeds does.
+///
+/// \ingroup ov_ops_cpp_api
+class OPENVINO_API Sampling : public Op {
+public:
+    OPENVINO_OP("Sampling", "opset13");
+
+    Sampling() = default;
+
+    /// \brief      Constructs a Sampling operation.
+    ///
+    /// \param      logits            Node producing the logits of shape [batch, vocabulary].
+    /// \param      temperature       Positive value the logits are divided by before Softmax.
+    /// \param      top_k             Number of the most probable tokens to sample from, 0 - all tokens.
+    /// \param      top_p             Cumulative probability of the tokens to sample from, in (0, 1].
+    /// \param      out_type          Output type of the token ids, i32 or i64.
+    /// \param      global_seed       Global seed value.
+    /// \param      op_seed           Operational seed value.
+    Sampling(const Output<Node>& logits,
+             float temperature = 1.0f,
+             int64_t top_k = 0,
+             float top_p = 1.0f,
+             const ov::element::Type& out_type = ov::element::i64,
+             uint64_t global_seed = 0,
+             uint64_t op_seed = 0);
+
+    void validate_and_infer_types() override;
+
+    bool visit_attributes(AttributeVisitor& visitor) override;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& new_args) const override;
+
+    /// \return Turns off constant folding for Sampling operation.
+    bool constant_fold(OutputVector& output_values, const OutputVector& inputs_values) override {
+        return false;
+    }
+
+    float get_temperature() const {
+        return m_temperature;
+    }
+    void set_temperature(float temperature) {
+        m_temperature = temperature;
+    }
+
+    int64_t get_top_k() const {
+        return m_top_k;
+    }
+    void set_top_k(int64_t top_k) {
+        m_top_k = top_k;
+    }
+
+    float get_top_p() const {
+        return m_top_p;
+    }
+    void set_top_p(float top_p) {
+        m_top_p = top_p;
+    }
+
+    /// \return The output tensor type.
+    const ov::element::Type& get_out_type() const {
+        return m_output_type;
+    }
+    void set_out_type(const ov::element::Type& output_type) {
+        m_output_type = output_type;
+    }
+
+    /// \return The global seed value.
+    uint64_t get_global_seed() const {
+        return m_global_seed;
+    }
+    void set_global_seed(uint64_t seed) {
+        m_global_seed = seed;
+    }
+
+    /// \return The operational seed value.
+    uint64_t get_op_seed() const {
+        return m_op_seed;
+    }
+    void set_op_seed(uint64_t seed2) {
+        m_op_seed = seed2;
+    }
+
+    /// \return The state value of the random number generator.
+    std::pair<uint64_t, uint64_t> get_state() const {
+        return m_state;
+    }
+
+    bool evaluate(TensorVector& outputs, const TensorVector& inputs) const override;
+    bool has_evaluate() const override;
+
+protected:
+    float m_temperature = 1.0f;
+    int64_t m_top_k = 0;
+    float m_top_p = 1.0f;
+    ov::element::Type m_output_type = ov::element::i64;
+    uint64_t m_global_seed = 0;
+    uint64_t m_op_seed = 0;
+
+    mutable std::mutex m_state_mutex;
+    mutable std::pair<uint64_t, uint64_t> m_state;
+};
+}  // namespace v13
+}  // namespace op
+}  // namespace ov
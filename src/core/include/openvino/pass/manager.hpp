@@ -4,9 +4,12 @@
 
 #pragma once
 
+#include <chrono>
 #include <list>
 #include <memory>
+#include <string>
 #include <typeinfo>
+#include <utility>
 #include <vector>
 
 #include "openvino/pass/pass.hpp"
@@ -76,6 +79,20 @@ public:
     /// \param new_state Value "true" enables Validate pass run; "false", otherwise
     void set_per_pass_validation(bool new_state);
 
+    /// \brief Set flag to enable/disable collecting of execution time for each pass
+    /// executed by run_passes. Collecting is also enabled by OV_PROFILE_PASS_ENABLE
+    /// environment variable, which additionally prints the results to stdout.
+    /// \param new_state Value "true" enables collecting; "false", otherwise
+    void set_pass_profiling(bool new_state) {
+        m_profile_passes = new_state;
+    }
+
+    /// \return Names and execution times of the passes executed by the last run_passes call.
+    /// The list is empty unless profiling is enabled by set_pass_profiling.
+    const std::vector<std::pair<std::string, std::chrono::microseconds>>& get_pass_profiling_results() const {
+        return m_pass_profiling_results;
+    }
+
     /// \return PassConfig shared object. This object is used for transformations pipeline
     /// configuration.
     /// This object allows to disable/enable transformations execution, set callback to
@@ -99,6 +116,8 @@ protected:
     std::vector<std::shared_ptr<PassBase>> m_pass_list;
     bool m_visualize = false;
     bool m_per_pass_validation = true;
+    bool m_profile_passes = false;
+    std::vector<std::pair<std::string, std::chrono::microseconds>> m_pass_profiling_results;
 };
 }  // namespace pass
 }  // namespace ov
@@ -10,6 +10,7 @@
 
 #include "ngraph/coordinate_transform.hpp"
 #include "ngraph/op/util/attr_types.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph {
@@ -65,6 +66,16 @@ inline void numpy_autobroadcast_binop(const T* arg0,
     }
 }
 
+/// \brief Applies the functor to the elements of the inputs of the same shape, the elements are split
+///        between the threads.
+template <typename T, typename U, typename Functor>
+void elementwise_binop(const T* arg0, const T* arg1, U* out, const size_t count, Functor& elementwise_functor) {
+    parallel_for_range(count, 1 << 14, [&](size_t start, size_t end) {
+        for (size_t i = start; i < end; ++i)
+            out[i] = static_cast<U>(elementwise_functor(arg0[i], arg1[i]));
+    });
+}
+
 inline size_t calculate_fixed_axis(size_t axis, const size_t* strides) {
     while (axis > 0 && strides[axis - 1] == 1)
         --axis;
@@ -99,9 +110,7 @@ void autobroadcast_binop(const T* arg0,
                          Functor elementwise_functor) {
     switch (broadcast_spec.m_type) {
     case op::AutoBroadcastType::NONE:
-        for (size_t i = 0; i < shape_size(arg0_shape); i++) {
-            out[i] = static_cast<U>(elementwise_functor(arg0[i], arg1[i]));
-        }
+        internal::elementwise_binop(arg0, arg1, out, shape_size(arg0_shape), elementwise_functor);
         break;
     case op::AutoBroadcastType::NUMPY:
         // We'll be using CoordinateTransform to handle the broadcasting. The general
@@ -157,8 +166,7 @@ void autobroadcast_binop(const T* arg0,
             }
 
             if (axis == 0) {
-                for (size_t i = 0, end = strides0[0]; i < end; ++i)
-                    out[i] = elementwise_functor(arg0[i], arg1[i]);
+                elementwise_binop(arg0, arg1, out, strides0[0], elementwise_functor);
             } else if (strides0[axis] == 1 && value_with_padding_or(arg0_shape, padding0, axis, 1) == 1) {
                 axis = calculate_fixed_axis(axis, strides0);
 
@@ -4,14 +4,17 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cfenv>
 #include <cmath>
+#include <iterator>
 #include <numeric>
 #include <stdexcept>
 #include <vector>
 
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "ngraph/shape.hpp"
 
 namespace ngraph {
@@ -106,12 +109,8 @@ void avg_pool(const T* arg,
               const Shape& padding_above,
               bool include_padding_in_avg_computation) {
     NGRAPH_SUPPRESS_DEPRECATED_START
-    auto old_mode = std::fegetround();
-    std::fesetround(FE_TONEAREST);
     // At the outermost level we will walk over every output coordinate O.
-    CoordinateTransform output_transform(out_shape);
-
-    for (const Coordinate& out_coord : output_transform) {
+    auto pool_element = [&](const Coordinate& out_coord, const size_t out_index) {
         // Our output coordinate O will have the form:
         //
         //   (N,chan,i_1,...,i_n)
@@ -217,17 +216,44 @@ void avg_pool(const T* arg,
 
         if (n_elements != 0) {
             if (std::is_same<T, int8_t>::value || std::is_same<T, uint8_t>::value) {
-                out[output_transform.index(out_coord)] =
+                out[out_index] =
                     static_cast<T>(std::nearbyint(static_cast<float>(result) / n_elements));
             } else {
-                out[output_transform.index(out_coord)] = result / static_cast<T>(n_elements);
+                out[out_index] = result / static_cast<T>(n_elements);
             }
         } else {
-            out[output_transform.index(out_coord)] = T{0};
+            out[out_index] = T{0};
         }
+    };
 
-        std::fesetround(old_mode);
+    // The planes of the output are split between the threads, each thread walks over the coordinates of
+    // its planes in the row major order
+    if (shape_size(out_shape) == 0) {
+        return;
     }
+    const size_t channels = out_shape[1];
+    const size_t plane_size = shape_size(std::next(out_shape.begin(), 2), out_shape.end());
+    parallel_for_range(out_shape[0] * channels, 1, [&](size_t start, size_t end) {
+        // the rounding mode is set for the thread
+        const auto old_mode = std::fegetround();
+        std::fesetround(FE_TONEAREST);
+        Coordinate out_coord(out_shape.size(), 0);
+        for (size_t plane = start; plane < end; plane++) {
+            out_coord[0] = plane / channels;
+            out_coord[1] = plane % channels;
+            std::fill(std::next(out_coord.begin(), 2), out_coord.end(), 0);
+            for (size_t i = 0; i < plane_size; i++) {
+                pool_element(out_coord, plane * plane_size + i);
+                for (size_t axis = out_shape.size() - 1; axis > 1; axis--) {
+                    if (++out_coord[axis] < out_shape[axis]) {
+                        break;
+                    }
+                    out_coord[axis] = 0;
+                }
+            }
+        }
+        std::fesetround(old_mode);
+    });
     NGRAPH_SUPPRESS_DEPRECATED_END
 }
 }  // namespace reference
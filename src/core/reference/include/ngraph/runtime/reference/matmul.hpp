@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 #include <numeric>
 #include <utility>
@@ -11,6 +12,7 @@
 
 #include "ngraph/runtime/opt_kernel/reshape.hpp"
 #include "ngraph/runtime/reference/broadcast.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph {
@@ -18,13 +20,44 @@ namespace runtime {
 namespace reference {
 namespace details {
 template <typename T>
+void dot_rows(const T* arg0,
+              const T* arg1,
+              T* out,
+              const size_t K_dim,
+              const size_t J_dim,
+              const size_t row_begin,
+              const size_t row_end) {
+    std::fill(out + row_begin * J_dim, out + row_end * J_dim, T{0});
+    // The columns of arg1 are processed in blocks small enough to stay in cache while all the rows are
+    // multiplied by them. Each output element is still accumulated over the whole K in the ascending order.
+    constexpr size_t block_bytes = 1 << 16;
+    const size_t j_block = std::max<size_t>(16, block_bytes / (sizeof(T) * std::max<size_t>(K_dim, 1)));
+    for (size_t j_begin = 0; j_begin < J_dim; j_begin += j_block) {
+        const size_t j_end = std::min(J_dim, j_begin + j_block);
+        for (size_t i = row_begin; i < row_end; ++i) {
+            for (size_t k = 0; k < K_dim; ++k) {
+                const size_t a_idx = i * K_dim + k;
+                for (size_t j = j_begin; j < j_end; ++j) {
+                    const size_t b_idx = k * J_dim + j;
+                    const size_t out_idx = i * J_dim + j;
+                    out[out_idx] += arg0[a_idx] * arg1[b_idx];
+                }
+            }
+        }
+    }
+}
+
+/// \brief Computes batch_size dot products, the rows of all batches are distributed between the threads.
+template <typename T>
 void dot(const T* arg0,
          const T* arg1,
          T* out,
          const Shape& arg0_shape,
          const Shape& arg1_shape,
-         const Shape& out_shape) {
-    std::fill(out, out + shape_size(out_shape), T{0});
+         const size_t batch_size,
+         const size_t arg0_offset,
+         const size_t arg1_offset,
+         const size_t out_offset) {
     const size_t arg0_rank = arg0_shape.size();
     const size_t arg1_rank = arg1_shape.size();
 
@@ -34,17 +67,37 @@ void dot(const T* arg0,
     const size_t I_dim = arg0_rank == 1 ? 1 : arg0_shape[arg0_rank - 2];
     const size_t J_dim = arg1_rank == 1 ? 1 : arg1_shape[arg1_rank - 1];
     const size_t K_dim = arg1_rank == 1 ? arg1_shape[arg1_rank - 1] : arg1_shape[arg1_rank - 2];
+    if (I_dim == 0) {
+        return;
+    }
 
-    for (size_t i = 0; i < I_dim; ++i) {
-        for (size_t k = 0; k < K_dim; ++k) {
-            const size_t a_idx = i * K_dim + k;
-            for (size_t j = 0; j < J_dim; ++j) {
-                const size_t b_idx = k * J_dim + j;
-                const size_t out_idx = i * J_dim + j;
-                out[out_idx] += arg0[a_idx] * arg1[b_idx];
-            }
+    // each thread computes whole rows, so the order of accumulation doesn't depend on the number of threads
+    const size_t min_rows = std::max<size_t>(1, (1 << 15) / std::max<size_t>(K_dim * J_dim, 1));
+    parallel_for_range(batch_size * I_dim, min_rows, [&](size_t start, size_t end) {
+        while (start < end) {
+            const size_t batch = start / I_dim;
+            const size_t row = start % I_dim;
+            const size_t rows = std::min(end - start, I_dim - row);
+            dot_rows(arg0 + batch * arg0_offset,
+                     arg1 + batch * arg1_offset,
+                     out + batch * out_offset,
+                     K_dim,
+                     J_dim,
+                     row,
+                     row + rows);
+            start += rows;
         }
-    }
+    });
+}
+
+template <typename T>
+void dot(const T* arg0,
+         const T* arg1,
+         T* out,
+         const Shape& arg0_shape,
+         const Shape& arg1_shape,
+         const Shape& out_shape) {
+    dot(arg0, arg1, out, arg0_shape, arg1_shape, 1, 0, 0, shape_size(out_shape));
 }
 
 std::vector<size_t> get_transpose_order(const Shape& input_shape);
@@ -208,14 +261,15 @@ void matmul(const T* arg0,
     const size_t arg0_offset = (arg0_rank > 2) ? shape_size(dot_arg0_shape) : 0;
     const size_t arg1_offset = (arg1_rank > 2) ? shape_size(dot_arg1_shape) : 0;
     const size_t output_offset = shape_size(dot_output_shape);
-    for (size_t i = 0; i < output_batch_size; i++) {
-        details::dot(arg0_data + i * arg0_offset,
-                     arg1_data + i * arg1_offset,
-                     out + i * output_offset,
-                     dot_arg0_shape,
-                     dot_arg1_shape,
-                     dot_output_shape);
-    }
+    details::dot(arg0_data,
+                 arg1_data,
+                 out,
+                 dot_arg0_shape,
+                 dot_arg1_shape,
+                 output_batch_size,
+                 arg0_offset,
+                 arg1_offset,
+                 output_offset);
 }
 }  // namespace reference
 }  // namespace runtime
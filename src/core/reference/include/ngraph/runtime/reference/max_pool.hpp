@@ -5,9 +5,11 @@
 #pragma once
 
 #include <cmath>
+#include <limits>
 #include <numeric>
 
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 
 namespace ngraph {
 namespace runtime {
@@ -341,10 +343,14 @@ void max_pool(const Values_t* data,
     const auto out_batch_elems = shape_size(std::begin(out_shape) + 1, std::end(out_shape));
     const auto out_channel_elems = shape_size(std::begin(out_shape) + 2, std::end(out_shape));
 
-    for (size_t b = 0; b < data_shape[0]; ++b) {
-        const Indices_t batch_indices_offset = static_cast<Indices_t>(b * data_batch_elems);
+    // the channels are independent, they are split between the threads
+    const size_t channels = data_shape[1];
+    parallel_for_range(data_shape[0] * channels, 1, [&](size_t start, size_t end) {
+        for (size_t bc = start; bc < end; ++bc) {
+            const size_t b = bc / channels;
+            const size_t c = bc % channels;
+            const Indices_t batch_indices_offset = static_cast<Indices_t>(b * data_batch_elems);
 
-        for (size_t c = 0; c < data_shape[1]; ++c) {
             // calculate the buffer offsets for a given channel "c" then execute an appropriate
             // kernel for each processed channel
             const Values_t* data_channel_first_elem = data + b * data_batch_elems + c * data_channel_elems;
@@ -397,7 +403,7 @@ void max_pool(const Values_t* data,
                              " passed to the MaxPool reference implementation. Supported shapes: 3D, 4D and 5D.");
             }
         }
-    }
+    });
 
     // adjust the calculated indices to the requested range (specified by the axis attribute) if needed
     if (axis != 0) {
@@ -8,6 +8,7 @@
 #include <numeric>
 
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/utils/reduction.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph {
@@ -20,20 +21,9 @@ void product(const T* arg, T* out, const Shape& in_shape, const AxisSet& reducti
     const auto out_shape = reduce(in_shape, reduction_axes, dont_keep_dims_in_output);
     std::fill(out, out + shape_size(out_shape), T(1));
 
-    const auto in_strides = row_major_strides(in_shape);
-    const auto out_strides = row_major_strides(out_shape);
-
-    CoordinateTransformBasic input_transform(in_shape);
-    for (const Coordinate& input_coord : input_transform) {
-        const Coordinate output_coord = reduce(input_coord, reduction_axes, dont_keep_dims_in_output);
-
-        const size_t in_idx =
-            std::inner_product(input_coord.begin(), input_coord.end(), in_strides.begin(), uint64_t(0));
-        const size_t out_idx =
-            std::inner_product(output_coord.begin(), output_coord.end(), out_strides.begin(), uint64_t(0));
-
+    reduce_elements(in_shape, reduction_axes, [&](const size_t in_idx, const size_t out_idx) {
         out[out_idx] = out[out_idx] * arg[in_idx];
-    }
+    });
     OPENVINO_SUPPRESS_DEPRECATED_END
 }
 }  // namespace reference
@@ -0,0 +1,106 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <vector>
+
+#include "ngraph/shape.hpp"
+
+namespace ngraph {
+namespace runtime {
+namespace reference {
+namespace sampling_detail {
+// the better token goes first, the equal logits are ordered by the index
+template <typename T>
+struct greater_logit {
+    const T* logits;
+    bool operator()(size_t a, size_t b) const {
+        const float va = static_cast<float>(logits[a]);
+        const float vb = static_cast<float>(logits[b]);
+        return va > vb || (va == vb && a < b);
+    }
+};
+}  // namespace sampling_detail
+
+/// \brief Draws a token id of each row of the logits.
+///
+/// The probabilities are exp((logit - max) / temperature), accumulated in float:
+///  - the candidates are the top_k best tokens sorted by the logit, or all tokens in the index order if top_k is 0
+///    or not less than the vocabulary size, the total of all tokens is accumulated in the index order as well;
+///  - if top_p < 1 the candidates sorted by the logit are cut after the first one the cumulative probability of which
+///    reaches top_p of the candidates total;
+///  - the token is the first candidate the cumulative probability of which exceeds uniform * total of the candidates,
+///    the last candidate if rounding leaves none.
+///
+/// \param logits       Logits of shape [batch, vocabulary].
+/// \param out          Token ids of shape [batch, 1].
+/// \param uniforms     Uniform random numbers in [0, 1), one per row.
+template <typename T, typename U>
+void sampling(const T* logits,
+              U* out,
+              const float* uniforms,
+              const Shape& logits_shape,
+              float temperature,
+              int64_t top_k,
+              float top_p) {
+    const size_t batch = logits_shape[0];
+    const size_t vocab = logits_shape[1];
+    const bool restrict_k = top_k > 0 && static_cast<size_t>(top_k) < vocab;
+    const bool sorted = restrict_k || top_p < 1.0f;
+    const size_t candidates_count = restrict_k ? static_cast<size_t>(top_k) : vocab;
+
+    std::vector<float> probs(vocab);
+    std::vector<size_t> candidates(vocab);
+    for (size_t b = 0; b < batch; b++) {
+        const T* row = logits + b * vocab;
+        float max_logit = static_cast<float>(row[0]);
+        for (size_t i = 1; i < vocab; i++)
+            max_logit = std::max(max_logit, static_cast<float>(row[i]));
+        for (size_t i = 0; i < vocab; i++)
+            probs[i] = std::exp((static_cast<float>(row[i]) - max_logit) / temperature);
+
+        std::iota(candidates.begin(), candidates.end(), 0);
+        if (sorted) {
+            std::partial_sort(candidates.begin(),
+                              candidates.begin() + candidates_count,
+                              candidates.end(),
+                              sampling_detail::greater_logit<T>{row});
+        }
+
+        float total = 0.0f;
+        for (size_t k = 0; k < candidates_count; k++)
+            total += probs[restrict_k ? candidates[k] : k];
+
+        size_t kept = candidates_count;
+        if (top_p < 1.0f) {
+            const float threshold = top_p * total;
+            float cumulative = 0.0f;
+            for (kept = 0; kept < candidates_count;) {
+                cumulative += probs[candidates[kept++]];
+                if (cumulative >= threshold)
+                    break;
+            }
+            total = cumulative;
+        }
+
+        const float target = uniforms[b] * total;
+        float cumulative = 0.0f;
+        size_t token = candidates[kept - 1];
+        for (size_t k = 0; k < kept; k++) {
+            cumulative += probs[candidates[k]];
+            if (cumulative > target) {
+                token = candidates[k];
+                break;
+            }
+        }
+        out[b] = static_cast<U>(token);
+    }
+}
+}  // namespace reference
+}  // namespace runtime
+}  // namespace ngraph
@@ -88,7 +88,7 @@ template <typename T>
 T reduction_neutral_value(const Reduction reduction_type) {
     switch (reduction_type) {
     case Reduction::MAX:
-        return std::numeric_limits<T>::min();
+        return std::numeric_limits<T>::lowest();
     case Reduction::MIN:
         return std::numeric_limits<T>::max();
     case Reduction::PROD:
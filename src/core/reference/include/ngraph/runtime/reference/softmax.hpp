@@ -9,6 +9,7 @@
 #include "ngraph/coordinate_transform.hpp"
 #include "ngraph/runtime/reference/max.hpp"
 #include "ngraph/runtime/reference/sum.hpp"
+#include "ngraph/runtime/reference/utils/reduction.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph {
@@ -23,20 +24,16 @@ void softmax(const T* arg, T* out, const Shape& shape, const AxisSet& axes) {
 
     max(arg, temp_ptr, shape, axes);
 
-    CoordinateTransform transform(shape);
-    CoordinateTransform temp_transform(temp_shape);
-    for (const Coordinate& coord : transform) {
-        Coordinate temp_coord = reduce(coord, axes, true);
-        out[transform.index(coord)] =
-            std::exp(arg[transform.index(coord)] - temp_ptr[temp_transform.index(temp_coord)]);
-    }
+    // the index of the reduced element in the shape with kept dimensions is the same as without them
+    reduce_elements(shape, axes, [&](const size_t in_idx, const size_t temp_idx) {
+        out[in_idx] = std::exp(arg[in_idx] - temp_ptr[temp_idx]);
+    });
 
     sum(out, temp_ptr, shape, axes);
 
-    for (const Coordinate& coord : transform) {
-        Coordinate temp_coord = reduce(coord, axes, true);
-        out[transform.index(coord)] /= temp_ptr[temp_transform.index(temp_coord)];
-    }
+    reduce_elements(shape, axes, [&](const size_t in_idx, const size_t temp_idx) {
+        out[in_idx] /= temp_ptr[temp_idx];
+    });
 
     delete[] temp_ptr;
     NGRAPH_SUPPRESS_DEPRECATED_END
@@ -0,0 +1,27 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace ngraph {
+namespace runtime {
+namespace reference {
+/// \brief Splits [0, work) into contiguous ranges and calls func(start, end) once per non empty range
+///        on the threads of the current arena.
+///
+/// The threading library is hidden behind the library boundary, so the templated kernels can use it
+/// without the threading configuration of the caller. Every item is processed by exactly one thread
+/// in the same order as in the serial loop, so the results don't depend on the number of threads.
+/// An exception thrown by \p func is rethrown in the calling thread once all the ranges are done.
+///
+/// \param work Number of items.
+/// \param min_work Minimal number of items per thread, less work is executed in the calling thread.
+/// \param func Callable processing the items [start, end).
+void parallel_for_range(size_t work, size_t min_work, const std::function<void(size_t, size_t)>& func);
+}  // namespace reference
+}  // namespace runtime
+}  // namespace ngraph
@@ -0,0 +1,79 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <vector>
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph {
+namespace runtime {
+namespace reference {
+/// \brief Calls func(in_idx, out_idx) for every element of the input, where out_idx is the index of the element
+///        of the output the input element is reduced to.
+///
+/// The elements reduced to the same output element are visited in the ascending order of their input indices,
+/// as by a serial walk over the input. Leading axes which aren't reduced are split between the threads, they map
+/// to disjoint parts of the output, so order dependent reductions (e.g. Kahan summation) give the same results.
+///
+/// \param in_shape Shape of the input.
+/// \param reduction_axes Reduced axes.
+/// \param func Callable accumulating the input element into the output element.
+template <typename F>
+void reduce_elements(const Shape& in_shape, const AxisSet& reduction_axes, const F& func) {
+    const size_t rank = in_shape.size();
+    if (std::find(in_shape.begin(), in_shape.end(), size_t{0}) != in_shape.end()) {
+        return;
+    }
+
+    size_t outer_rank = 0;
+    while (outer_rank < rank && reduction_axes.count(outer_rank) == 0) {
+        ++outer_rank;
+    }
+    const size_t outer_size =
+        std::accumulate(in_shape.begin(), in_shape.begin() + outer_rank, size_t{1}, std::multiplies<size_t>());
+    const size_t inner_size =
+        std::accumulate(in_shape.begin() + outer_rank, in_shape.end(), size_t{1}, std::multiplies<size_t>());
+
+    // strides of the output along the inner axes of the input, 0 for the reduced axes
+    std::vector<size_t> out_strides(rank, 0);
+    size_t out_inner_size = 1;
+    for (size_t axis = rank; axis > outer_rank; --axis) {
+        if (reduction_axes.count(axis - 1) == 0) {
+            out_strides[axis - 1] = out_inner_size;
+            out_inner_size *= in_shape[axis - 1];
+        }
+    }
+
+    const size_t min_outer = std::max<size_t>(1, (1 << 14) / inner_size);
+    parallel_for_range(outer_size, min_outer, [&](size_t start, size_t end) {
+        std::vector<size_t> counters(rank, 0);
+        for (size_t outer = start; outer < end; ++outer) {
+            const size_t in_offset = outer * inner_size;
+            const size_t out_offset = outer * out_inner_size;
+            size_t out_inner = 0;
+            for (size_t inner = 0; inner < inner_size; ++inner) {
+                func(in_offset + inner, out_offset + out_inner);
+                for (size_t axis = rank; axis > outer_rank; --axis) {
+                    auto& counter = counters[axis - 1];
+                    out_inner += out_strides[axis - 1];
+                    if (++counter < in_shape[axis - 1]) {
+                        break;
+                    }
+                    out_inner -= out_strides[axis - 1] * counter;
+                    counter = 0;
+                }
+            }
+        }
+    });
+}
+}  // namespace reference
+}  // namespace runtime
+}  // namespace ngraph
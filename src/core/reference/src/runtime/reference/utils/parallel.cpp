@@ -0,0 +1,50 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph/runtime/reference/utils/parallel.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <mutex>
+
+#include "openvino/core/parallel.hpp"
+
+namespace ngraph {
+namespace runtime {
+namespace reference {
+void parallel_for_range(size_t work, size_t min_work, const std::function<void(size_t, size_t)>& func) {
+    if (work == 0) {
+        return;
+    }
+    const size_t chunk = std::max<size_t>(min_work, 1);
+    const size_t max_chunks = (work + chunk - 1) / chunk;
+    const auto nthr = static_cast<int>(std::min<size_t>(std::max(parallel_get_max_threads(), 1), max_chunks));
+    if (nthr <= 1) {
+        func(0, work);
+        return;
+    }
+    // exceptions can't leave the threads of the arena, the first one is rethrown in the calling thread
+    std::exception_ptr exception;
+    std::mutex exception_mutex;
+    ov::parallel_nt_static(nthr, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        ov::splitter(work, nthr, ithr, start, end);
+        if (start < end) {
+            try {
+                func(start, end);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(exception_mutex);
+                if (!exception) {
+                    exception = std::current_exception();
+                }
+            }
+        }
+    });
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+}
+}  // namespace reference
+}  // namespace runtime
+}  // namespace ngraph
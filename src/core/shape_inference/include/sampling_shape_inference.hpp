@@ -0,0 +1,48 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+
+#include "openvino/op/sampling.hpp"
+#include "utils.hpp"
+
+namespace ov {
+namespace op {
+namespace v13 {
+/**
+ * \brief Sampling v13 shape inference compute output shapes.
+ *
+ * \tparam TShape  Type of shape.
+ *
+ * \param op             Pointer to Sampling operator.
+ * \param input_shapes   Input shapes of Sampling.
+ * \return               Vector with output shapes, [batch, 1].
+ */
+template <class TShape, class TRShape = result_shape_t<TShape>>
+std::vector<TRShape> shape_infer(const Sampling* op, const std::vector<TShape>& input_shapes) {
+    NODE_VALIDATION_CHECK(op, input_shapes.size() == 1);
+
+    NODE_VALIDATION_CHECK(op, op->get_temperature() > 0.0f, "The temperature must be positive.");
+    NODE_VALIDATION_CHECK(op, op->get_top_k() >= 0, "The top_k must be non negative.");
+    NODE_VALIDATION_CHECK(op,
+                          op->get_top_p() > 0.0f && op->get_top_p() <= 1.0f,
+                          "The top_p must be in the (0, 1] range.");
+
+    const auto& logits_shape = input_shapes[0];
+    auto output_shapes = std::vector<TRShape>(1);
+    auto& output_shape = output_shapes[0];
+    if (logits_shape.rank().is_static()) {
+        NODE_VALIDATION_CHECK(op, logits_shape.size() == 2, "The logits input must be a 2D tensor.");
+        NODE_VALIDATION_CHECK(op,
+                              logits_shape[1].is_dynamic() || logits_shape[1].get_length() > 0,
+                              "The vocabulary dimension of the logits must not be empty.");
+        output_shape.push_back(logits_shape[0]);
+    } else {
+        output_shape.push_back(Dimension::dynamic());
+    }
+    output_shape.push_back(1);
+    return output_shapes;
+}
+}  // namespace v13
+}  // namespace op
+}  // namespace ov
@@ -0,0 +1,164 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/op/sampling.hpp"
+
+#include "itt.hpp"
+#include "ngraph/runtime/reference/random_uniform.hpp"
+#include "ngraph/runtime/reference/sampling.hpp"
+#include "sampling_shape_inference.hpp"
+
+namespace ov {
+namespace op {
+namespace v13 {
+namespace validate {
+inline bool logits_et(const element::Type& et) {
+    return et == element::f32 || et == element::f16 || et == element::bf16;
+}
+
+inline bool out_et(const element::Type& et) {
+    return et == element::i32 || et == element::i64;
+}
+}  // namespace validate
+
+namespace sampling {
+namespace {
+template <typename T>
+bool evaluate_out(const Tensor& logits, Tensor& out, const float* uniforms, const Sampling* op) {
+    switch (out.get_element_type()) {
+    case element::i32:
+        ngraph::runtime::reference::sampling(logits.data<const T>(),
+                                             out.data<int32_t>(),
+                                             uniforms,
+                                             logits.get_shape(),
+                                             op->get_temperature(),
+                                             op->get_top_k(),
+                                             op->get_top_p());
+        return true;
+    case element::i64:
+        ngraph::runtime::reference::sampling(logits.data<const T>(),
+                                             out.data<int64_t>(),
+                                             uniforms,
+                                             logits.get_shape(),
+                                             op->get_temperature(),
+                                             op->get_top_k(),
+                                             op->get_top_p());
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool evaluate(const Tensor& logits, Tensor& out, const float* uniforms, const Sampling* op) {
+    switch (logits.get_element_type()) {
+    case element::f32:
+        return evaluate_out<float>(logits, out, uniforms, op);
+    case element::f16:
+        return evaluate_out<float16>(logits, out, uniforms, op);
+    case element::bf16:
+        return evaluate_out<bfloat16>(logits, out, uniforms, op);
+    default:
+        return false;
+    }
+}
+}  // namespace
+}  // namespace sampling
+
+Sampling::Sampling(const Output<Node>& logits,
+                   float temperature,
+                   int64_t top_k,
+                   float top_p,
+                   const ov::element::Type& out_type,
+                   uint64_t global_seed,
+                   uint64_t op_seed)
+    : Op({logits}),
+      m_temperature(temperature),
+      m_top_k(top_k),
+      m_top_p(top_p),
+      m_output_type(out_type),
+      m_global_seed(global_seed),
+      m_op_seed(op_seed) {
+    constructor_validate_and_infer_types();
+}
+
+void Sampling::validate_and_infer_types() {
+    OV_OP_SCOPE(v13_Sampling_validate_and_infer_types);
+
+    const auto& logits_et = get_input_element_type(0);
+    NODE_VALIDATION_CHECK(this,
+                          logits_et.is_dynamic() || validate::logits_et(logits_et),
+                          "Type of the logits should be f32, f16 or bf16.");
+    NODE_VALIDATION_CHECK(this, validate::out_et(get_out_type()), "Type of the output should be int32 or int64.");
+
+    OPENVINO_SUPPRESS_DEPRECATED_START
+    const auto input_shapes = get_node_input_partial_shapes(*this);
+    OPENVINO_SUPPRESS_DEPRECATED_END
+    const auto output_shapes = shape_infer(this, input_shapes);
+
+    set_output_type(0, get_out_type(), output_shapes.front());
+}
+
+bool Sampling::visit_attributes(AttributeVisitor& visitor) {
+    OV_OP_SCOPE(v13_Sampling_visit_attributes);
+    visitor.on_attribute("temperature", m_temperature);
+    visitor.on_attribute("top_k", m_top_k);
+    visitor.on_attribute("top_p", m_top_p);
+    visitor.on_attribute("output_type", m_output_type);
+    visitor.on_attribute("op_seed", m_op_seed);
+    visitor.on_attribute("global_seed", m_global_seed);
+    return true;
+}
+
+std::shared_ptr<Node> Sampling::clone_with_new_inputs(const OutputVector& new_args) const {
+    OV_OP_SCOPE(v13_Sampling_clone_with_new_inputs);
+    check_new_args_count(this, new_args);
+    auto sampling_copy = std::make_shared<v13::Sampling>(new_args.at(0),
+                                                         m_temperature,
+                                                         m_top_k,
+                                                         m_top_p,
+                                                         m_output_type,
+                                                         m_global_seed,
+                                                         m_op_seed);
+    sampling_copy->m_state = this->m_state;
+    return sampling_copy;
+}
+
+bool Sampling::evaluate(TensorVector& outputs, const TensorVector& inputs) const {
+    OV_OP_SCOPE(v13_Sampling_evaluate);
+
+    const auto& logits = inputs[0];
+    const auto out_shape = shape_infer(this, std::vector<PartialShape>{logits.get_shape()}).front().to_shape();
+    outputs[0].set_shape(out_shape);
+
+    // one uniform number per row, the same RandomUniform with these seeds generates
+    const auto batch = std::vector<uint64_t>{out_shape[0]};
+    const float min_val = 0.0f;
+    const float max_val = 1.0f;
+    std::vector<float> uniforms(batch[0]);
+    auto state = ngraph::runtime::reference::random_uniform(batch.data(),
+                                                            reinterpret_cast<const char*>(&min_val),
+                                                            reinterpret_cast<const char*>(&max_val),
+                                                            reinterpret_cast<char*>(uniforms.data()),
+                                                            Shape{1},
+                                                            element::f32,
+                                                            get_global_seed(),
+                                                            get_op_seed(),
+                                                            m_state);
+
+    if (!sampling::evaluate(logits, outputs[0], uniforms.data(), this))
+        return false;
+
+    // Update Sampling state
+    std::lock_guard<std::mutex> guard(m_state_mutex);
+    m_state = state;
+    return true;
+}
+
+bool Sampling::has_evaluate() const {
+    OV_OP_SCOPE(v13_Sampling_has_evaluate);
+    return validate::logits_et(get_input_element_type(0)) && validate::out_et(get_out_type());
+}
+}  // namespace v13
+}  // namespace op
+}  // namespace ov
@@ -83,7 +83,8 @@ const std::map<std::string, std::function<const ov::OpSet&()>>& ov::get_availabl
                                                                                        _OPENVINO_REG_OPSET(opset9),
                                                                                        _OPENVINO_REG_OPSET(opset10),
                                                                                        _OPENVINO_REG_OPSET(opset11),
-                                                                                       _OPENVINO_REG_OPSET(opset12)};
+                                                                                       _OPENVINO_REG_OPSET(opset12),
+                                                                                       _OPENVINO_REG_OPSET(opset13)};
 #undef _OPENVINO_REG_OPSET
     return opset_map;
 }
@@ -220,6 +221,17 @@ const ov::OpSet& ov::get_opset12() {
     return opset;
 }
 
+const ov::OpSet& ov::get_opset13() {
+    static OpSet opset;
+    static std::once_flag flag;
+    std::call_once(flag, [&]() {
+#define _OPENVINO_OP_REG(NAME, NAMESPACE) opset.insert<NAMESPACE::NAME>();
+#include "openvino/opsets/opset13_tbl.hpp"
+#undef _OPENVINO_OP_REG
+    });
+    return opset;
+}
+
 const ngraph::OpSet& ngraph::get_opset1() {
     static OpSet opset(ov::get_opset1());
     return opset;
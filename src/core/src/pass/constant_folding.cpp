@@ -56,7 +56,8 @@ bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& m
 
     bool rewritten = pre_calculated_values_folding(model);
 
-    for (const auto& node : model->get_ordered_ops()) {
+    auto ordered_ops = model->get_ordered_ops();
+    for (auto& node : ordered_ops) {
         if (rewritten) {
             node->validate_and_infer_types();
         }
@@ -96,6 +97,12 @@ bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& m
                 }
             }
         }
+
+        // Drop the reference held by the ordered list as soon as the node is processed. Folded nodes have no
+        // consumers anymore, so they are destroyed here together with constants which were produced for them by
+        // previous iterations. This way a chain of foldable operations keeps only its current input and output
+        // alive instead of materializing all intermediate constants until the end of the pass.
+        node.reset();
     }
 
     return rewritten;
@@ -66,6 +66,8 @@ bool ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
 
     static bool profile_enabled =
         ov::util::getenv_bool("NGRAPH_PROFILE_PASS_ENABLE") || ov::util::getenv_bool("OV_PROFILE_PASS_ENABLE");
+    const bool collect_profiling = profile_enabled || m_profile_passes;
+    m_pass_profiling_results.clear();
 
     size_t index = 0;
     ngraph::stopwatch pass_timer;
@@ -138,6 +140,10 @@ bool ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
         }
         index++;
         pass_timer.stop();
+        if (collect_profiling) {
+            m_pass_profiling_results.emplace_back(pass->get_name(),
+                                                  std::chrono::microseconds(pass_timer.get_microseconds()));
+        }
         if (profile_enabled) {
             cout << setw(7) << pass_timer.get_milliseconds() << "ms " << pass->get_name() << "\n";
         }
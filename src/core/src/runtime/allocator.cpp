@@ -8,6 +8,8 @@
 #include "ie_allocator.hpp"
 #include "ie_common.h"
 #include "openvino/core/except.hpp"
+#include "openvino/runtime/memory_pool.hpp"
+#include "pooling_allocator.hpp"
 
 namespace ov {
 
@@ -48,7 +50,8 @@ struct DefaultAllocator {
     }
 };
 
-Allocator::Allocator() : Allocator{DefaultAllocator{}} {}
+Allocator::Allocator()
+    : Allocator{util::is_memory_pool_enabled() ? Allocator{PoolingAllocator{}} : Allocator{DefaultAllocator{}}} {}
 
 OPENVINO_SUPPRESS_DEPRECATED_START
 struct AllocatorImplWrapper {
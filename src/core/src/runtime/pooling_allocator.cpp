@@ -0,0 +1,311 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "pooling_allocator.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <mutex>
+#include <vector>
+
+#if defined(_WIN32)
+#    include <malloc.h>
+#elif defined(__linux__)
+#    include <sys/mman.h>
+#endif
+
+#include "openvino/core/except.hpp"
+#include "openvino/runtime/memory_pool.hpp"
+
+namespace ov {
+namespace {
+
+// User pointers of pooled blocks are aligned to cache line, header is placed right before the user pointer
+constexpr size_t block_alignment = 64;
+// Size classes are spaced with 4 steps per power of two starting from 64 bytes up to 1 GB,
+// so a block is at most 25% larger than requested
+constexpr size_t min_class_log2 = 6;
+constexpr size_t min_class_size = size_t{1} << min_class_log2;
+constexpr size_t max_class_log2 = 30;
+constexpr size_t max_pooled_size = size_t{1} << max_class_log2;
+constexpr size_t steps_per_power = 4;
+constexpr size_t num_classes = 1 + (max_class_log2 - min_class_log2) * steps_per_power;
+constexpr size_t huge_page_size = size_t{2} << 20;
+// Limits of free memory kept by a single thread and by the whole process
+constexpr size_t max_thread_cached_size = size_t{1} << 20;
+constexpr size_t max_thread_cached_blocks = 8;
+constexpr size_t max_thread_cached_bytes = size_t{8} << 20;
+constexpr size_t max_cached_bytes = size_t{1} << 30;
+constexpr uint32_t unpooled = UINT32_MAX;
+
+struct BlockHeader {
+    size_t offset;  // distance from the start of the system allocation to the user pointer
+    uint32_t size_class;
+};
+static_assert(sizeof(BlockHeader) <= block_alignment, "Block header must fit into the alignment padding");
+
+size_t floor_log2(size_t value) {
+    size_t result = 0;
+    while (value >>= 1) {
+        ++result;
+    }
+    return result;
+}
+
+size_t size_class_of(const size_t bytes) {
+    if (bytes <= min_class_size) {
+        return 0;
+    }
+    const auto power = floor_log2(bytes - 1);
+    const auto step = size_t{1} << (power - 2);
+    const auto steps = (bytes - (size_t{1} << power) + step - 1) / step;
+    return 1 + (power - min_class_log2) * steps_per_power + (steps - 1);
+}
+
+size_t class_size(const size_t size_class) {
+    if (size_class == 0) {
+        return min_class_size;
+    }
+    const auto power = min_class_log2 + (size_class - 1) / steps_per_power;
+    const auto steps = (size_class - 1) % steps_per_power + 1;
+    return (size_t{1} << power) + steps * (size_t{1} << (power - 2));
+}
+
+BlockHeader* header_of(void* block) {
+    return reinterpret_cast<BlockHeader*>(block) - 1;
+}
+
+void* allocate_block(const size_t bytes, const size_t alignment, const uint32_t size_class) {
+    const auto offset = std::max(alignment, block_alignment);
+    const auto total = offset + bytes;
+    // Large blocks are aligned to huge page, so they can be backed by transparent huge pages
+    const auto system_alignment = std::max(offset, total >= huge_page_size ? huge_page_size : size_t{0});
+#if defined(_WIN32)
+    void* memory = _aligned_malloc(total, system_alignment);
+    if (memory == nullptr) {
+        OPENVINO_THROW("_aligned_malloc failed");
+    }
+#else
+    void* memory = nullptr;
+    if (posix_memalign(&memory, system_alignment, total) != 0) {
+        OPENVINO_THROW("posix_memalign failed");
+    }
+#    if defined(MADV_HUGEPAGE)
+    if (total >= huge_page_size) {
+        // Only a hint, allocation is still valid if kernel doesn't support THP
+        madvise(memory, total, MADV_HUGEPAGE);
+    }
+#    endif
+#endif
+    auto block = static_cast<char*>(memory) + offset;
+    header_of(block)->offset = offset;
+    header_of(block)->size_class = size_class;
+    return block;
+}
+
+void free_block(void* block) {
+    void* memory = static_cast<char*>(block) - header_of(block)->offset;
+#if defined(_WIN32)
+    _aligned_free(memory);
+#else
+    free(memory);
+#endif
+}
+
+class GlobalPool {
+public:
+    void* pop(const size_t size_class) {
+        auto& free_blocks = m_classes[size_class];
+        std::lock_guard<std::mutex> lock(free_blocks.mutex);
+        if (free_blocks.blocks.empty()) {
+            return nullptr;
+        }
+        auto block = free_blocks.blocks.back();
+        free_blocks.blocks.pop_back();
+        bytes_cached -= class_size(size_class);
+        return block;
+    }
+
+    bool push(const size_t size_class, void* block) {
+        const auto size = class_size(size_class);
+        if (bytes_cached + size > max_cached_bytes) {
+            return false;
+        }
+        auto& free_blocks = m_classes[size_class];
+        std::lock_guard<std::mutex> lock(free_blocks.mutex);
+        free_blocks.blocks.push_back(block);
+        bytes_cached += size;
+        return true;
+    }
+
+    void release() {
+        for (size_t size_class = 0; size_class < num_classes; ++size_class) {
+            auto& free_blocks = m_classes[size_class];
+            std::lock_guard<std::mutex> lock(free_blocks.mutex);
+            for (auto block : free_blocks.blocks) {
+                free_block(block);
+            }
+            bytes_cached -= free_blocks.blocks.size() * class_size(size_class);
+            free_blocks.blocks.clear();
+        }
+    }
+
+    std::atomic<bool> enabled{false};
+    // Statistics, bytes_cached includes blocks kept in thread caches
+    std::atomic<size_t> bytes_cached{0};
+    std::atomic<size_t> allocations{0};
+    std::atomic<size_t> hits{0};
+
+private:
+    struct FreeBlocks {
+        std::mutex mutex;
+        std::vector<void*> blocks;
+    };
+    std::array<FreeBlocks, num_classes> m_classes;
+};
+
+GlobalPool& global_pool() {
+    // Never destroyed: caches of threads which exit after static destructors return blocks here
+    static auto pool = new GlobalPool();
+    return *pool;
+}
+
+class ThreadCache {
+public:
+    ~ThreadCache() {
+        flush(false);
+        destroyed() = true;
+    }
+
+    static ThreadCache* get() {
+        if (destroyed()) {
+            return nullptr;
+        }
+        static thread_local ThreadCache cache;
+        return &cache;
+    }
+
+    void* pop(const size_t size_class) {
+        auto& blocks = m_blocks[size_class];
+        if (blocks.empty()) {
+            return nullptr;
+        }
+        auto block = blocks.back();
+        blocks.pop_back();
+        m_bytes -= class_size(size_class);
+        global_pool().bytes_cached -= class_size(size_class);
+        return block;
+    }
+
+    bool push(const size_t size_class, void* block) {
+        const auto size = class_size(size_class);
+        auto& blocks = m_blocks[size_class];
+        if (size > max_thread_cached_size || blocks.size() >= max_thread_cached_blocks ||
+            m_bytes + size > max_thread_cached_bytes) {
+            return false;
+        }
+        blocks.push_back(block);
+        m_bytes += size;
+        global_pool().bytes_cached += size;
+        return true;
+    }
+
+    // Returns cached blocks to the global pool or frees them
+    void flush(const bool release) {
+        auto& pool = global_pool();
+        for (size_t size_class = 0; size_class < num_classes; ++size_class) {
+            for (auto block : m_blocks[size_class]) {
+                pool.bytes_cached -= class_size(size_class);
+                if (release || !pool.push(size_class, block)) {
+                    free_block(block);
+                }
+            }
+            m_blocks[size_class].clear();
+        }
+        m_bytes = 0;
+    }
+
+private:
+    static bool& destroyed() {
+        static thread_local bool flag = false;
+        return flag;
+    }
+
+    std::array<std::vector<void*>, num_classes> m_blocks;
+    size_t m_bytes = 0;
+};
+
+}  // namespace
+
+void* PoolingAllocator::allocate(const size_t bytes, const size_t alignment) {
+    OPENVINO_ASSERT(alignment && !static_cast<bool>(alignment & (alignment - static_cast<size_t>(1))),
+                    "Alignment is not power of 2: ",
+                    alignment);
+    if (alignment > block_alignment || bytes > max_pooled_size) {
+        return allocate_block(bytes, alignment, unpooled);
+    }
+    auto& pool = global_pool();
+    const auto size_class = size_class_of(bytes);
+    ++pool.allocations;
+    void* block = nullptr;
+    if (auto cache = ThreadCache::get()) {
+        block = cache->pop(size_class);
+    }
+    if (block == nullptr) {
+        block = pool.pop(size_class);
+    }
+    if (block != nullptr) {
+        ++pool.hits;
+        return block;
+    }
+    return allocate_block(class_size(size_class), block_alignment, static_cast<uint32_t>(size_class));
+}
+
+void PoolingAllocator::deallocate(void* handle, const size_t, const size_t) {
+    if (handle == nullptr) {
+        return;
+    }
+    const auto size_class = header_of(handle)->size_class;
+    if (size_class == unpooled) {
+        free_block(handle);
+        return;
+    }
+    auto cache = ThreadCache::get();
+    if ((cache && cache->push(size_class, handle)) || global_pool().push(size_class, handle)) {
+        return;
+    }
+    free_block(handle);
+}
+
+namespace util {
+
+void set_memory_pool_enabled(bool enable) {
+    global_pool().enabled = enable;
+}
+
+bool is_memory_pool_enabled() {
+    return global_pool().enabled;
+}
+
+MemoryPoolStatistics get_memory_pool_statistics() {
+    const auto& pool = global_pool();
+    MemoryPoolStatistics statistics;
+    statistics.bytes_cached = pool.bytes_cached;
+    statistics.allocations = pool.allocations;
+    statistics.hits = pool.hits;
+    return statistics;
+}
+
+void release_memory_pool() {
+    if (auto cache = ThreadCache::get()) {
+        cache->flush(true);
+    }
+    global_pool().release();
+}
+
+}  // namespace util
+}  // namespace ov
@@ -0,0 +1,27 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+
+namespace ov {
+
+/**
+ * @brief Allocator which reuses freed blocks through size classes.
+ *
+ * All instances share the process-wide pool, so memory allocated by one instance can be deallocated by another one.
+ * Blocks carry a small header, so `bytes` and `alignment` passed to deallocate() are not used.
+ */
+struct PoolingAllocator {
+    void* allocate(const size_t bytes, const size_t alignment);
+
+    void deallocate(void* handle, const size_t bytes, const size_t alignment);
+
+    bool is_equal(const PoolingAllocator&) const {
+        return true;
+    }
+};
+
+}  // namespace ov
@@ -3911,3 +3911,54 @@ TEST(constant_folding, gather_with_dynamic_shapes_in_data_input) {
     check_names(strided_slice, {"strided_slice"}, "strided_slice");
     check_names(res, {"result"}, "result");
 }
+
+namespace {
+class FoldProbe : public ov::op::Op {
+public:
+    OPENVINO_OP("FoldProbe");
+
+    FoldProbe(const Output<Node>& arg, std::function<void()> probe) : Op({arg}), m_probe(std::move(probe)) {
+        constructor_validate_and_infer_types();
+    }
+
+    void validate_and_infer_types() override {
+        set_output_type(0, get_input_element_type(0), get_input_partial_shape(0));
+    }
+
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& new_args) const override {
+        return std::make_shared<FoldProbe>(new_args.at(0), m_probe);
+    }
+
+    bool constant_fold(OutputVector& output_values, const OutputVector& inputs_values) override {
+        m_probe();
+        output_values[0] = inputs_values[0];
+        return true;
+    }
+
+private:
+    std::function<void()> m_probe;
+};
+}  // namespace
+
+TEST(constant_folding, intermediate_constants_released_eagerly) {
+    auto data = make_shared<op::Constant>(element::f32, Shape{2, 2}, std::vector<float>{1, 2, 3, 4});
+    auto negative = make_shared<op::Negative>(data);
+    std::weak_ptr<Node> data_weak = data;
+    std::weak_ptr<Node> negative_weak = negative;
+
+    bool released_before_probe = false;
+    auto probe = make_shared<FoldProbe>(negative, [&]() {
+        released_before_probe = data_weak.expired() && negative_weak.expired();
+    });
+    auto abs = make_shared<op::Abs>(probe);
+    auto model = make_shared<ov::Model>(abs, ParameterVector{});
+    data.reset();
+    negative.reset();
+
+    run_constant_folding(model);
+
+    EXPECT_TRUE(released_before_probe);
+    ASSERT_EQ(count_ops_of_type<op::Constant>(model), 1);
+    auto values_out = get_result_constant_data<float>(model, 0);
+    range_test_check(values_out, vector<float>{1, 2, 3, 4});
+}
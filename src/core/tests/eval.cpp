@@ -1819,6 +1819,34 @@ TEST(eval, evaluate_static_scatter_elements_update_boolean_max) {
     ASSERT_EQ(cval, out);
 }
 
+TEST(eval, evaluate_static_scatter_elements_update_reduction_max_exclusive_negative_f32) {
+    const Shape data_shape{4};
+    const Shape indices_shape{4};
+    auto arg1 = make_shared<op::Parameter>(element::f32, data_shape);
+    auto arg2 = make_shared<op::Parameter>(element::i32, indices_shape);
+    auto arg3 = make_shared<op::Parameter>(element::f32, indices_shape);
+    auto arg4 = make_shared<op::Parameter>(element::i64, Shape{});
+    auto scatter_elements_update =
+        make_shared<ov::op::v12::ScatterElementsUpdate>(arg1,
+                                                        arg2,
+                                                        arg3,
+                                                        arg4,
+                                                        ov::op::v12::ScatterElementsUpdate::Reduction::MAX,
+                                                        false);
+    auto fun = make_shared<Function>(OutputVector{scatter_elements_update}, ParameterVector{arg1, arg2, arg3, arg4});
+    auto result_tensor = make_shared<HostTensor>();
+    ASSERT_TRUE(fun->evaluate({result_tensor},
+                              {make_host_tensor<element::Type_t::f32>(data_shape, {10.f, 20.f, 30.f, 40.f}),
+                               make_host_tensor<element::Type_t::i32>(indices_shape, {0, 0, 2, 2}),
+                               make_host_tensor<element::Type_t::f32>(indices_shape, {-1.f, -2.f, -3.f, 4.f}),
+                               make_host_tensor<element::Type_t::i64>({}, {0})}));
+    EXPECT_EQ(result_tensor->get_element_type(), element::f32);
+    EXPECT_EQ(result_tensor->get_shape(), data_shape);
+    const auto cval = read_vector<float>(result_tensor);
+    const vector<float> out{-1.f, 20.f, 4.f, 40.f};
+    ASSERT_EQ(cval, out);
+}
+
 TEST(eval, evaluate_static_scatter_elements_update_boolean_max_exclusive) {
     const Shape data_shape{6};
     const Shape indices_shape{8};
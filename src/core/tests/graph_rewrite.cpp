@@ -265,6 +265,37 @@ TEST(GraphRewriteTest, TypeBasedMatcherPassOrder2) {
     ASSERT_EQ(count_ops_of_type<opset3::Tanh>(f), 1);
 }
 
+TEST(GraphRewriteTest, TypeBasedAndUntypedMatcherPassOrder) {
+    auto f = get_function();
+
+    // untyped matcher is registered first, so it is applied before type based one
+    NodeVector order;
+    Anchor anchor;
+    anchor.add_matcher<GatherNodesPass>(order);
+    anchor.add_matcher<TypeBasedTestPass>()->set_callback(get_callback());
+    anchor.run_on_model(f);
+
+    ASSERT_EQ(count_ops_of_type<opset3::Relu>(f), 1);
+    ASSERT_EQ(order.size(), 4);
+    ASSERT_TRUE(ov::is_type<opset3::Divide>(order[2]));
+}
+
+TEST(GraphRewriteTest, TypeBasedAndUntypedMatcherPassOrder2) {
+    auto f = get_function();
+
+    // type based matcher is registered first and succeeds, so untyped one is not applied to Divide
+    NodeVector order;
+    Anchor anchor;
+    anchor.add_matcher<TypeBasedTestPass>()->set_callback(get_callback());
+    anchor.add_matcher<GatherNodesPass>(order);
+    anchor.run_on_model(f);
+
+    ASSERT_EQ(count_ops_of_type<opset3::Relu>(f), 1);
+    for (const auto& node : order) {
+        ASSERT_FALSE(ov::is_type<opset3::Divide>(node));
+    }
+}
+
 TEST(PassConfigTest, Test1) {
     {
         auto f = get_function();
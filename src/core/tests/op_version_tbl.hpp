@@ -123,6 +123,7 @@ _OPENVINO_OP_REG(Reverse, ov::op::v1)
 _OPENVINO_OP_REG(ReverseSequence, ov::op::v0)
 _OPENVINO_OP_REG(Round, ov::op::v5)
 _OPENVINO_OP_REG(ROIAlign, ov::op::v3)
+_OPENVINO_OP_REG(Sampling, ov::op::v13)
 _OPENVINO_OP_REG(ScatterElementsUpdate, ov::op::v3)
 _OPENVINO_OP_REG(ScatterUpdate, ov::op::v3)
 _OPENVINO_OP_REG(Select, ov::op::v1)
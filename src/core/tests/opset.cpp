@@ -69,7 +69,8 @@ INSTANTIATE_TEST_SUITE_P(opset,
                                          OpsetTestParams{ov::get_opset9, 173},
                                          OpsetTestParams{ov::get_opset10, 177},
                                          OpsetTestParams{ov::get_opset11, 177},
-                                         OpsetTestParams{ov::get_opset12, 178}),
+                                         OpsetTestParams{ov::get_opset12, 178},
+                                         OpsetTestParams{ov::get_opset13, 179}),
                          OpsetTestNameGenerator{});
 
 class MyOpOld : public ov::op::Op {
@@ -0,0 +1,82 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <thread>
+
+#include "openvino/runtime/allocator.hpp"
+#include "openvino/runtime/memory_pool.hpp"
+#include "openvino/runtime/tensor.hpp"
+
+class OVPoolingAllocatorTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        ov::util::set_memory_pool_enabled(true);
+    }
+
+    void TearDown() override {
+        ov::util::set_memory_pool_enabled(false);
+        ov::util::release_memory_pool();
+    }
+};
+
+TEST_F(OVPoolingAllocatorTest, defaultAllocatorUsesPoolWhenEnabled) {
+    ov::Allocator pooling;
+    ov::util::set_memory_pool_enabled(false);
+    ov::Allocator plain;
+    EXPECT_FALSE(pooling == plain);
+    ov::util::set_memory_pool_enabled(true);
+    EXPECT_TRUE(pooling == ov::Allocator{});
+}
+
+TEST_F(OVPoolingAllocatorTest, reusesFreedBlockOfTheSameSizeClass) {
+    ov::Allocator allocator;
+    const auto before = ov::util::get_memory_pool_statistics();
+
+    void* first = allocator.allocate(1000);
+    allocator.deallocate(first);
+    void* second = allocator.allocate(990);
+    EXPECT_EQ(first, second);
+    allocator.deallocate(second);
+
+    const auto after = ov::util::get_memory_pool_statistics();
+    EXPECT_EQ(after.allocations - before.allocations, 2u);
+    EXPECT_EQ(after.hits - before.hits, 1u);
+    EXPECT_GE(after.bytes_cached, 1000u);
+}
+
+TEST_F(OVPoolingAllocatorTest, respectsAlignment) {
+    ov::Allocator allocator;
+    for (size_t alignment : {1, 8, 64, 4096}) {
+        void* ptr = allocator.allocate(100, alignment);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(ptr) % alignment, 0u);
+        allocator.deallocate(ptr, 100, alignment);
+    }
+    EXPECT_THROW(allocator.allocate(64, 3), ov::Exception);
+}
+
+TEST_F(OVPoolingAllocatorTest, blockCanBeFreedOnOtherThread) {
+    ov::Allocator allocator;
+    void* ptr = allocator.allocate(10000);
+    static_cast<char*>(ptr)[9999] = 11;
+    std::thread([&] {
+        allocator.deallocate(ptr);
+    }).join();
+    // Cache of the exited thread is returned to the global pool
+    void* reused = allocator.allocate(10000);
+    EXPECT_EQ(ptr, reused);
+    allocator.deallocate(reused);
+}
+
+TEST_F(OVPoolingAllocatorTest, releaseFreesCachedBlocks) {
+    {
+        ov::Tensor tensor(ov::element::f32, ov::Shape{1, 3, 224, 224});
+        tensor.set_shape({1, 3, 448, 448});
+    }
+    EXPECT_GT(ov::util::get_memory_pool_statistics().bytes_cached, 0u);
+    ov::util::release_memory_pool();
+    EXPECT_EQ(ov::util::get_memory_pool_statistics().bytes_cached, 0u);
+}
@@ -42,3 +42,21 @@ public:
     }
 };
 }  // namespace
+
+TEST(pass_manager, pass_profiling) {
+    auto graph = make_test_graph();
+
+    pass::Manager pass_manager;
+    pass_manager.set_per_pass_validation(false);
+    pass_manager.register_pass<DummyPass>();
+    pass_manager.register_pass<DummyPass>();
+
+    pass_manager.set_pass_profiling(true);
+    pass_manager.run_passes(graph);
+    const auto& results = pass_manager.get_pass_profiling_results();
+    ASSERT_EQ(results.size(), 2);
+    for (const auto& result : results) {
+        EXPECT_FALSE(result.first.empty());
+        EXPECT_GE(result.second.count(), 0);
+    }
+}
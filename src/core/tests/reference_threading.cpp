@@ -0,0 +1,314 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cfenv>
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <vector>
+
+#include "ngraph/runtime/reference/avg_pool.hpp"
+#include "ngraph/runtime/reference/matmul.hpp"
+#include "ngraph/runtime/reference/max.hpp"
+#include "ngraph/runtime/reference/max_pool.hpp"
+#include "ngraph/runtime/reference/mean.hpp"
+#include "ngraph/runtime/reference/softmax.hpp"
+#include "ngraph/runtime/reference/sum.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/reduce_mean.hpp"
+#include "openvino/runtime/threading/cpu_streams_executor.hpp"
+
+using namespace ngraph;
+
+namespace {
+// the kernels split the work by the number of threads available to the calling thread
+void run_with_threads(const int threads, const std::function<void()>& func) {
+    ov::threading::CPUStreamsExecutor executor{
+        ov::threading::IStreamsExecutor::Config{"ReferenceThreadingTest", 1, threads}};
+    executor.run_and_wait({func});
+}
+
+const std::vector<int> parallel_threads = {3, 8};
+
+size_t reduced_size(const Shape& shape, const AxisSet& axes) {
+    size_t size = 1;
+    for (size_t axis = 0; axis < shape.size(); axis++) {
+        if (axes.count(axis) == 0) {
+            size *= shape[axis];
+        }
+    }
+    return size;
+}
+
+template <typename T>
+std::vector<T> make_data(const size_t size, const int modulo = 23) {
+    std::vector<T> data(size);
+    for (size_t i = 0; i < size; i++) {
+        data[i] = static_cast<T>(static_cast<int>((i * 7919) % modulo) - modulo / 2) / static_cast<T>(4);
+    }
+    return data;
+}
+
+// the result of the kernel with a single thread is compared bit by bit, so NaNs are equal as well
+template <typename T>
+void expect_same_for_any_threads(const size_t out_size, const std::function<void(T*)>& kernel) {
+    std::vector<T> expected(out_size, T(-1));
+    run_with_threads(1, [&] {
+        kernel(expected.data());
+    });
+    for (const auto threads : parallel_threads) {
+        std::vector<T> actual(out_size, T(-1));
+        run_with_threads(threads, [&] {
+            kernel(actual.data());
+        });
+        EXPECT_EQ(0, std::memcmp(expected.data(), actual.data(), out_size * sizeof(T))) << threads << " threads";
+    }
+}
+
+struct ReductionParams {
+    Shape shape;
+    AxisSet axes;
+};
+
+class reference_threading_reduction : public ::testing::TestWithParam<ReductionParams> {};
+}  // namespace
+
+TEST_P(reference_threading_reduction, sum_mean_max) {
+    const auto& p = GetParam();
+    const auto out_size = reduced_size(p.shape, p.axes);
+    const auto data = make_data<float>(shape_size(p.shape));
+
+    expect_same_for_any_threads<float>(out_size, [&](float* out) {
+        runtime::reference::sum(data.data(), out, p.shape, p.axes);
+    });
+    expect_same_for_any_threads<float>(out_size, [&](float* out) {
+        runtime::reference::mean(data.data(), out, p.shape, p.axes);
+    });
+    expect_same_for_any_threads<float>(out_size, [&](float* out) {
+        runtime::reference::max(data.data(), out, p.shape, p.axes);
+    });
+
+    const auto int_data = make_data<int32_t>(shape_size(p.shape), 1001);
+    expect_same_for_any_threads<int32_t>(out_size, [&](int32_t* out) {
+        runtime::reference::mean(int_data.data(), out, p.shape, p.axes);
+    });
+}
+
+TEST_P(reference_threading_reduction, reduce_mean_keep_dims) {
+    const auto& p = GetParam();
+    const auto data = make_data<float>(shape_size(p.shape));
+    const ov::Tensor input(ov::element::f32, p.shape, const_cast<float*>(data.data()));
+    const auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, p.shape);
+    const auto axes = ov::op::v0::Constant::create(ov::element::i64,
+                                                   Shape{p.axes.size()},
+                                                   std::vector<int64_t>(p.axes.begin(), p.axes.end()));
+
+    // the output with kept dimensions has the same elements in the same order as the reduced one
+    std::vector<float> reduced(reduced_size(p.shape, p.axes));
+    runtime::reference::mean(data.data(), reduced.data(), p.shape, p.axes);
+    for (const auto keep_dims : {false, true}) {
+        const auto reduce_mean = std::make_shared<ov::op::v1::ReduceMean>(param, axes, keep_dims);
+        expect_same_for_any_threads<float>(reduced.size(), [&](float* out) {
+            ov::TensorVector outputs{ov::Tensor(ov::element::f32, reduce_mean->get_output_shape(0), out)};
+            ASSERT_TRUE(reduce_mean->evaluate(outputs, ov::TensorVector{input}));
+        });
+
+        std::vector<float> actual(reduced.size());
+        ov::TensorVector outputs{ov::Tensor(ov::element::f32, reduce_mean->get_output_shape(0), actual.data())};
+        ASSERT_TRUE(reduce_mean->evaluate(outputs, ov::TensorVector{input}));
+        EXPECT_EQ(reduced, actual) << "keep_dims " << keep_dims;
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(reference_threading,
+                         reference_threading_reduction,
+                         ::testing::Values(ReductionParams{Shape{64, 32, 48}, AxisSet{0}},
+                                           ReductionParams{Shape{64, 32, 48}, AxisSet{1}},
+                                           ReductionParams{Shape{64, 32, 48}, AxisSet{2}},
+                                           ReductionParams{Shape{64, 32, 48}, AxisSet{0, 2}},
+                                           ReductionParams{Shape{16, 8, 12, 20}, AxisSet{1, 3}},
+                                           ReductionParams{Shape{16, 8, 12, 20}, AxisSet{2, 3}},
+                                           ReductionParams{Shape{16, 8, 12, 20}, AxisSet{0, 1, 2, 3}},
+                                           ReductionParams{Shape{0, 32, 48}, AxisSet{1}},
+                                           ReductionParams{Shape{64, 0, 48}, AxisSet{2}}));
+
+TEST(reference_threading, mean_integer_over_empty_axis) {
+    const Shape shape{3, 0, 4};
+    const std::vector<int32_t> data;
+    expect_same_for_any_threads<int32_t>(12, [&](int32_t* out) {
+        runtime::reference::mean(data.data(), out, shape, AxisSet{1});
+    });
+
+    std::vector<int32_t> out(12, -1);
+    runtime::reference::mean(data.data(), out.data(), shape, AxisSet{1});
+    EXPECT_EQ(std::vector<int32_t>(12, 0), out);
+}
+
+TEST(reference_threading, softmax) {
+    for (const auto& shape : {Shape{32, 40, 50}, Shape{32, 0, 50}}) {
+        const auto data = make_data<float>(shape_size(shape));
+        for (const auto& axes : {AxisSet{0}, AxisSet{1}, AxisSet{2}, AxisSet{1, 2}}) {
+            expect_same_for_any_threads<float>(shape_size(shape), [&](float* out) {
+                runtime::reference::softmax(data.data(), out, shape, axes);
+            });
+        }
+    }
+}
+
+TEST(reference_threading, avg_pool) {
+    const Shape in_shape{2, 6, 17, 17};
+    const Shape out_shape{2, 6, 9, 9};
+    const auto data = make_data<float>(shape_size(in_shape));
+    for (const auto include_padding : {false, true}) {
+        expect_same_for_any_threads<float>(shape_size(out_shape), [&](float* out) {
+            runtime::reference::avg_pool(data.data(),
+                                         out,
+                                         in_shape,
+                                         out_shape,
+                                         Shape{3, 3},
+                                         Strides{2, 2},
+                                         Shape{1, 1},
+                                         Shape{1, 1},
+                                         include_padding);
+        });
+    }
+
+    const Shape empty_shape{0, 6, 17, 17};
+    expect_same_for_any_threads<float>(0, [&](float* out) {
+        runtime::reference::avg_pool(data.data(),
+                                     out,
+                                     empty_shape,
+                                     Shape{0, 6, 9, 9},
+                                     Shape{3, 3},
+                                     Strides{2, 2},
+                                     Shape{1, 1},
+                                     Shape{1, 1},
+                                     false);
+    });
+}
+
+TEST(reference_threading, avg_pool_i8_rounding) {
+    // 2x2 windows over the values 0, 1 have the averages 0.25, 0.5 and 0.75, halves are rounded to the even value
+    const Shape in_shape{2, 5, 8, 8};
+    const Shape out_shape{2, 5, 4, 4};
+    std::vector<int8_t> data(shape_size(in_shape));
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] = static_cast<int8_t>((i * 7 / 3) % 2 + (i / 64) % 3 * 2 - 3);
+    }
+    std::vector<int8_t> expected(shape_size(out_shape));
+    for (size_t plane = 0; plane < 10; plane++) {
+        for (size_t y = 0; y < 4; y++) {
+            for (size_t x = 0; x < 4; x++) {
+                int sum = 0;
+                for (size_t wy = 0; wy < 2; wy++) {
+                    for (size_t wx = 0; wx < 2; wx++) {
+                        sum += data[plane * 64 + (2 * y + wy) * 8 + 2 * x + wx];
+                    }
+                }
+                // the default rounding mode of the test rounds to the nearest value
+                expected[plane * 16 + y * 4 + x] = static_cast<int8_t>(std::nearbyint(sum / 4.0f));
+            }
+        }
+    }
+
+    const auto kernel = [&](int8_t* out) {
+        // the kernel rounds to the nearest value regardless of the rounding mode of the caller
+        const auto old_mode = std::fegetround();
+        std::fesetround(FE_UPWARD);
+        runtime::reference::avg_pool(data.data(),
+                                     out,
+                                     in_shape,
+                                     out_shape,
+                                     Shape{2, 2},
+                                     Strides{2, 2},
+                                     Shape{0, 0},
+                                     Shape{0, 0},
+                                     false);
+        std::fesetround(old_mode);
+    };
+    expect_same_for_any_threads<int8_t>(expected.size(), kernel);
+    for (const auto threads : parallel_threads) {
+        std::vector<int8_t> actual(expected.size());
+        run_with_threads(threads, [&] {
+            kernel(actual.data());
+        });
+        EXPECT_EQ(expected, actual) << threads << " threads";
+    }
+}
+
+TEST(reference_threading, max_pool) {
+    const Shape in_shape{2, 8, 16, 16};
+    const Shape out_shape{2, 8, 8, 8};
+    const auto data = make_data<float>(shape_size(in_shape), 97);
+    for (const int64_t axis : {0, 2}) {
+        const auto kernel = [&](float* values, int64_t* indices) {
+            runtime::reference::max_pool(data.data(),
+                                         values,
+                                         indices,
+                                         in_shape,
+                                         out_shape,
+                                         Shape{3, 3},
+                                         Strides{2, 2},
+                                         Strides{1, 1},
+                                         Shape{1, 1},
+                                         Shape{1, 1},
+                                         axis);
+        };
+        std::vector<int64_t> indices(shape_size(out_shape));
+        expect_same_for_any_threads<float>(shape_size(out_shape), [&](float* out) {
+            kernel(out, indices.data());
+        });
+        expect_same_for_any_threads<int64_t>(shape_size(out_shape), [&](int64_t* out) {
+            std::vector<float> values(shape_size(out_shape));
+            kernel(values.data(), out);
+        });
+    }
+}
+
+TEST(reference_threading, matmul_batched_column_blocks) {
+    // with K = 64 a column block of f32 is 256 columns wide, so every row spans three blocks
+    const Shape arg0_shape{3, 5, 64};
+    const Shape arg1_shape{3, 64, 600};
+    const Shape out_shape{3, 5, 600};
+    const auto arg0 = make_data<float>(shape_size(arg0_shape));
+    const auto arg1 = make_data<float>(shape_size(arg1_shape), 19);
+
+    std::vector<float> expected(shape_size(out_shape), 0.0f);
+    for (size_t b = 0; b < 3; b++) {
+        for (size_t i = 0; i < 5; i++) {
+            for (size_t j = 0; j < 600; j++) {
+                float sum = 0.0f;
+                for (size_t k = 0; k < 64; k++) {
+                    sum += arg0[(b * 5 + i) * 64 + k] * arg1[(b * 64 + k) * 600 + j];
+                }
+                expected[(b * 5 + i) * 600 + j] = sum;
+            }
+        }
+    }
+
+    const auto kernel = [&](float* out) {
+        runtime::reference::matmul(arg0.data(), arg1.data(), out, arg0_shape, arg1_shape, out_shape, false, false);
+    };
+    expect_same_for_any_threads<float>(expected.size(), kernel);
+    for (const auto threads : parallel_threads) {
+        std::vector<float> actual(expected.size());
+        run_with_threads(threads, [&] {
+            kernel(actual.data());
+        });
+        // the operands are multiples of 1/4 with small magnitudes, all the sums are exact
+        EXPECT_EQ(expected, actual) << threads << " threads";
+    }
+
+    // an empty K gives zeros
+    const auto empty_k = [&](float* out) {
+        runtime::reference::matmul(arg0.data(), arg1.data(), out, Shape{5, 0}, Shape{0, 7}, Shape{5, 7}, false, false);
+    };
+    expect_same_for_any_threads<float>(35, empty_k);
+    std::vector<float> zeros(35, -1.0f);
+    empty_k(zeros.data());
+    EXPECT_EQ(std::vector<float>(35, 0.0f), zeros);
+}
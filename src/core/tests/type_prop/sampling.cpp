@@ -0,0 +1,94 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "common_test_utils/test_assertions.hpp"
+#include "common_test_utils/type_prop.hpp"
+#include "openvino/opsets/opset13.hpp"
+
+using namespace std;
+using namespace testing;
+using namespace ov;
+
+TEST(type_prop, sampling_default_ctor) {
+    auto logits = make_shared<opset13::Parameter>(element::f32, PartialShape{4, 32000});
+
+    auto s = make_shared<opset13::Sampling>();
+    s->set_arguments(OutputVector{logits});
+    s->set_temperature(0.7f);
+    s->set_top_k(50);
+    s->set_top_p(0.9f);
+    s->set_out_type(element::i32);
+    s->set_global_seed(121);
+    s->set_op_seed(100);
+    s->validate_and_infer_types();
+
+    EXPECT_EQ(s->get_output_element_type(0), element::i32);
+    EXPECT_EQ(s->get_output_partial_shape(0), (PartialShape{4, 1}));
+}
+
+TEST(type_prop, sampling_type_shape) {
+    auto logits = make_shared<opset13::Parameter>(element::f16, PartialShape{2, 50272});
+
+    auto s = make_shared<opset13::Sampling>(logits, 1.0f, 0, 1.0f, element::i64, 120, 100);
+
+    EXPECT_EQ(s->get_output_element_type(0), element::i64);
+    EXPECT_EQ(s->get_output_partial_shape(0), (PartialShape{2, 1}));
+}
+
+TEST(type_prop, sampling_dynamic_shape) {
+    auto logits = make_shared<opset13::Parameter>(element::f32, PartialShape{{1, 8}, -1});
+    auto s = make_shared<opset13::Sampling>(logits, 0.5f, 10, 0.95f);
+    EXPECT_EQ(s->get_output_partial_shape(0), (PartialShape{{1, 8}, 1}));
+
+    logits = make_shared<opset13::Parameter>(element::f32, PartialShape::dynamic());
+    s = make_shared<opset13::Sampling>(logits, 0.5f, 10, 0.95f);
+    EXPECT_EQ(s->get_output_partial_shape(0), (PartialShape{-1, 1}));
+}
+
+TEST(type_prop, sampling_batch_label) {
+    auto logits_shape = PartialShape{-1, 32000};
+    set_shape_labels(logits_shape, 10);
+    auto logits = make_shared<opset13::Parameter>(element::f32, logits_shape);
+    auto s = make_shared<opset13::Sampling>(logits, 0.5f, 10, 0.95f);
+    EXPECT_THAT(get_shape_labels(s->get_output_partial_shape(0)), ElementsAre(10, ov::no_label));
+}
+
+TEST(type_prop, sampling_invalid_logits_type) {
+    auto logits = make_shared<opset13::Parameter>(element::i32, PartialShape{2, 100});
+    OV_EXPECT_THROW(ignore = make_shared<opset13::Sampling>(logits),
+                    NodeValidationFailure,
+                    HasSubstr("Type of the logits should be f32, f16 or bf16."));
+}
+
+TEST(type_prop, sampling_invalid_output_type) {
+    auto logits = make_shared<opset13::Parameter>(element::f32, PartialShape{2, 100});
+    OV_EXPECT_THROW(ignore = make_shared<opset13::Sampling>(logits, 1.0f, 0, 1.0f, element::f32),
+                    NodeValidationFailure,
+                    HasSubstr("Type of the output should be int32 or int64."));
+}
+
+TEST(type_prop, sampling_invalid_logits_rank) {
+    auto logits = make_shared<opset13::Parameter>(element::f32, PartialShape{2, 3, 100});
+    OV_EXPECT_THROW(ignore = make_shared<opset13::Sampling>(logits),
+                    NodeValidationFailure,
+                    HasSubstr("The logits input must be a 2D tensor."));
+}
+
+TEST(type_prop, sampling_invalid_attributes) {
+    auto logits = make_shared<opset13::Parameter>(element::f32, PartialShape{2, 100});
+    OV_EXPECT_THROW(ignore = make_shared<opset13::Sampling>(logits, 0.0f),
+                    NodeValidationFailure,
+                    HasSubstr("The temperature must be positive."));
+    OV_EXPECT_THROW(ignore = make_shared<opset13::Sampling>(logits, 1.0f, -1),
+                    NodeValidationFailure,
+                    HasSubstr("The top_k must be non negative."));
+    OV_EXPECT_THROW(ignore = make_shared<opset13::Sampling>(logits, 1.0f, 0, 0.0f),
+                    NodeValidationFailure,
+                    HasSubstr("The top_p must be in the (0, 1] range."));
+    OV_EXPECT_THROW(ignore = make_shared<opset13::Sampling>(logits, 1.0f, 0, 1.5f),
+                    NodeValidationFailure,
+                    HasSubstr("The top_p must be in the (0, 1] range."));
+}
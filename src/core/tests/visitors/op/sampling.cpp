@@ -0,0 +1,29 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/visitor.hpp"
+#include "gtest/gtest.h"
+#include "openvino/opsets/opset13.hpp"
+
+using namespace std;
+using namespace ov;
+using ngraph::test::NodeBuilder;
+
+TEST(attributes, sampling_op) {
+    NodeBuilder::get_ops().register_factory<opset13::Sampling>();
+    const auto logits = make_shared<opset13::Parameter>(element::f32, Shape{2, 1000});
+
+    const auto sampling = make_shared<opset13::Sampling>(logits, 0.7f, 40, 0.9f, element::i32, 150, 10);
+    NodeBuilder builder(sampling, {logits});
+    auto g_sampling = ov::as_type_ptr<opset13::Sampling>(builder.create());
+
+    const auto expected_attr_count = 6;
+    EXPECT_EQ(builder.get_value_map_size(), expected_attr_count);
+    EXPECT_EQ(g_sampling->get_temperature(), sampling->get_temperature());
+    EXPECT_EQ(g_sampling->get_top_k(), sampling->get_top_k());
+    EXPECT_EQ(g_sampling->get_top_p(), sampling->get_top_p());
+    EXPECT_EQ(g_sampling->get_out_type(), sampling->get_out_type());
+    EXPECT_EQ(g_sampling->get_global_seed(), sampling->get_global_seed());
+    EXPECT_EQ(g_sampling->get_op_seed(), sampling->get_op_seed());
+}
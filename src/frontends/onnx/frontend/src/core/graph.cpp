@@ -4,10 +4,14 @@
 
 #include "core/graph.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <exception>
 #include <functional>
 #include <numeric>
 #include <sstream>
+#include <thread>
 
 #include "core/transform.hpp"
 #include "core/value_info.hpp"
@@ -110,6 +114,37 @@ Model::ModelOpSet build_model_opset(const ONNX_NAMESPACE::ModelProto& model_prot
     return opset;
 }
 
+/// Calls func(0), ..., func(count - 1) using a few worker threads. The function must not throw.
+/// Threads are spawned only when there is enough work to amortize their creation.
+template <typename Func>
+void parallel_for(const size_t count, const Func& func) {
+    constexpr size_t min_items_per_thread = 8;
+    const size_t hw_threads = std::max(1u, std::thread::hardware_concurrency());
+    const size_t threads_num = std::min(hw_threads, count / min_items_per_thread);
+    if (threads_num <= 1) {
+        for (size_t i = 0; i < count; ++i) {
+            func(i);
+        }
+        return;
+    }
+
+    std::atomic<size_t> next_item{0};
+    const auto worker = [&]() {
+        for (size_t i = next_item++; i < count; i = next_item++) {
+            func(i);
+        }
+    };
+    std::vector<std::thread> workers;
+    workers.reserve(threads_num - 1);
+    for (size_t i = 1; i < threads_num; ++i) {
+        workers.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : workers) {
+        thread.join();
+    }
+}
+
 /// Copies only the extensions required by the Subgraph class.
 /// The source is an extension holder retrieved from the parent graph object.
 ov::frontend::ExtensionHolder subgraph_required_extensions(
@@ -143,25 +178,45 @@ Graph::Graph(const std::string& model_dir,
 
     std::map<std::string, Tensor> initializers;
 
-    // Process all initializers in the graph
+    std::vector<const ONNX_NAMESPACE::TensorProto*> initializer_tensors;
     for (const auto& initializer_tensor : m_model->get_graph().initializer()) {
         if (initializer_tensor.has_name()) {
-            Tensor tensor = Tensor{initializer_tensor, m_model_dir, enable_mmap};
-            std::shared_ptr<default_opset::Constant> ng_constant;
-            // For each initializer create a Constant node and store it in cache
+            initializer_tensors.push_back(&initializer_tensor);
+        }
+    }
+
+    // Decoding of initializers (including loading of external data) doesn't depend on each other,
+    // so it is done in parallel. Errors are rethrown and nodes are cached in the initializers order.
+    std::vector<std::unique_ptr<Tensor>> tensors(initializer_tensors.size());
+    std::vector<std::shared_ptr<default_opset::Constant>> ng_constants(initializer_tensors.size());
+    std::vector<std::exception_ptr> errors(initializer_tensors.size());
+    detail::parallel_for(initializer_tensors.size(), [&](const size_t i) {
+        try {
+            tensors[i] = common::make_unique<Tensor>(*initializer_tensors[i], m_model_dir, enable_mmap);
+            // For each initializer create a Constant node
             try {
-                ng_constant = tensor.get_ng_constant();
+                ng_constants[i] = tensors[i]->get_ng_constant();
             } catch (const error::invalid_external_data&) {
                 // invalid external data makes initializers creation impossible
                 throw;
             } catch (const ngraph::ngraph_error&) {
-                ng_constant = ngraph::onnx_import::common::make_failsafe_constant(tensor.get_ng_type());
+                ng_constants[i] = ngraph::onnx_import::common::make_failsafe_constant(tensors[i]->get_ng_type());
             }
+        } catch (...) {
+            errors[i] = std::current_exception();
+        }
+    });
 
-            initializers.emplace(initializer_tensor.name(), tensor);
-            ng_constant->get_output_tensor(0).set_names({initializer_tensor.name()});
-            m_cache->emplace_node(initializer_tensor.name(), std::move(ng_constant));
+    // Store initializers in cache
+    for (size_t i = 0; i < initializer_tensors.size(); ++i) {
+        if (errors[i]) {
+            std::rethrow_exception(errors[i]);
         }
+        const auto& initializer_tensor = *initializer_tensors[i];
+        auto& ng_constant = ng_constants[i];
+        initializers.emplace(initializer_tensor.name(), std::move(*tensors[i]));
+        ng_constant->get_output_tensor(0).set_names({initializer_tensor.name()});
+        m_cache->emplace_node(initializer_tensor.name(), std::move(ng_constant));
     }
 
     // Process all ONNX graph inputs, convert them to nGraph nodes and store in cache
@@ -182,6 +237,7 @@ void Graph::convert_to_ngraph_nodes() {
     const float total = static_cast<float>(m_model->get_graph().node().size());
     unsigned int completed = 0u;
     std::map<std::string, uint64_t> op_statistics;
+    std::map<std::string, std::chrono::microseconds> op_conversion_time;
     // Process ONNX graph nodes, convert to nGraph nodes
     for (const auto& node_proto : m_model->get_graph().node()) {
         if (m_extensions.telemetry) {
@@ -199,7 +255,13 @@ void Graph::convert_to_ngraph_nodes() {
                 subgraph->convert();
             }
         }
+        // subgraphs are converted above, their operations are timed by the subgraphs themselves
+        const auto conversion_start = std::chrono::steady_clock::now();
         OutputVector ng_nodes{make_ng_nodes(node)};
+        if (m_extensions.telemetry) {
+            op_conversion_time[node_proto.op_type()] += std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - conversion_start);
+        }
         ++completed;
         m_extensions.progress_reporter->report_progress(completed / total, static_cast<unsigned int>(total), completed);
     }
@@ -207,6 +269,11 @@ void Graph::convert_to_ngraph_nodes() {
         for (const auto& op : op_statistics) {
             m_extensions.telemetry->send_event("op_count", "onnx_" + op.first, static_cast<int>(op.second));
         }
+        for (const auto& op : op_conversion_time) {
+            m_extensions.telemetry->send_event("op_conversion_time_us",
+                                               "onnx_" + op.first,
+                                               static_cast<int>(op.second.count()));
+        }
     }
 }
 OPENVINO_SUPPRESS_DEPRECATED_END
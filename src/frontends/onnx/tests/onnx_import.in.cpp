@@ -192,6 +192,33 @@ OPENVINO_TEST(${BACKEND_NAME}, onnx_model_add_abc_initializers) {
     test_case.run();
 }
 
+OPENVINO_TEST(${BACKEND_NAME}, onnx_model_sum_many_initializers) {
+    // 32 initializers are enough to be decoded by several threads
+    auto function = onnx_import::import_onnx_model(file_util::path_join(ov::test::utils::getExecutableDirectory(),
+                                                                        SERIALIZED_ZOO,
+                                                                        "onnx/sum_many_initializers.onnx"));
+
+    // each Constant keeps the values and the name of its own initializer: "I<n>" holds n, n + 1, n + 2, n + 3
+    size_t constants_count = 0;
+    for (const auto& op : function->get_ordered_ops()) {
+        const auto constant = ov::as_type_ptr<ov::op::v0::Constant>(op);
+        if (!constant) {
+            continue;
+        }
+        const auto& names = constant->get_output_tensor(0).get_names();
+        ASSERT_EQ(names.size(), 1);
+        const auto n = static_cast<float>(std::stoi(names.begin()->substr(1)));
+        EXPECT_EQ(constant->cast_vector<float>(), (std::vector<float>{n, n + 1, n + 2, n + 3}));
+        ++constants_count;
+    }
+    EXPECT_EQ(constants_count, 32);
+
+    auto test_case = test::TestCase(function, s_device);
+    test_case.add_input<float>({1, 2, 3, 4});
+    test_case.add_expected_output<float>({497, 530, 563, 596});
+    test_case.run();
+}
+
 OPENVINO_TEST(${BACKEND_NAME}, onnx_model_override_op) {
     onnx_import::register_operator("FalseAdd", 1, "", [](const onnx_import::Node& node) -> OutputVector {
         OutputVector ng_inputs{node.get_ng_inputs()};
@@ -18,7 +18,12 @@
 #include "ie_core.hpp"
 #include "ngraph/ngraph.hpp"
 #include "openvino/frontend/manager.hpp"
+#include "openvino/frontend/onnx/extension/conversion.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/subtract.hpp"
 #include "openvino/openvino.hpp"
+#include "openvino/util/file_util.hpp"
 
 // API 1.0 tests
 TEST(ONNX_Reader_Tests, ImportModelWithExternalDataFromFile) {
@@ -354,3 +359,163 @@ TEST_P(OnnxFeMmapFixture, onnx_external_data_in_constant_node) {
 }
 
 INSTANTIATE_TEST_SUITE_P(OnnxFeMMapReadModel, OnnxFeMmapFixture, ::testing::Bool());
+
+// read_model cache of converted models
+
+class OnnxReadModelCacheTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        m_dir = ov::test::utils::generateTestFilePrefix() + "_read_model_cache";
+        m_cache_dir = ov::util::path_join({m_dir, "cache"});
+        m_model_path = ov::util::path_join({m_dir, "external_data_optional_fields.onnx"});
+        m_data_path = ov::util::path_join({m_dir, "tensors_data", "tensor_optional_fields.data"});
+        ov::test::utils::createDirectoryRecursive(ov::util::path_join({m_dir, "tensors_data"}));
+
+        copy_file(ov::test::utils::getModelFromTestModelZoo(std::string(ONNX_TEST_MODELS) +
+                                                            "external_data/external_data_optional_fields.onnx"),
+                  m_model_path);
+        // data of the initializer starts at offset 4096 and has length 16
+        write_data({1.f, 2.f, 3.f, 4.f}, 0);
+    }
+
+    void TearDown() override {
+        ov::test::utils::removeFilesWithExt(m_cache_dir, "xml");
+        ov::test::utils::removeFilesWithExt(m_cache_dir, "bin");
+        ov::test::utils::removeDir(m_cache_dir);
+        ov::test::utils::removeFile(m_data_path);
+        ov::test::utils::removeDir(ov::util::path_join({m_dir, "tensors_data"}));
+        ov::test::utils::removeFile(m_model_path);
+        ov::test::utils::removeDir(m_dir);
+    }
+
+    static void copy_file(const std::string& from, const std::string& to) {
+        std::ifstream src(from, std::ios::binary);
+        std::ofstream dst(to, std::ios::binary);
+        dst << src.rdbuf();
+    }
+
+    // padding after the initializer data changes the file size, so the change doesn't depend on mtime resolution
+    void write_data(const std::vector<float>& values, size_t padding) {
+        std::ofstream stream(m_data_path, std::ios::binary);
+        const std::string offset(4096, '\0');
+        stream.write(offset.data(), offset.size());
+        stream.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(float));
+        const std::string tail(padding, '\0');
+        stream.write(tail.data(), tail.size());
+    }
+
+    std::shared_ptr<ov::Model> read_model(ov::Core& core) {
+        core.set_property(ov::cache_dir(m_cache_dir));
+        core.set_property(ov::enable_read_model_cache(true));
+        return core.read_model(m_model_path);
+    }
+
+    std::vector<std::string> cache_entries() const {
+        return ov::test::utils::listFilesWithExt(m_cache_dir, "xml");
+    }
+
+    // values of the initializer read from the external data
+    static std::vector<float> initializer_values(const std::shared_ptr<ov::Model>& model) {
+        for (const auto& op : model->get_ordered_ops()) {
+            if (op->get_friendly_name() == "A") {
+                const auto constant = ov::as_type_ptr<ov::op::v0::Constant>(op);
+                if (constant)
+                    return constant->cast_vector<float>();
+            }
+        }
+        return {};
+    }
+
+    std::string m_dir;
+    std::string m_cache_dir;
+    std::string m_model_path;
+    std::string m_data_path;
+};
+
+TEST_F(OnnxReadModelCacheTest, cache_hit) {
+    ov::Core core;
+    const auto model = read_model(core);
+    EXPECT_EQ(initializer_values(model), (std::vector<float>{1.f, 2.f, 3.f, 4.f}));
+    const auto entries = cache_entries();
+    ASSERT_EQ(entries.size(), 1);
+
+    // changed weights of the cached IR prove that the second read_model doesn't convert the model again
+    const auto bin_path = ov::test::utils::replaceExt(entries.front(), "bin");
+    const auto bin_size = static_cast<size_t>(ov::test::utils::fileSize(bin_path));
+    ASSERT_EQ(bin_size % (4 * sizeof(float)), 0);
+    {
+        std::ofstream stream(bin_path, std::ios::binary);
+        const std::vector<float> patched{5.f, 6.f, 7.f, 8.f};
+        for (size_t i = 0; i < bin_size / (patched.size() * sizeof(float)); ++i)
+            stream.write(reinterpret_cast<const char*>(patched.data()), patched.size() * sizeof(float));
+    }
+
+    ov::Core other_core;
+    EXPECT_EQ(initializer_values(read_model(other_core)), (std::vector<float>{5.f, 6.f, 7.f, 8.f}));
+    EXPECT_EQ(cache_entries().size(), 1);
+}
+
+TEST_F(OnnxReadModelCacheTest, cache_miss_without_enabled_cache) {
+    ov::Core core;
+    core.set_property(ov::cache_dir(m_cache_dir));
+    const auto model = core.read_model(m_model_path);
+    EXPECT_EQ(initializer_values(model), (std::vector<float>{1.f, 2.f, 3.f, 4.f}));
+    EXPECT_TRUE(cache_entries().empty());
+}
+
+TEST_F(OnnxReadModelCacheTest, cache_invalidated_by_external_data) {
+    ov::Core core;
+    EXPECT_EQ(initializer_values(read_model(core)), (std::vector<float>{1.f, 2.f, 3.f, 4.f}));
+    ASSERT_EQ(cache_entries().size(), 1);
+
+    write_data({10.f, 20.f, 30.f, 40.f}, 16);
+    EXPECT_EQ(initializer_values(read_model(core)), (std::vector<float>{10.f, 20.f, 30.f, 40.f}));
+    EXPECT_EQ(cache_entries().size(), 2);
+}
+
+TEST_F(OnnxReadModelCacheTest, not_invalidated_by_unrelated_files) {
+    ov::Core core;
+    read_model(core);
+    ASSERT_EQ(cache_entries().size(), 1);
+
+    // only the external data the model refers to is a part of the key
+    const auto unrelated_path = ov::util::path_join({m_dir, "tensors_data", "unrelated.data"});
+    {
+        std::ofstream stream(unrelated_path, std::ios::binary);
+        stream << "unrelated";
+    }
+    EXPECT_EQ(initializer_values(read_model(core)), (std::vector<float>{1.f, 2.f, 3.f, 4.f}));
+    EXPECT_EQ(cache_entries().size(), 1);
+    ov::test::utils::removeFile(unrelated_path);
+}
+
+TEST_F(OnnxReadModelCacheTest, not_used_with_conversion_extensions) {
+    const auto count_ops = [](const std::shared_ptr<ov::Model>& model, const std::string& type_name) {
+        const auto ops = model->get_ordered_ops();
+        return std::count_if(ops.begin(), ops.end(), [&](const std::shared_ptr<ov::Node>& op) {
+            return type_name == op->get_type_name();
+        });
+    };
+    // converters of the same operation differ only in their behaviour
+    const auto add_converter = [](const ov::frontend::NodeContext& node) -> ov::OutputVector {
+        return {std::make_shared<ov::op::v1::Add>(node.get_input(0), node.get_input(1))};
+    };
+    const auto subtract_converter = [](const ov::frontend::NodeContext& node) -> ov::OutputVector {
+        return {std::make_shared<ov::op::v1::Subtract>(node.get_input(0), node.get_input(1))};
+    };
+    {
+        ov::Core core;
+        core.add_extension(std::make_shared<ov::frontend::onnx::ConversionExtension>("Add", add_converter));
+        const auto model = read_model(core);
+        EXPECT_EQ(count_ops(model, "Add"), 2);
+        EXPECT_EQ(count_ops(model, "Subtract"), 0);
+    }
+    {
+        ov::Core core;
+        core.add_extension(std::make_shared<ov::frontend::onnx::ConversionExtension>("Add", subtract_converter));
+        const auto model = read_model(core);
+        EXPECT_EQ(count_ops(model, "Add"), 0);
+        EXPECT_EQ(count_ops(model, "Subtract"), 2);
+    }
+    EXPECT_TRUE(cache_entries().empty());
+}
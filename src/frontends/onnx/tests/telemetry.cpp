@@ -20,6 +20,7 @@ static TelemetryFEParam getTestData() {
         std::make_tuple("mo", "op_count", "onnx_Add", 1),
         std::make_tuple("mo", "op_count", "onnx_Identity", 2),
     }};
+    res.m_conversion_time_action = "op_conversion_time_us";
     return res;
 }
 
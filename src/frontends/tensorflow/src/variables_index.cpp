@@ -150,25 +150,33 @@ void VariablesIndex::read_checkpointable_object_graph() {
 
     FRONT_END_GENERAL_CHECK(entry.slices().empty(), "CMO: Slices are not supported");
 
-    auto shard = m_data_files.find(entry.shard_id());
-    FRONT_END_GENERAL_CHECK(shard != m_data_files.end(), "CMO: data files isn't found");
-
-    std::vector<char> data(entry.size());
     ::tensorflow::TrackableObjectGraph tog;
 
     // TODO: have to understand this offset
     // It looks like reinterpret_cast artifact
     // https://github.com/tensorflow/tensorflow/blob/d90f1947ebcf510b23c238f43c2191e5b3817cb3/tensorflow/cc/experimental/libexport/load.cc#L70
     int chg = 6;
-    shard->second->seekg(entry.offset() + chg);
-    shard->second->read(data.data(), entry.size() - chg);
 
     // Might be need to remove this verification:
     // https://github.com/tensorflow/tensorflow/blob/d90f1947ebcf510b23c238f43c2191e5b3817cb3/tensorflow/cc/experimental/libexport/load.cc#L73
     // FRONT_END_GENERAL_CHECK(tog.ParseFromArray(data.data(), static_cast<int>(data.size()) - chg), "CMO: Trackable
     // Object Graph couldn't be read");
 
-    tog.ParseFromArray(data.data(), static_cast<int>(data.size()) - chg);
+    if (m_mmap_enabled) {
+        auto mapped_memory = get_data_mmap(entry.shard_id());
+        FRONT_END_GENERAL_CHECK(mapped_memory.get(), "CMO: data files isn't found");
+        FRONT_END_GENERAL_CHECK(static_cast<size_t>(entry.offset() + entry.size()) <= mapped_memory->size(),
+                                "CMO: Trackable Object Graph is out of data file bounds");
+        tog.ParseFromArray(mapped_memory->data() + entry.offset() + chg, static_cast<int>(entry.size()) - chg);
+    } else {
+        auto shard = m_data_files.find(entry.shard_id());
+        FRONT_END_GENERAL_CHECK(shard != m_data_files.end(), "CMO: data files isn't found");
+
+        std::vector<char> data(entry.size());
+        shard->second->seekg(entry.offset() + chg);
+        shard->second->read(data.data(), entry.size() - chg);
+        tog.ParseFromArray(data.data(), static_cast<int>(data.size()) - chg);
+    }
 
     for (const auto& node : tog.nodes()) {
         for (const auto& attr : node.attributes()) {
@@ -191,9 +199,14 @@ bool VariablesIndex::read_variables(std::ifstream& vi_stream, const std::string&
         } else {
             fullPath = path + "." + suffix.data();
         }
-        m_data_files[shard] = std::shared_ptr<std::ifstream>(
-            new std::ifstream(fullPath.c_str(), std::ifstream::in | std::ifstream::binary));
-        FRONT_END_GENERAL_CHECK(m_data_files[shard]->is_open(), "Variable index data file does not exist");
+        if (m_mmap_enabled) {
+            FRONT_END_GENERAL_CHECK(ov::util::file_exists(fullPath), "Variable index data file does not exist");
+            m_mmap_data_files[shard] = ov::load_mmap_object(fullPath);
+        } else {
+            m_data_files[shard] = std::shared_ptr<std::ifstream>(
+                new std::ifstream(fullPath.c_str(), std::ifstream::in | std::ifstream::binary));
+            FRONT_END_GENERAL_CHECK(m_data_files[shard]->is_open(), "Variable index data file does not exist");
+        }
     }
 
     read_checkpointable_object_graph();
@@ -215,9 +228,14 @@ bool VariablesIndex::read_variables(std::ifstream& vi_stream, const std::wstring
         } else {
             fullPath = path + L"." + suffix.data();
         }
-        m_data_files[shard] = std::shared_ptr<std::ifstream>(
-            new std::ifstream(fullPath.c_str(), std::ifstream::in | std::ifstream::binary));
-        FRONT_END_GENERAL_CHECK(m_data_files[shard]->is_open(), "Variable index data file does not exist");
+        if (m_mmap_enabled) {
+            FRONT_END_GENERAL_CHECK(ov::util::file_exists(fullPath), "Variable index data file does not exist");
+            m_mmap_data_files[shard] = ov::load_mmap_object(fullPath);
+        } else {
+            m_data_files[shard] = std::shared_ptr<std::ifstream>(
+                new std::ifstream(fullPath.c_str(), std::ifstream::in | std::ifstream::binary));
+            FRONT_END_GENERAL_CHECK(m_data_files[shard]->is_open(), "Variable index data file does not exist");
+        }
     }
 
     read_checkpointable_object_graph();
@@ -8,6 +8,7 @@
 
 #include "graph_iterator_proto.hpp"
 #include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
 #include "saved_model.pb.h"
 
 namespace ov {
@@ -26,10 +27,19 @@ class VariablesIndex {
     std::map<std::string, std::vector<char>> m_variables_index;
     // List of opened data files for using with BundleEntryProto
     std::map<int32_t, std::shared_ptr<std::ifstream>> m_data_files;
+    // List of memory mapped data files for using with BundleEntryProto (used if mmap is enabled)
+    std::map<int32_t, std::shared_ptr<ov::MappedMemory>> m_mmap_data_files;
+    // Shows data files are memory mapped instead of being opened as streams
+    bool m_mmap_enabled;
     // List of mapped variables which could be read using TrackableObjectGraph
     std::map<std::string, std::string> m_variables_map;
 
 public:
+    /// \brief Constructs variables index
+    /// \param mmap_enabled Map data files into memory instead of reading them thru streams, in this case
+    /// variables data isn't copied and constants refer to the mapped memory directly
+    explicit VariablesIndex(const bool mmap_enabled = true) : m_mmap_enabled(mmap_enabled) {}
+
     /// \brief Reads variables from opened variable index file. Can cause an asserts in case of issues.
     /// \param vi_stream Opened stream file, file pointer doesn't matter, it will be rewind internally.
     /// \param path A path to file with variables data
@@ -93,6 +103,20 @@ public:
         return result != m_data_files.end() ? result->second : nullptr;
     }
 
+    /// \brief Returns mapped memory of a requested shard_id, or nullptr in case of shard_id isn't found or
+    /// memory mapping is disabled
+    /// \param shard_id Requested shard_id
+    /// \returns Valid shared_ptr with MappedMemory or with nullptr if shard isn't found
+    std::shared_ptr<ov::MappedMemory> get_data_mmap(const int32_t shard_id) const {
+        auto result = m_mmap_data_files.find(shard_id);
+        return result != m_mmap_data_files.end() ? result->second : nullptr;
+    }
+
+    /// \brief Returns true in case data files are memory mapped
+    bool is_mmap_enabled() const {
+        return m_mmap_enabled;
+    }
+
     /// \brief Adds variable mapping to the variables map
     /// \param var_name Variable full name (from .index file)
     /// \param map_name Mapped name
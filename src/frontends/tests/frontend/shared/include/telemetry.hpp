@@ -46,6 +46,8 @@ struct TelemetryFEParam {
     std::string m_modelsPath;
     std::string m_modelName;
     std::set<std::set<std::tuple<std::string, std::string, std::string, int>>> m_expected_events;
+    // action of the events reporting conversion time per op type, their values are not deterministic
+    std::string m_conversion_time_action;
 };
 
 class FrontEndTelemetryTest : public ::testing::TestWithParam<TelemetryFEParam> {
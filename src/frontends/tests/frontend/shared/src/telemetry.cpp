@@ -62,6 +62,25 @@ TEST_P(FrontEndTelemetryTest, TestTelemetryMock) {
         EXPECT_NO_THROW(m_frontEnd->add_extension(telemetry_extension));
         m_inputModel = m_frontEnd->load(m_param.m_modelName);
         function = m_frontEnd->convert(m_inputModel);
+        if (!m_param.m_conversion_time_action.empty()) {
+            // conversion time is reported once per converted op type, it is checked apart from the exact events
+            std::set<std::string> op_count_labels, conversion_time_labels;
+            for (auto it = m_test_telemetry.m_received_events.begin();
+                 it != m_test_telemetry.m_received_events.end();) {
+                if (std::get<1>(*it) == m_param.m_conversion_time_action) {
+                    EXPECT_GE(std::get<3>(*it), 0);
+                    conversion_time_labels.insert(std::get<2>(*it));
+                    it = m_test_telemetry.m_received_events.erase(it);
+                    m_test_telemetry.m_event_cnt--;
+                } else {
+                    if (std::get<1>(*it) == "op_count") {
+                        op_count_labels.insert(std::get<2>(*it));
+                    }
+                    ++it;
+                }
+            }
+            EXPECT_EQ(conversion_time_labels, op_count_labels) << "Conversion time is not reported for every op type.";
+        }
         bool is_found = false;
         for (const auto& m_expected_events : m_param.m_expected_events) {
             is_found = false;
@@ -69,6 +69,10 @@ public:
     void set_capacity(std::size_t newCapacity) {
         _capacity = newCapacity;
     }
+    // the size may be outdated as soon as it's returned if the queue is modified concurrently
+    size_t size() {
+        return _pqueue.size();
+    }
 
 protected:
     tbb::concurrent_priority_queue<T, std::greater<T>> _pqueue;
@@ -133,6 +137,10 @@ public:
         std::lock_guard<std::mutex> lock(_mutex);
         _capacity = newCapacity;
     }
+    size_t size() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _queue.size();
+    }
 
 protected:
     std::priority_queue<T, std::vector<T>, std::greater<T>> _queue;
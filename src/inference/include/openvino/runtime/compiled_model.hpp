@@ -20,6 +20,7 @@
 #include "openvino/runtime/infer_request.hpp"
 #include "openvino/runtime/properties.hpp"
 #include "openvino/runtime/remote_context.hpp"
+#include "openvino/runtime/streaming_session.hpp"
 
 namespace ov {
 
@@ -147,6 +148,25 @@ public:
      */
     InferRequest create_infer_request();
 
+    /**
+     * @brief Creates a streaming session that runs the compiled model over the only input chunk by chunk.
+     * The session creates its own inference request.
+     *
+     * @param axis Streaming axis of the input, the input must have a static shape.
+     * @return StreamingSession object
+     */
+    StreamingSession create_streaming_session(size_t axis = 0);
+
+    /**
+     * @brief Creates a streaming session that runs the compiled model over the input chunk by chunk.
+     * The session creates its own inference request.
+     *
+     * @param tensor_name Name of the streamed input.
+     * @param axis Streaming axis of the input, the input must have a static shape.
+     * @return StreamingSession object
+     */
+    StreamingSession create_streaming_session(const std::string& tensor_name, size_t axis = 0);
+
     /**
      * @brief Exports the current compiled model to an output stream `std::ostream`.
      * The exported model can also be imported via the ov::Core::import_model method.
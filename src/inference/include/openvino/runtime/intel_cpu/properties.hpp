@@ -63,5 +63,50 @@ static constexpr Property<bool> denormals_optimization{"CPU_DENORMALS_OPTIMIZATI
  */
 static constexpr Property<float> sparse_weights_decompression_rate{"CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE"};
 
+/**
+ * @brief This property defines whether weights and intermediate tensors are allocated on huge pages
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * Large buffers are aligned to the huge page size and advised to be backed by transparent huge pages, which reduces
+ * TLB misses for models with large weights or activations. The property has effect on Linux only and requires THP
+ * to be enabled in `madvise` or `always` mode.
+ *
+ * @code
+ * core.set_property(ov::intel_cpu::huge_pages(true));
+ * @endcode
+ */
+static constexpr Property<bool> huge_pages{"CPU_HUGE_PAGES"};
+
+/**
+ * @brief This property defines whether the memory of the compiled model is explicitly placed on NUMA nodes
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * Weights and intermediate tensors of a stream are bound to the NUMA node of the stream. Weights shared by streams
+ * running on several NUMA nodes, as well as the memory of a stream spanning several NUMA nodes, are interleaved
+ * across these nodes. The property has effect on Linux only.
+ *
+ * @code
+ * core.set_property(ov::intel_cpu::numa_memory_placement(true));
+ * @endcode
+ */
+static constexpr Property<bool> numa_memory_placement{"CPU_NUMA_MEMORY_PLACEMENT"};
+
+/**
+ * @brief This property defines whether NUMA nodes of the host are exposed as separate CPU devices
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * When enabled on a host with several NUMA nodes, ov::available_devices reports one device per NUMA node, so the node
+ * can be addressed by its id as `CPU.<node id>` and meta devices like AUTO and MULTI treat every node as a separate device.
+ * A model compiled for a NUMA node device runs its streams on the cores of the node only, and the weights are
+ * allocated by these streams. `CPU.<node id>` can be used regardless of the property.
+ *
+ * @code
+ * core.set_property("CPU", ov::intel_cpu::numa_sub_devices(true));
+ * auto compiled_model = core.compile_model(model, "AUTO:CPU",
+ *     ov::hint::performance_mode(ov::hint::PerformanceMode::CUMULATIVE_THROUGHPUT));
+ * @endcode
+ */
+static constexpr Property<bool> numa_sub_devices{"CPU_NUMA_SUB_DEVICES"};
+
 }  // namespace intel_cpu
 }  // namespace ov
@@ -690,6 +690,45 @@ static constexpr Property<bool, PropertyMutability::RW> force_tbb_terminate{"FOR
  */
 static constexpr Property<bool, PropertyMutability::RW> enable_mmap{"ENABLE_MMAP"};
 
+/**
+ * @brief Read-write property to enable caching of models converted from framework formats (ONNX, TensorFlow,
+ * PaddlePaddle, etc.) by `ov::Core::read_model`. Disabled by default.
+ * The converted model is stored as IR in the directory set by `ov::cache_dir` and the next `read_model` of the same
+ * source file reads this IR instead of running frontend conversion again. The cache entry is keyed by the content of
+ * the model file, size and modification time of the files the model refers to (ONNX external data, PaddlePaddle
+ * parameters), OpenVINO version and extensions loaded from libraries. ONNX, PaddlePaddle, TensorFlow Lite and frozen
+ * TensorFlow (*.pb) models are cached, and only when no extensions created by the application (e.g. ConversionExtension
+ * with a converter function) are added: they can't be told apart by the key.
+ *
+ * value type: boolean
+ *   - True enable caching of converted models (requires `ov::cache_dir` to be set)
+ *   - False disable caching of converted models
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<bool, PropertyMutability::RW> enable_read_model_cache{"ENABLE_READ_MODEL_CACHE"};
+
+/**
+ * @brief Read-write property to enable the pooling host memory allocator for tensors. Disabled by default.
+ * When enabled, tensors created with the default `ov::Allocator` reuse freed memory blocks of the same size class
+ * (per-thread caches backed by a process-wide pool), so dynamic-shape pipelines which create and destroy tensors
+ * per request don't hit the system allocator. The setting is process-wide and affects tensors created after the call.
+ *
+ * value type: boolean
+ *   - True enable the memory pool
+ *   - False disable the memory pool
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<bool, PropertyMutability::RW> enable_tensor_memory_pool{"ENABLE_TENSOR_MEMORY_POOL"};
+
+/**
+ * @brief Read-only property to get counters of the tensor memory pool, see `ov::enable_tensor_memory_pool`.
+ * Keys: "BYTES_CACHED" - size of free memory kept by the pool, "ALLOCATIONS" - number of allocations served by
+ * the pool, "HITS" - number of allocations served from cached memory.
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> tensor_memory_pool_statistics{
+    "TENSOR_MEMORY_POOL_STATISTICS"};
+
 /**
  * @brief Namespace with device properties
  */
@@ -0,0 +1,136 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file that provides StreamingSession.
+ *
+ * @file openvino/runtime/streaming_session.hpp
+ */
+#pragma once
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+
+#include "openvino/core/node_output.hpp"
+#include "openvino/runtime/common.hpp"
+#include "openvino/runtime/infer_request.hpp"
+#include "openvino/runtime/tensor.hpp"
+
+namespace ov {
+
+class CompiledModel;
+
+/**
+ * @brief This is a class of streaming session that runs a stateful model over an input of arbitrary length,
+ * e.g. long audio or time series.
+ * @ingroup ov_runtime_cpp_api
+ *
+ * The session owns an inference request together with its variable states. Chunks of input are accumulated along
+ * the streaming axis into frames of the length the model was compiled for. Complete frames are inferred
+ * asynchronously while the next frame is filled, results are delivered to the callback of the session.
+ */
+class OPENVINO_RUNTIME_API StreamingSession {
+    class Impl;
+    std::shared_ptr<Impl> _impl;
+
+    /**
+     * @brief Constructs StreamingSession streaming the input of the request.
+     * @param request Inference request the session owns.
+     * @param input Input of the compiled model the chunks are pushed to.
+     * @param axis Streaming axis of the input.
+     */
+    StreamingSession(const InferRequest& request, const ov::Output<const ov::Node>& input, size_t axis);
+    friend class ov::CompiledModel;
+
+public:
+    /**
+     * @brief Callback called when a frame is inferred.
+     * The request gives access to the output tensors until the callback returns, @p frames is the number of valid
+     * frames along the streaming axis, it's less than the frame length only for the incomplete frame of a flush.
+     */
+    using Callback = std::function<void(InferRequest& request, size_t frames)>;
+
+    /**
+     * @brief Variable states of the session at some point of the stream.
+     */
+    struct Snapshot {
+        std::map<std::string, Tensor> states;  //!< State tensors by variable name
+    };
+
+    /**
+     * @brief Default constructor.
+     */
+    StreamingSession() = default;
+
+    /**
+     * @brief Sets a callback std::function that is called from the inference thread for each inferred frame.
+     * @param callback Callback object.
+     */
+    void set_callback(Callback callback);
+
+    /**
+     * @brief Appends a chunk of the input.
+     * The chunk must have the element type and the shape of the input except the streaming axis, where it may have
+     * any length. Each completed frame is started right away, so the method waits only if the previous frame is
+     * still running when the next one is complete.
+     * @param chunk Chunk of the input.
+     */
+    void push(const Tensor& chunk);
+
+    /**
+     * @brief Infers the incomplete frame, padded with zeros, and waits for the results.
+     * The padding doesn't change the variable states: they are restored to the states after the complete frames.
+     * The incomplete frame stays in the session, the next chunks complete it and it's inferred again, so the
+     * results of its time steps are delivered once more. Each flush costs a copy of the states to keep them.
+     */
+    void flush();
+
+    /**
+     * @brief Waits for the frame being inferred.
+     */
+    void wait();
+
+    /**
+     * @brief Takes a snapshot of the variable states after the inferred frames.
+     * The states are copied once, the session may continue to stream after that.
+     * @return Snapshot of the states.
+     */
+    Snapshot snapshot();
+
+    /**
+     * @brief Restores the variable states from a snapshot and drops the incomplete frame.
+     * The tensors of the snapshot are passed to VariableState::set_state, which copies them into the memory of the
+     * states of the plugin, so restoring costs a copy of each state like snapshot() does. The snapshot is kept
+     * unchanged and may be restored again, e.g. to continue several streams from the same point.
+     * @param snapshot Snapshot taken from a session of the same compiled model.
+     */
+    void restore(const Snapshot& snapshot);
+
+    /**
+     * @brief Resets the variable states to the initial values and drops the incomplete frame.
+     */
+    void reset();
+
+    /**
+     * @brief Gets the inference request of the session, e.g. to set the inputs that are not streamed.
+     * @return Inference request.
+     */
+    InferRequest& get_infer_request();
+
+    /**
+     * @brief Checks if the current StreamingSession object is not initialized.
+     * @return True if the current StreamingSession object is not initialized; false, otherwise.
+     */
+    bool operator!() const noexcept;
+
+    /**
+     * @brief Checks if the current StreamingSession object is initialized.
+     * @return True if the current StreamingSession object is initialized; false, otherwise.
+     */
+    explicit operator bool() const noexcept;
+};
+
+}  // namespace ov
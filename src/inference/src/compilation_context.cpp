@@ -7,6 +7,8 @@
 #include <sys/stat.h>
 #include <sys/types.h>
 
+#include <fstream>
+
 #ifndef _WIN32
 #    include <unistd.h>
 #endif
@@ -159,6 +161,29 @@ std::string ModelCache::compute_hash(const std::string& modelName, const ov::Any
     return std::to_string(seed);
 }
 
+std::string ModelCache::compute_file_content_hash(const std::string& filePath, const ov::AnyMap& options) {
+    OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::IE_RT, "ModelCache::compute_file_content_hash");
+    std::ifstream stream(filePath, std::ios_base::binary);
+    OPENVINO_ASSERT(stream.is_open(), "Cannot open file ", filePath);
+
+    uint64_t seed = 0;
+    constexpr size_t chunk_size = 1 << 20;
+    std::string chunk(chunk_size, '\0');
+    while (stream) {
+        stream.read(&chunk[0], chunk_size);
+        const auto read_size = static_cast<size_t>(stream.gcount());
+        if (read_size == 0)
+            break;
+        chunk.resize(read_size);
+        seed = hash_combine(seed, chunk);
+    }
+
+    for (const auto& kvp : options) {
+        seed = hash_combine(seed, kvp.first + kvp.second.as<std::string>());
+    }
+    return std::to_string(seed);
+}
+
 std::string ModelCache::compute_hash(const std::string& modelStr,
                                      const ov::Tensor& tensor,
                                      const ov::AnyMap& compileOptions) {
@@ -32,6 +32,8 @@ struct ModelCache final {
     static std::string compute_hash(const std::string& modeStr,
                                     const ov::Tensor& data,
                                     const ov::AnyMap& compileOptions);
+
+    static std::string compute_file_content_hash(const std::string& filePath, const ov::AnyMap& options);
 };
 
 class CompiledBlobHeader final {
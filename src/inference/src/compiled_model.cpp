@@ -106,6 +106,14 @@ InferRequest CompiledModel::create_infer_request() {
     OV_COMPILED_MODEL_CALL_STATEMENT(return {_impl->create_infer_request(), _so});
 }
 
+StreamingSession CompiledModel::create_streaming_session(size_t axis) {
+    return {create_infer_request(), input(), axis};
+}
+
+StreamingSession CompiledModel::create_streaming_session(const std::string& tensor_name, size_t axis) {
+    return {create_infer_request(), input(tensor_name), axis};
+}
+
 void CompiledModel::export_model(std::ostream& networkModel) {
     OV_COMPILED_MODEL_CALL_STATEMENT(_impl->export_model(networkModel));
 }
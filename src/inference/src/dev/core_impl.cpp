@@ -4,7 +4,15 @@
 
 #include "core_impl.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
 #include <memory>
+#include <random>
+#include <set>
+#include <sstream>
+#include <thread>
+#include <typeinfo>
 
 #include "any_copy.hpp"
 #include "check_network_batchable.hpp"
@@ -27,15 +35,21 @@
 #include "openvino/core/preprocess/pre_post_process.hpp"
 #include "openvino/core/so_extension.hpp"
 #include "openvino/core/version.hpp"
+#include "openvino/frontend/extension/conversion.hpp"
+#include "openvino/frontend/extension/progress_reporter.hpp"
+#include "openvino/frontend/extension/telemetry.hpp"
 #include "openvino/pass/manager.hpp"
+#include "openvino/pass/serialize.hpp"
 #include "openvino/runtime/device_id_parser.hpp"
 #include "openvino/runtime/icompiled_model.hpp"
 #include "openvino/runtime/itensor.hpp"
+#include "openvino/runtime/memory_pool.hpp"
 #include "openvino/runtime/make_tensor.hpp"
 #include "openvino/runtime/remote_context.hpp"
 #include "openvino/runtime/threading/executor_manager.hpp"
 #include "openvino/util/common_util.hpp"
 #include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
 #include "openvino/util/shared_object.hpp"
 #include "ov_plugins.hpp"
 #include "preprocessing/preprocessing.hpp"
@@ -223,6 +237,96 @@ void clean_batch_properties(const std::string& deviceName, ov::AnyMap& config, c
         }
     }
 }
+
+// Identity of the extension which may change the result of frontend conversion: its type and parameters and
+// the module implementing it, so rebuilt extension libraries produce another key.
+// Returns false for extensions created by the application itself (e.g. ConversionExtension with a lambda):
+// converters of the same type and operation may behave differently, so the converted model can't be reused.
+bool get_extension_identity(const ov::Extension::Ptr& extension, std::string& identity) {
+    identity.clear();
+    auto ext = extension;
+    auto so_ext = std::dynamic_pointer_cast<ov::detail::SOExtension>(ext);
+    if (so_ext)
+        ext = so_ext->extension();
+    // these extensions only observe the conversion
+    if (std::dynamic_pointer_cast<ov::frontend::TelemetryExtension>(ext) ||
+        std::dynamic_pointer_cast<ov::frontend::ProgressReporterExtension>(ext))
+        return true;
+    if (!so_ext)
+        return false;
+
+    const auto& type = typeid(*ext);
+    std::stringstream stream;
+    stream << type.name() << ":" << ov::ModelCache::calculate_file_info(ov::util::get_module_path(&type));
+    if (auto op_ext = std::dynamic_pointer_cast<ov::BaseOpExtension>(ext)) {
+        stream << ":" << op_ext->get_type_info();
+    } else if (auto conversion_ext = std::dynamic_pointer_cast<ov::frontend::ConversionExtensionBase>(ext)) {
+        stream << ":" << conversion_ext->get_op_type();
+    }
+    identity = stream.str();
+    return true;
+}
+
+std::string get_extension_identity(const InferenceEngine::IExtensionPtr& extension) {
+    const auto& type = typeid(*extension);
+    std::stringstream identity;
+    identity << type.name() << ":" << ov::ModelCache::calculate_file_info(ov::util::get_module_path(&type));
+    const InferenceEngine::Version* version = nullptr;
+    extension->GetVersion(version);
+    if (version) {
+        identity << ":" << version->buildNumber << ":" << version->description;
+    }
+    return identity.str();
+}
+
+// Locations of ONNX external data are stored as StringStringEntryProto{key: "location", value: <path>}, which is
+// serialized as 0x0A, 8, "location", 0x12, <varint length of the path>, <path>
+void find_onnx_external_data(const std::string& model_path, std::set<std::string>& locations) {
+    const auto mapped = ov::load_mmap_object(model_path);
+    const char* const end = mapped->data() + mapped->size();
+    static const std::string location_key("\x0A\x08location\x12", 11);
+    const char* it = mapped->data();
+    while ((it = std::search(it, end, location_key.begin(), location_key.end())) != end) {
+        it += location_key.size();
+        uint64_t length = 0;
+        for (size_t shift = 0; it != end && shift < 64; shift += 7) {
+            const auto byte = static_cast<uint8_t>(*it++);
+            length |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0)
+                break;
+        }
+        if (length > static_cast<uint64_t>(end - it))
+            break;
+        locations.emplace(it, static_cast<size_t>(length));
+        it += length;
+    }
+}
+
+// Frontends read weights from the files next to the model: ONNX external data and PaddlePaddle parameters.
+// Only these files are a part of the key. Returns false for formats with unknown side files, such models
+// are not cached.
+bool get_model_side_files_info(const std::string& model_path, std::string& info) {
+    const auto ext = ov::util::to_lower(FileUtils::fileExt(model_path));
+    std::set<std::string> side_files;
+    if (ext == "onnx") {
+        std::set<std::string> locations;
+        find_onnx_external_data(model_path, locations);
+        const auto model_dir = ov::util::get_directory(ov::util::get_absolute_file_path(model_path));
+        for (const auto& location : locations) {
+            side_files.insert(ov::util::path_join({model_dir, location}));
+        }
+    } else if (ext == "pdmodel") {
+        side_files.insert(model_path.substr(0, model_path.size() - ext.size()) + "pdiparams");
+    } else if (ext != "tflite" && ext != "pb") {
+        return false;
+    }
+
+    info.clear();
+    for (const auto& file : side_files) {
+        info += ov::ModelCache::calculate_file_info(file) + ";";
+    }
+    return true;
+}
 }  // namespace
 
 bool ov::is_config_applicable(const std::string& user_device_name, const std::string& subprop_device_name) {
@@ -1166,6 +1270,16 @@ ov::Any ov::CoreImpl::get_property_for_core(const std::string& name) const {
     } else if (name == ov::enable_mmap.name()) {
         const auto flag = coreConfig.get_enable_mmap();
         return decltype(ov::enable_mmap)::value_type(flag);
+    } else if (name == ov::enable_read_model_cache.name()) {
+        const auto flag = coreConfig.get_enable_read_model_cache();
+        return decltype(ov::enable_read_model_cache)::value_type(flag);
+    } else if (name == ov::enable_tensor_memory_pool.name()) {
+        return decltype(ov::enable_tensor_memory_pool)::value_type(ov::util::is_memory_pool_enabled());
+    } else if (name == ov::tensor_memory_pool_statistics.name()) {
+        const auto statistics = ov::util::get_memory_pool_statistics();
+        return decltype(ov::tensor_memory_pool_statistics)::value_type{{"BYTES_CACHED", statistics.bytes_cached},
+                                                                        {"ALLOCATIONS", statistics.allocations},
+                                                                        {"HITS", statistics.hits}};
     }
 
     OPENVINO_THROW("Exception is thrown while trying to call get_property with unsupported property: '", name, "'");
@@ -1560,6 +1674,19 @@ void ov::CoreImpl::CoreConfig::set_and_update(ov::AnyMap& config) {
         _flag_enable_mmap = flag;
         config.erase(it);
     }
+
+    it = config.find(ov::enable_read_model_cache.name());
+    if (it != config.end()) {
+        auto flag = it->second.as<bool>();
+        _flag_enable_read_model_cache = flag;
+        config.erase(it);
+    }
+
+    it = config.find(ov::enable_tensor_memory_pool.name());
+    if (it != config.end()) {
+        ov::util::set_memory_pool_enabled(it->second.as<bool>());
+        config.erase(it);
+    }
 }
 
 void ov::CoreImpl::CoreConfig::set_cache_dir_for_device(const std::string& dir, const std::string& name) {
@@ -1576,6 +1703,10 @@ bool ov::CoreImpl::CoreConfig::get_enable_mmap() const {
     return _flag_enable_mmap;
 }
 
+bool ov::CoreImpl::CoreConfig::get_enable_read_model_cache() const {
+    return _flag_enable_read_model_cache;
+}
+
 // Creating thread-safe copy of config including shared_ptr to ICacheManager
 // Passing empty or not-existing name will return global cache config
 ov::CoreImpl::CoreConfig::CacheConfig ov::CoreImpl::CoreConfig::get_cache_config_for_device(
@@ -1629,9 +1760,94 @@ void ov::CoreImpl::add_mutex(const std::string& dev_name) {
 
 std::shared_ptr<ov::Model> ov::CoreImpl::read_model(const std::string& modelPath, const std::string& binPath) const {
     OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::IE_RT, "CoreImpl::read_model from file");
+    // IR is read directly, caching makes sense only for models which require frontend conversion
+    if (coreConfig.get_enable_read_model_cache() && binPath.empty() && FileUtils::fileExt(modelPath) != "xml") {
+        const auto cache_dir = coreConfig.get_cache_dir();
+        if (!cache_dir.empty()) {
+            return read_model_with_cache(modelPath, cache_dir);
+        }
+    }
     return ReadNetwork(modelPath, binPath).getFunction();
 }
 
+std::shared_ptr<ov::Model> ov::CoreImpl::read_model_with_cache(const std::string& model_path,
+                                                               const std::string& cache_dir) const {
+    OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::IE_RT, "CoreImpl::read_model_with_cache");
+    // model given as a directory (e.g. TensorFlow SavedModel) has no content to hash
+    if (ov::util::directory_exists(model_path)) {
+        return ReadNetwork(model_path, std::string()).getFunction();
+    }
+
+    // Converted model depends on the frontends version and on extensions which can change conversion rules
+    std::string extensions;
+    for (const auto& extension : ov_extensions) {
+        std::string identity;
+        if (!get_extension_identity(extension, identity)) {
+            return ReadNetwork(model_path, std::string()).getFunction();
+        }
+        extensions += identity + ";";
+    }
+    for (const auto& extension : this->extensions) {
+        extensions += get_extension_identity(extension) + ";";
+    }
+
+    std::string hash;
+    try {
+        std::string side_files;
+        if (get_model_side_files_info(model_path, side_files)) {
+            hash = ov::ModelCache::compute_file_content_hash(
+                model_path,
+                {{"OV_VERSION", std::string(ov::get_openvino_version().buildNumber)},
+                 {"EXTENSIONS", extensions},
+                 {"SIDE_FILES", side_files}});
+        }
+    } catch (...) {
+        // model file can't be read, the frontend reports the error
+    }
+    if (hash.empty()) {
+        return ReadNetwork(model_path, std::string()).getFunction();
+    }
+
+    const auto xml_path = FileUtils::makePath(cache_dir, hash + ".xml");
+    const auto bin_path = FileUtils::makePath(cache_dir, hash + ".bin");
+
+    std::unique_ptr<CacheGuardEntry> lock = cacheGuard.get_hash_lock(hash);
+    if (FileUtils::fileExist(xml_path) && FileUtils::fileExist(bin_path)) {
+        try {
+            return ReadNetwork(xml_path, bin_path).getFunction();
+        } catch (...) {
+            // broken or incompatible cache entry, fallback to conversion and overwrite it
+        }
+    }
+
+    auto model = ReadNetwork(model_path, std::string()).getFunction();
+
+    // IR is written to temporary files and renamed afterwards, so a partially written entry is never read.
+    // Names of the temporary files are unique, so processes and threads writing the same entry don't clobber them.
+    std::stringstream tmp_suffix;
+    tmp_suffix << "." << std::this_thread::get_id() << "." << std::random_device{}() << "."
+               << std::chrono::steady_clock::now().time_since_epoch().count() << ".tmp";
+    const auto xml_tmp_path = xml_path + tmp_suffix.str();
+    const auto bin_tmp_path = bin_path + tmp_suffix.str();
+    try {
+        ov::pass::Manager manager;
+        manager.register_pass<ov::pass::Serialize>(xml_tmp_path, bin_tmp_path);
+        manager.run_passes(model);
+        std::remove(xml_path.c_str());
+        std::remove(bin_path.c_str());
+        // xml is renamed last, so its presence means the entry is complete
+        if (std::rename(bin_tmp_path.c_str(), bin_path.c_str()) != 0 ||
+            std::rename(xml_tmp_path.c_str(), xml_path.c_str()) != 0) {
+            std::remove(bin_path.c_str());
+        }
+    } catch (...) {
+        // model can't be serialized (e.g. it contains custom operations), just don't cache it
+    }
+    std::remove(xml_tmp_path.c_str());
+    std::remove(bin_tmp_path.c_str());
+    return model;
+}
+
 std::shared_ptr<ov::Model> ov::CoreImpl::read_model(const std::string& model,
                                                     const ov::Tensor& weights,
                                                     bool frontendMode) const {
@@ -91,6 +91,8 @@ private:
 
         bool get_enable_mmap() const;
 
+        bool get_enable_read_model_cache() const;
+
         // Creating thread-safe copy of config including shared_ptr to ICacheManager
         // Passing empty or not-existing name will return global cache config
         CacheConfig get_cache_config_for_device(const ov::Plugin& plugin, ov::AnyMap& parsedConfig) const;
@@ -100,6 +102,7 @@ private:
         CacheConfig _cacheConfig;
         std::map<std::string, CacheConfig> _cacheConfigPerDevice;
         bool _flag_enable_mmap = true;
+        bool _flag_enable_read_model_cache = false;
     };
 
     struct CacheContent {
@@ -161,6 +164,9 @@ private:
                                                           const ov::SoPtr<ov::IRemoteContext>& context,
                                                           const CacheContent& cacheContent) const;
 
+    std::shared_ptr<ov::Model> read_model_with_cache(const std::string& model_path,
+                                                     const std::string& cache_dir) const;
+
     static ov::SoPtr<ov::ICompiledModel> load_model_from_cache(
         const CacheContent& cacheContent,
         ov::Plugin& plugin,
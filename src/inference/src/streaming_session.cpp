@@ -0,0 +1,251 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/runtime/streaming_session.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <functional>
+#include <numeric>
+
+#include "openvino/core/except.hpp"
+#include "openvino/core/node.hpp"
+
+#define OV_STREAMING_SESSION_CALL_STATEMENT(...)                                \
+    OPENVINO_ASSERT(_impl != nullptr, "StreamingSession was not initialized."); \
+    __VA_ARGS__;
+
+namespace ov {
+
+class StreamingSession::Impl {
+public:
+    Impl(const InferRequest& request, const ov::Output<const ov::Node>& input, size_t axis)
+        : m_request(request),
+          m_input(input),
+          m_axis(axis) {
+        const auto& shape = m_input.get_partial_shape();
+        OPENVINO_ASSERT(shape.is_static(),
+                        "Streaming session requires a static shape of the input '",
+                        m_input.get_any_name(),
+                        "', got ",
+                        shape);
+        m_shape = shape.to_shape();
+        OPENVINO_ASSERT(m_axis < m_shape.size(),
+                        "Streaming axis ",
+                        m_axis,
+                        " is out of the rank of the input '",
+                        m_input.get_any_name(),
+                        "' ",
+                        m_shape);
+        const auto& type = m_input.get_element_type();
+        OPENVINO_ASSERT(type.bitwidth() % 8 == 0, "Streaming session doesn't support element type ", type);
+
+        m_frame_length = m_shape[m_axis];
+        m_outer = std::accumulate(m_shape.begin(), m_shape.begin() + m_axis, size_t{1}, std::multiplies<size_t>());
+        m_slice_size = type.size() *
+                       std::accumulate(m_shape.begin() + m_axis + 1, m_shape.end(), size_t{1}, std::multiplies<size_t>());
+        // the frame is filled in one buffer while the request infers the other one
+        for (auto& frame : m_frames) {
+            frame = Tensor(type, m_shape);
+        }
+
+        m_request.set_callback([this](std::exception_ptr ex) {
+            if (!ex && m_callback) {
+                m_callback(m_request, m_running_frames);
+            }
+        });
+    }
+
+    ~Impl() {
+        try {
+            wait();
+        } catch (...) {
+        }
+        // the callback refers to the session
+        m_request.set_callback([](std::exception_ptr) {});
+    }
+
+    void set_callback(Callback callback) {
+        wait();
+        m_callback = std::move(callback);
+    }
+
+    void push(const Tensor& chunk) {
+        OPENVINO_ASSERT(chunk.get_element_type() == m_input.get_element_type(),
+                        "Chunk element type ",
+                        chunk.get_element_type(),
+                        " doesn't match the input element type ",
+                        m_input.get_element_type());
+        OPENVINO_ASSERT(chunk.is_continuous(), "Chunk must be a continuous tensor");
+        const auto& shape = chunk.get_shape();
+        bool compatible = shape.size() == m_shape.size();
+        for (size_t i = 0; compatible && i < shape.size(); i++) {
+            compatible = i == m_axis || shape[i] == m_shape[i];
+        }
+        OPENVINO_ASSERT(compatible,
+                        "Chunk shape ",
+                        shape,
+                        " doesn't match the input shape ",
+                        m_shape,
+                        " except the streaming axis ",
+                        m_axis);
+
+        const auto length = shape[m_axis];
+        const auto src = static_cast<const uint8_t*>(chunk.data());
+        for (size_t offset = 0; offset < length;) {
+            const auto count = std::min(length - offset, m_frame_length - m_filled);
+            auto dst = static_cast<uint8_t*>(m_frames[m_current].data());
+            for (size_t o = 0; o < m_outer; o++) {
+                std::memcpy(dst + (o * m_frame_length + m_filled) * m_slice_size,
+                            src + (o * length + offset) * m_slice_size,
+                            count * m_slice_size);
+            }
+            m_filled += count;
+            offset += count;
+            if (m_filled == m_frame_length) {
+                submit();
+            }
+        }
+    }
+
+    void flush() {
+        wait();
+        if (m_filled != 0) {
+            // the input shape is static, so the incomplete frame is inferred padded with zeros, then the states are
+            // restored, so the padding never gets into them. The frame stays filled and is inferred again once the
+            // following chunks complete it.
+            const auto states = snapshot();
+            auto dst = static_cast<uint8_t*>(m_frames[m_current].data());
+            const auto tail = (m_frame_length - m_filled) * m_slice_size;
+            for (size_t o = 0; o < m_outer; o++) {
+                std::memset(dst + (o * m_frame_length + m_filled) * m_slice_size, 0, tail);
+            }
+            m_request.set_tensor(m_input, m_frames[m_current]);
+            m_running_frames = m_filled;
+            m_request.start_async();
+            m_running = true;
+            wait();
+            set_states(states);
+        }
+    }
+
+    void wait() {
+        if (m_running) {
+            m_running = false;
+            m_request.wait();
+        }
+    }
+
+    Snapshot snapshot() {
+        wait();
+        Snapshot snapshot;
+        for (auto&& state : m_request.query_state()) {
+            const auto tensor = state.get_state();
+            Tensor copy(tensor.get_element_type(), tensor.get_shape());
+            tensor.copy_to(copy);
+            snapshot.states.emplace(state.get_name(), std::move(copy));
+        }
+        return snapshot;
+    }
+
+    void restore(const Snapshot& snapshot) {
+        wait();
+        set_states(snapshot);
+        m_filled = 0;
+    }
+
+    void reset() {
+        wait();
+        for (auto&& state : m_request.query_state()) {
+            state.reset();
+        }
+        m_filled = 0;
+    }
+
+    InferRequest& get_infer_request() {
+        return m_request;
+    }
+
+private:
+    void set_states(const Snapshot& snapshot) {
+        for (auto&& state : m_request.query_state()) {
+            const auto it = snapshot.states.find(state.get_name());
+            OPENVINO_ASSERT(it != snapshot.states.end(), "Snapshot has no state of variable '", state.get_name(), "'");
+            state.set_state(it->second);
+        }
+    }
+
+    void submit() {
+        wait();
+        m_request.set_tensor(m_input, m_frames[m_current]);
+        m_running_frames = m_filled;
+        m_request.start_async();
+        m_running = true;
+        m_current ^= 1;
+        m_filled = 0;
+    }
+
+    InferRequest m_request;
+    ov::Output<const ov::Node> m_input;
+    size_t m_axis;
+    Shape m_shape;
+    size_t m_frame_length = 0;
+    // number of blocks before the streaming axis and byte size of a step along it
+    size_t m_outer = 0;
+    size_t m_slice_size = 0;
+
+    std::array<Tensor, 2> m_frames;
+    size_t m_current = 0;
+    size_t m_filled = 0;
+
+    bool m_running = false;
+    size_t m_running_frames = 0;
+    Callback m_callback;
+};
+
+StreamingSession::StreamingSession(const InferRequest& request, const ov::Output<const ov::Node>& input, size_t axis)
+    : _impl{std::make_shared<Impl>(request, input, axis)} {}
+
+void StreamingSession::set_callback(Callback callback) {
+    OV_STREAMING_SESSION_CALL_STATEMENT(_impl->set_callback(std::move(callback)));
+}
+
+void StreamingSession::push(const Tensor& chunk) {
+    OV_STREAMING_SESSION_CALL_STATEMENT(_impl->push(chunk));
+}
+
+void StreamingSession::flush() {
+    OV_STREAMING_SESSION_CALL_STATEMENT(_impl->flush());
+}
+
+void StreamingSession::wait() {
+    OV_STREAMING_SESSION_CALL_STATEMENT(_impl->wait());
+}
+
+StreamingSession::Snapshot StreamingSession::snapshot() {
+    OV_STREAMING_SESSION_CALL_STATEMENT(return _impl->snapshot());
+}
+
+void StreamingSession::restore(const Snapshot& snapshot) {
+    OV_STREAMING_SESSION_CALL_STATEMENT(_impl->restore(snapshot));
+}
+
+void StreamingSession::reset() {
+    OV_STREAMING_SESSION_CALL_STATEMENT(_impl->reset());
+}
+
+InferRequest& StreamingSession::get_infer_request() {
+    OV_STREAMING_SESSION_CALL_STATEMENT(return _impl->get_infer_request());
+}
+
+bool StreamingSession::operator!() const noexcept {
+    return !_impl;
+}
+
+StreamingSession::operator bool() const noexcept {
+    return (!!_impl);
+}
+
+}  // namespace ov
@@ -4,7 +4,11 @@
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #include "cumulative_schedule.hpp"
+
+#include <algorithm>
+
 #include "async_infer_request.hpp"
+#include "openvino/runtime/device_id_parser.hpp"
 #include "plugin.hpp"
 
 // ------------------------------CumuSchedule----------------------------
@@ -47,21 +51,23 @@ void CumuSchedule::init() {
         // Generate contexts for loading each device
         m_p_ctput_loadcontext.reset(new AutoCompileContext[m_n_ctput_devicenums]);
         int idx = 0;
-        DeviceInformation cpu_device_information;
+        // the CPU may be represented by several devices, one per NUMA node
+        std::vector<DeviceInformation> cpu_devices_information;
         for (auto& device : valid_devices) {
             if (device.device_name.find("CPU") == std::string::npos) {
                 m_p_ctput_loadcontext[idx].m_device_info = device;
                 m_p_ctput_loadcontext[idx].m_device_info.config[ov::hint::performance_mode.name()] = ov::hint::PerformanceMode::THROUGHPUT;
                 idx++;
             } else {
-                cpu_device_information = device;
-                cpu_device_information.config.insert(
+                cpu_devices_information.push_back(device);
+                cpu_devices_information.back().config.insert(
                     {ov::affinity.name(), ov::Any(ov::Affinity::CORE).as<std::string>()});
             }
         }
-        if (!cpu_device_information.device_name.empty()) {
+        for (auto& cpu_device_information : cpu_devices_information) {
             m_p_ctput_loadcontext[idx].m_device_info = cpu_device_information;
             m_p_ctput_loadcontext[idx].m_device_info.config[ov::hint::performance_mode.name()] = ov::hint::PerformanceMode::THROUGHPUT;
+            idx++;
         }
     }
     if (m_context->m_log_tag == "MULTI") {
@@ -118,8 +124,7 @@ void CumuSchedule::init() {
         auto* context_ptr = &m_p_ctput_loadcontext[i];
         auto model = m_context->m_model;
         m_p_ctput_loadcontext[i].m_task = std::bind(load_device_task, context_ptr, model);
-        if (i == m_n_ctput_devicenums - 1 &&
-            m_p_ctput_loadcontext[i].m_device_info.device_name.find("CPU") != std::string::npos) {
+        if (m_p_ctput_loadcontext[i].m_device_info.device_name.find("CPU") != std::string::npos) {
             cpu_loads.push_back(m_p_ctput_loadcontext[i].m_task);
         } else {
             other_devices_loads.push_back(m_p_ctput_loadcontext[i].m_task);
@@ -220,11 +225,15 @@ bool CumuSchedule::schedule_to_worker_infer_request(ov::threading::Task pipeline
         devices = m_context->m_device_priorities;
     }
     lock.unlock();
+    if (preferred_device.empty()) {
+        balance_sub_devices(devices);
+    }
     for (auto&& device : devices) {
         if (!preferred_device.empty() && (device.device_name != preferred_device)) {
             continue;
         }
-        if (run_pipeline_task(pipeline_task, m_idle_worker_requests[device.device_name], preferred_device)) {
+        // the containers are created before the first inference, lookups must not insert from concurrent threads
+        if (run_pipeline_task(pipeline_task, m_idle_worker_requests.at(device.device_name), preferred_device)) {
             return true;
         }
     }
@@ -237,6 +246,40 @@ bool CumuSchedule::schedule_to_worker_infer_request(ov::threading::Task pipeline
     return false;
 }
 
+void CumuSchedule::balance_sub_devices(std::vector<DeviceInformation>& devices) {
+    // the sizes are taken once, as they change concurrently and can't be used by the sort comparator
+    std::vector<std::pair<double, DeviceInformation>> idle_shares;
+    for (auto first = devices.begin(); first != devices.end();) {
+        const auto device_name = ov::DeviceIDParser(first->device_name).get_device_name();
+        const auto last = std::find_if(first, devices.end(), [&](const DeviceInformation& device) {
+            return ov::DeviceIDParser(device.device_name).get_device_name() != device_name;
+        });
+        if (std::distance(first, last) > 1) {
+            idle_shares.clear();
+            for (auto it = first; it != last; it++) {
+                const auto workers = m_worker_requests.find(it->device_name);
+                const auto idle_workers = m_idle_worker_requests.find(it->device_name);
+                double share = 0.0;
+                if (workers != m_worker_requests.end() && idle_workers != m_idle_worker_requests.end() &&
+                    !workers->second.empty()) {
+                    share = static_cast<double>(idle_workers->second.size()) / workers->second.size();
+                }
+                idle_shares.emplace_back(share, std::move(*it));
+            }
+            std::stable_sort(idle_shares.begin(),
+                             idle_shares.end(),
+                             [](const std::pair<double, DeviceInformation>& a, const std::pair<double, DeviceInformation>& b) {
+                                 return a.first > b.first;
+                             });
+            auto it = first;
+            for (auto& share : idle_shares) {
+                *it++ = std::move(share.second);
+            }
+        }
+        first = last;
+    }
+}
+
 CumuSchedule::~CumuSchedule() {
     if (m_context) {
         std::lock_guard<std::mutex> lock(m_context->m_fallback_mutex);
@@ -24,6 +24,9 @@ private:
     bool schedule_to_worker_infer_request(ov::threading::Task, DeviceName preferred_device = "") override;
     void try_to_compile_model(AutoCompileContext& context, const std::shared_ptr<ov::Model>& model) override;
     bool select_other_device(const std::string& cur_dev_name) override;
+    // orders sub-devices of the same device (e.g. NUMA nodes CPU.0, CPU.1) by the share of idle requests, so the
+    // least loaded one gets the next request, while different devices keep the order of their priorities
+    void balance_sub_devices(std::vector<DeviceInformation>& devices);
 };
 } // namespace auto_plugin
 } // namespace ov
@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
+
 #include "include/auto_unit_test.hpp"
 
 using namespace ov::mock_auto_plugin;
@@ -217,3 +219,48 @@ INSTANTIATE_TEST_SUITE_P(smoke_AutoCTPUTCallMulti,
                          AutoCTPUTCallMulti,
                          ::testing::ValuesIn(testConfigs_1),
                          AutoCTPUTCallMulti::getTestCaseName);
+
+using LoadNetworkWithCTPUTSubDevicesMockTest = LoadNetworkWithCTPUTMockTest;
+TEST_P(LoadNetworkWithCTPUTSubDevicesMockTest, CTPUTLoadAllCPUSubDevices) {
+    std::vector<std::string> targetDevices;
+    std::tie(targetDevices) = this->GetParam();
+
+    plugin->set_device_name("AUTO");
+    config.insert(ov::hint::performance_mode(ov::hint::PerformanceMode::CUMULATIVE_THROUGHPUT));
+    std::string targetDev;
+    for (auto& deviceName : targetDevices) {
+        targetDev += deviceName;
+        targetDev += ((deviceName == targetDevices.back()) ? "" : ",");
+        ON_CALL(*core,
+                compile_model(::testing::Matcher<const std::shared_ptr<const ov::Model>&>(_),
+                              ::testing::Matcher<const std::string&>(StrEq(deviceName)),
+                              _))
+            .WillByDefault(Return(deviceName.find("CPU") != std::string::npos ? mockExeNetwork
+                                                                                : mockExeNetworkActual));
+        // each CPU sub-device is loaded with its own streams
+        EXPECT_CALL(*core,
+                    compile_model(::testing::Matcher<const std::shared_ptr<const ov::Model>&>(_),
+                                  ::testing::Matcher<const std::string&>(deviceName),
+                                  ::testing::Matcher<const ov::AnyMap&>(
+                                      ComparePerfHint(ov::hint::PerformanceMode::THROUGHPUT))))
+            .Times(1);
+    }
+    config.insert(ov::device::priorities(targetDev));
+
+    ASSERT_NO_THROW(plugin->compile_model(model, config));
+}
+
+const std::vector<ConfigParams> subDevicesTestConfigs = {
+    ConfigParams{{"CPU.0", "CPU.1"}},
+    ConfigParams{{"GPU", "CPU.0", "CPU.1"}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_AutoMock_CTPUTSubDevices,
+                         LoadNetworkWithCTPUTSubDevicesMockTest,
+                         ::testing::ValuesIn(subDevicesTestConfigs),
+                         [](const testing::TestParamInfo<ConfigParams>& obj) {
+                             // the test name can't contain the dot of the device id
+                             auto name = LoadNetworkWithCTPUTSubDevicesMockTest::getTestCaseName(obj);
+                             std::replace(name.begin(), name.end(), '.', '_');
+                             return name;
+                         });
@@ -7,6 +7,7 @@
 #include <string>
 #include <map>
 #include <algorithm>
+#include <cctype>
 
 #include "ie_plugin_config.hpp"
 #include "cpu/cpu_config.hpp"
@@ -17,6 +18,7 @@
 #include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
 #include "openvino/core/type/element_type_traits.hpp"
 #include "openvino/runtime/properties.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
 #include "utils/debug_capabilities.h"
 #include "cpu/x64/cpu_isa_traits.hpp"
 
@@ -129,6 +131,33 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             } else {
                 fcSparseWeiDecompressionRate = val_f;
             }
+        } else if (key == ov::intel_cpu::huge_pages.name()) {
+            if (val == PluginConfigParams::YES) {
+                hugePages = true;
+            } else if (val == PluginConfigParams::NO) {
+                hugePages = false;
+            } else {
+                IE_THROW() << "Wrong value " << val << "for property key " << ov::intel_cpu::huge_pages.name()
+                           << ". Expected only true/false." << std::endl;
+            }
+        } else if (key == ov::intel_cpu::numa_sub_devices.name()) {
+            if (val == PluginConfigParams::YES) {
+                numaSubDevices = true;
+            } else if (val == PluginConfigParams::NO) {
+                numaSubDevices = false;
+            } else {
+                IE_THROW() << "Wrong value " << val << "for property key " << ov::intel_cpu::numa_sub_devices.name()
+                           << ". Expected only true/false." << std::endl;
+            }
+        } else if (key == ov::intel_cpu::numa_memory_placement.name()) {
+            if (val == PluginConfigParams::YES) {
+                numaMemoryPlacement = true;
+            } else if (val == PluginConfigParams::NO) {
+                numaMemoryPlacement = false;
+            } else {
+                IE_THROW() << "Wrong value " << val << "for property key " << ov::intel_cpu::numa_memory_placement.name()
+                           << ". Expected only true/false." << std::endl;
+            }
         } else if (key == PluginConfigParams::KEY_PERF_COUNT) {
             if (val == PluginConfigParams::YES) collectPerfCounters = true;
             else if (val == PluginConfigParams::NO) collectPerfCounters = false;
@@ -154,10 +183,22 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             else
                 IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_LP_TRANSFORMS_MODE;
         } else if (key == ov::device::id.name()) {
-            device_id = val;
-            if (!device_id.empty()) {
-                IE_THROW() << "CPU plugin supports only '' as device id";
+            // sub-devices are the NUMA nodes of the host named by their ids, e.g. CPU.1 runs on NUMA node 1 only
+            int index = -1;
+            if (!val.empty()) {
+                const auto numaNodes = getAvailableNUMANodes();
+                if (std::all_of(val.begin(), val.end(), ::isdigit) && val.size() < 10)
+                    index = std::stoi(val);
+                if (std::find(numaNodes.begin(), numaNodes.end(), index) == numaNodes.end()) {
+                    std::string ids;
+                    for (const auto node : numaNodes)
+                        ids += (ids.empty() ? "" : ", ") + std::to_string(node);
+                    IE_THROW() << "CPU plugin supports only '' or an id of available NUMA node (" << ids
+                               << ") as device id, got '" << val << "'";
+                }
             }
+            device_id = val;
+            numaNodeIndex = index;
         } else if (key == PluginConfigParams::KEY_ENFORCE_BF16) {
             if (val == PluginConfigParams::YES) {
                 if (mayiuse(avx512_core)) {
@@ -50,7 +50,12 @@ struct Config {
     SnippetsMode snippetsMode = SnippetsMode::Enable;
     std::string dumpToDot = {};
     std::string device_id = {};
+    // index of the NUMA node the model runs on, -1 - all NUMA nodes
+    int numaNodeIndex = -1;
+    bool numaSubDevices = false;
     float fcSparseWeiDecompressionRate = 1.0f;
+    bool hugePages = false;
+    bool numaMemoryPlacement = false;
 #if defined(OPENVINO_ARCH_X86_64)
     size_t rtCacheCapacity = 5000ul;
 #else
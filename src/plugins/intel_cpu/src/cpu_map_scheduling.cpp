@@ -4,9 +4,12 @@
 
 #include "cpu_map_scheduling.hpp"
 
+#include <algorithm>
+
 #include "cpu_streams_calculation.hpp"
 #include "ie_parallel.hpp"
 #include "ie_system_conf.h"
+#include "openvino/core/except.hpp"
 
 namespace ov {
 namespace intel_cpu {
@@ -45,6 +48,26 @@ std::vector<std::vector<int>> apply_scheduling_core_type(ov::hint::SchedulingCor
     return result_table;
 }
 
+std::vector<std::vector<int>> apply_numa_node(const int numa_node_index,
+                                              const std::vector<std::vector<int>>& proc_type_table) {
+    if (numa_node_index < 0 || proc_type_table.size() == 1) {
+        return proc_type_table;
+    }
+
+    // the first row is the sum of the rows of all NUMA nodes, node ids may be neither contiguous nor ordered
+    const auto row = std::find_if(proc_type_table.begin() + 1,
+                                  proc_type_table.end(),
+                                  [&](const std::vector<int>& node_row) {
+                                      return node_row[PROC_NUMA_NODE_ID] == numa_node_index;
+                                  });
+    OPENVINO_ASSERT(row != proc_type_table.end(),
+                    "NUMA node ",
+                    numa_node_index,
+                    " is not found in the processors type table");
+
+    return {*row};
+}
+
 std::vector<std::vector<int>> apply_hyper_threading(bool& input_ht_hint,
                                                     const bool input_ht_changed,
                                                     const std::string input_pm_hint,
@@ -27,6 +27,15 @@ namespace intel_cpu {
 std::vector<std::vector<int>> apply_scheduling_core_type(ov::hint::SchedulingCoreType& input_type,
                                                          const std::vector<std::vector<int>>& proc_type_table);
 
+/**
+ * @brief      Limit available CPU resource in processors type table to the NUMA node of CPU sub-device
+ * @param[in]  numa_node_index id of NUMA node set via device id, -1 means all NUMA nodes.
+ * @param[in]  proc_type_table candidate processors available at this time
+ * @return     updated proc_type_table which contains the processors of the NUMA node only
+ */
+std::vector<std::vector<int>> apply_numa_node(const int numa_node_index,
+                                              const std::vector<std::vector<int>>& proc_type_table);
+
 /**
  * @brief      Limit available CPU resource in processors type table according to hyper threading property
  * @param[in]  input_ht_hint indicate value of property enable_hyper_threading.
@@ -17,6 +17,7 @@
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include "nodes/reorder.h"
 #include "memory_desc/cpu_memory_desc.h"
+#include "utils/memory_placement.hpp"
 
 using namespace InferenceEngine;
 using namespace dnnl;
@@ -217,7 +218,7 @@ bool MemoryMngrWithReuse::resize(size_t size) {
     constexpr int cacheLineSize = 64;
     bool sizeChanged = false;
     if (size > m_memUpperBound) {
-        void *ptr = dnnl::impl::malloc(size, cacheLineSize);
+        void *ptr = allocatePlaced(size, cacheLineSize);
         if (!ptr) {
             IE_THROW() << "Failed to allocate " << size << " bytes of memory";
         }
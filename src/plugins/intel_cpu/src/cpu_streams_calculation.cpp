@@ -435,6 +435,7 @@ std::vector<std::vector<int>> generate_stream_info(const int streams,
                                             config.changedHyperThreading,
                                             config.perfHintsConfig.ovPerfHint,
                                             proc_type_table);
+    proc_type_table = apply_numa_node(config.numaNodeIndex, proc_type_table);
     executor_config._cpu_reservation = get_cpu_pinning(config.enableCpuPinning,
                                                        config.changedCpuPinning,
                                                        streams,
@@ -159,13 +159,33 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
     }
 }
 
+std::vector<int> ExecNetwork::getStreamNumaNodes(int numaNodeId, int socketId) const {
+    const auto numaNodes = InferenceEngine::getAvailableNUMANodes();
+    if (numaNodes.size() < 2 || numaNodeId < 0) {
+        return {};
+    }
+    // the single latency stream may run on the cores of the whole socket or platform,
+    // so its memory is interleaved across the nodes instead of being bound to the first one
+    if (_cfg.streamExecutorConfig._streams == 1) {
+        if (_cfg.latencyThreadingMode == Config::LatencyThreadingMode::PER_PLATFORM) {
+            return numaNodes;
+        }
+        if (_cfg.latencyThreadingMode == Config::LatencyThreadingMode::PER_SOCKET) {
+            return getSocketNumaNodes(socketId);
+        }
+    }
+    return {numaNodeId};
+}
+
 ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph() const {
     int streamId = 0;
     int socketId = 0;
+    int numaNodeId = 0;
     auto streamsExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(_taskExecutor.get());
     if (nullptr != streamsExecutor) {
         streamId = streamsExecutor->GetStreamId();
         socketId = streamsExecutor->GetSocketId();
+        numaNodeId = streamsExecutor->GetNumaNodeId();
     }
     auto graphLock = GraphGuard::Lock(_graphs[streamId % _graphs.size()]);
     if (!graphLock._graph.IsReady()) {
@@ -184,7 +204,17 @@ ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph() const {
                         (_cfg.lpTransformsMode == Config::On) &&
                         ngraph::pass::low_precision::LowPrecision::isFunctionQuantized(_network.getFunction());
 
-                    ctx = std::make_shared<GraphContext>(_cfg, extensionManager, weightsCache, isQuantizedFlag);
+                    MemoryPlacement memoryPlacement;
+                    memoryPlacement.hugePages = _cfg.hugePages;
+                    if (_cfg.numaMemoryPlacement) {
+                        memoryPlacement.numaNodes = getStreamNumaNodes(numaNodeId, socketId);
+                    }
+
+                    ctx = std::make_shared<GraphContext>(_cfg,
+                                                         extensionManager,
+                                                         weightsCache,
+                                                         isQuantizedFlag,
+                                                         std::move(memoryPlacement));
                 }
                 graphLock._graph.CreateGraph(_network, ctx);
             } catch (...) {
@@ -303,6 +333,8 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
             RO_property(ov::execution_devices.name()),
             RO_property(ov::intel_cpu::denormals_optimization.name()),
             RO_property(ov::intel_cpu::sparse_weights_decompression_rate.name()),
+            RO_property(ov::intel_cpu::huge_pages.name()),
+            RO_property(ov::intel_cpu::numa_memory_placement.name()),
         };
     }
 
@@ -360,6 +392,10 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
         return decltype(ov::intel_cpu::denormals_optimization)::value_type(config.denormalsOptMode == Config::DenormalsOptMode::DO_On);
     } else if (name == ov::intel_cpu::sparse_weights_decompression_rate) {
         return decltype(ov::intel_cpu::sparse_weights_decompression_rate)::value_type(config.fcSparseWeiDecompressionRate);
+    } else if (name == ov::intel_cpu::huge_pages) {
+        return decltype(ov::intel_cpu::huge_pages)::value_type(config.hugePages);
+    } else if (name == ov::intel_cpu::numa_memory_placement) {
+        return decltype(ov::intel_cpu::numa_memory_placement)::value_type(config.numaMemoryPlacement);
     }
     /* Internally legacy parameters are used with new API as part of migration procedure.
      * This fallback can be removed as soon as migration completed */
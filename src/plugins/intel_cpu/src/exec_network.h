@@ -76,6 +76,9 @@ protected:
      */
     GraphGuard::Lock GetGraph() const;
 
+    // NUMA nodes the memory of the stream running on the given node is placed on
+    std::vector<int> getStreamNumaNodes(int numaNodeId, int socketId) const;
+
     InferenceEngine::Parameter GetConfigLegacy(const std::string &name) const;
 
     InferenceEngine::Parameter GetMetricLegacy(const std::string &name, const GraphGuard& graph) const;
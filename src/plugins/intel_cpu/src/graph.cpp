@@ -78,6 +78,7 @@ void Graph::CreateGraph(NET &net, const GraphContext::CPtr ctx) {
         ForgetGraphData();
 
     context = ctx;
+    MemoryPlacementScope memoryPlacementScope(context->getMemoryPlacement());
 
     Replicate(net);
 
@@ -94,6 +95,7 @@ void Graph::CreateGraph(const std::vector<NodePtr> &graphNodes,
         ForgetGraphData();
 
     context = ctx;
+    MemoryPlacementScope memoryPlacementScope(context->getMemoryPlacement());
 
     this->_name = std::move(name);
     this->reuse_io_tensors = false;
@@ -1362,6 +1364,9 @@ void Graph::Infer(InferRequestBase* request) {
         IE_THROW() << "Wrong state of the ov::intel_cpu::Graph. Topology is not ready.";
     }
 
+    // dynamic shapes and lazily prepared weights allocate memory during inference
+    MemoryPlacementScope memoryPlacementScope(context->getMemoryPlacement());
+
     if (Status::ReadyDynamic == status) {
         InferDynamic(request);
     } else if (Status::ReadyStatic == status) {
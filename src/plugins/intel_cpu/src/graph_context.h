@@ -8,6 +8,7 @@
 #include "config.h"
 #include "dnnl_scratch_pad.h"
 #include "extension_mngr.h"
+#include "utils/memory_placement.hpp"
 #include "weights_cache.hpp"
 
 namespace ov {
@@ -21,10 +22,12 @@ public:
     GraphContext(const Config& config,
                  ExtensionManager::Ptr extensionManager,
                  WeightsSharing::Ptr w_cache,
-                 bool isGraphQuantized)
+                 bool isGraphQuantized,
+                 MemoryPlacement memoryPlacement = {})
         : config(config),
           extensionManager(extensionManager),
           weightsCache(w_cache),
+          memoryPlacement(std::move(memoryPlacement)),
           isGraphQuantizedFlag(isGraphQuantized) {
         rtParamsCache = std::make_shared<MultiCache>(config.rtCacheCapacity);
         rtScratchPad = std::make_shared<DnnlScratchPad>(eng);
@@ -42,6 +45,10 @@ public:
         return weightsCache;
     }
 
+    const MemoryPlacement& getMemoryPlacement() const {
+        return memoryPlacement;
+    }
+
 
     MultiCachePtr getParamsCache() const {
         return rtParamsCache;
@@ -64,6 +71,7 @@ private:
 
     ExtensionManager::Ptr extensionManager;
     WeightsSharing::Ptr weightsCache;         // per NUMA node caches for sharing weights data
+    MemoryPlacement memoryPlacement;          // placement of the memory allocated by the graph on the stream
 
     MultiCachePtr rtParamsCache;     // primitive cache
     DnnlScratchPadPtr rtScratchPad;  // scratch pad
@@ -22,6 +22,7 @@
 #include "nodes/reduce.h"
 #include "nodes/input.h"
 #include "nodes/rnn.h"
+#include "nodes/memory.hpp"
 #include "nodes/common/cpu_convert.h"
 
 #include "onednn/dnnl.h"
@@ -175,6 +176,10 @@ void GraphOptimizer::ApplyCommonGraphOptimizations(Graph &graph) {
     RemoveSameConvert(graph);
     graph.RemoveDroppedNodes();
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseGatherAndMemoryOutput");
+    FuseGatherAndMemoryOutput(graph);
+    graph.RemoveDroppedNodes();
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "RemoveDroppedEdges");
     graph.RemoveDroppedEdges();
 }
@@ -2532,5 +2537,78 @@ void GraphOptimizer::RemoveSameConvert(Graph& graph) {
     }
 }
 
+void GraphOptimizer::FuseGatherAndMemoryOutput(Graph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isOutermostAxis = [](const NodePtr& axisNode, size_t rank) {
+        auto axisConstant = dynamic_cast<node::Input*>(axisNode.get());
+        if (axisConstant == nullptr || !axisConstant->isConstant() || !axisConstant->getMemoryPtr())
+            return false;
+        const auto& axisMemory = axisConstant->getMemoryPtr();
+        int64_t axis = 0;
+        switch (axisMemory->getDesc().getPrecision()) {
+        case Precision::I32:
+            axis = *static_cast<const int32_t*>(axisMemory->getData());
+            break;
+        case Precision::I64:
+            axis = *static_cast<const int64_t*>(axisMemory->getData());
+            break;
+        default:
+            return false;
+        }
+        return axis == 0 || axis == -static_cast<int64_t>(rank);
+    };
+
+    // Gather(ReadValue, beam_idx) -> Assign of the same variable: the rows of the state are reordered by the beam indices
+    auto isSuitableGather = [&](const NodePtr& node) {
+        if (node->getType() != Type::Gather || node->isDynamicNode() ||
+            node->getParentEdges().size() != 3 || node->getChildEdges().size() != 1)
+            return false;
+        auto memoryInput = std::dynamic_pointer_cast<node::MemoryInput>(node->getParentEdgeAt(0)->getParent());
+        auto memoryOutput = std::dynamic_pointer_cast<node::MemoryOutput>(node->getChildEdgeAt(0)->getChild());
+        if (!memoryInput || !memoryOutput || memoryOutput->isBeamReorder() || memoryInput->getId() != memoryOutput->getId())
+            return false;
+        // whole rows are gathered by a 1D indices tensor of the length of the outermost dimension, the shape is kept
+        const auto& dataDims = node->getInputShapeAtPort(0).getStaticDims();
+        const auto& idxDims = node->getInputShapeAtPort(1).getStaticDims();
+        if (dataDims.empty() || idxDims.size() != 1 || idxDims[0] != dataDims[0])
+            return false;
+        return isOutermostAxis(node->getParentEdgeAt(2)->getParent(), dataDims.size());
+    };
+
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        auto gatherNode = graphNodes[i];
+        if (!isSuitableGather(gatherNode))
+            continue;
+
+        auto dataEdge = gatherNode->getParentEdgeAt(0);
+        auto beamIdxEdge = gatherNode->getParentEdgeAt(1);
+        auto axisEdge = gatherNode->getParentEdgeAt(2);
+        auto childEdge = gatherNode->getChildEdgeAt(0);
+        auto memoryInput = dataEdge->getParent();
+        auto beamIdxNode = beamIdxEdge->getParent();
+        const int dataPort = dataEdge->getInputNum();
+        const int beamIdxPort = beamIdxEdge->getInputNum();
+        auto memoryOutput = std::dynamic_pointer_cast<node::MemoryOutput>(childEdge->getChild());
+
+        for (auto edge : {dataEdge, beamIdxEdge, axisEdge, childEdge})
+            graph.RemoveEdge(edge);
+
+        // the state edge is kept for the shape of the state, the data is not copied through it
+        auto &graphEdges = graph.GetEdges();
+        EdgePtr stateEdge(new Edge(memoryInput, memoryOutput, dataPort, 0));
+        graphEdges.push_back(stateEdge);
+        memoryInput->addEdge(stateEdge);
+        EdgePtr newBeamIdxEdge(new Edge(beamIdxNode, memoryOutput, beamIdxPort, 1));
+        graphEdges.push_back(newBeamIdxEdge);
+        beamIdxNode->addEdge(newBeamIdxEdge);
+
+        memoryOutput->inputShapes.push_back(gatherNode->getInputShapeAtPort(1));
+        memoryOutput->addOriginalInputPrecision(gatherNode->getOriginalInputPrecisionAtPort(1));
+        memoryOutput->addOriginalLayer(gatherNode->getOriginalLayers());
+        memoryOutput->setBeamReorder(true);
+    }
+}
+
 }   // namespace intel_cpu
 }   // namespace ov
@@ -48,6 +48,7 @@ private:
     void MergeTransposeAndReorder(Graph &graph);
     void reshapeRnnSeq(Graph &graph);
     void RemoveSameConvert(Graph &graph);
+    void FuseGatherAndMemoryOutput(Graph &graph);
 };
 
 }   // namespace intel_cpu
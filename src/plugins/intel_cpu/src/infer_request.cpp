@@ -105,34 +105,12 @@ void InferRequestBase::PushStates() {
             auto cur_id = cur_node->getId();
             for (const auto& state : memoryStates) {
                 if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->getData());
-
-                    cpu_memcpy(cur_state_mem_buf, data_ptr, data_size);
-                }
-            }
-        }
-    }
-}
-
-void InferRequestBase::PullStates() {
-    for (auto &node : graph->GetNodes()) {
-        if (node->getType() == Type::MemoryInput) {
-            auto cur_node = dynamic_cast<node::MemoryInput*>(node.get());
-            if (!cur_node) {
-                IE_THROW() << "Cannot cast " << node->getName() << " to MemoryInput";
-            }
-            auto cur_id = cur_node->getId();
-            for (const auto& state : memoryStates) {
-                if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->getData());
-
-                    cpu_memcpy(data_ptr, cur_state_mem_buf, data_size);
+                    auto cur_state = std::dynamic_pointer_cast<VariableState>(state);
+                    if (!cur_state) {
+                        IE_THROW() << "Cannot cast state " << state->GetName() << " to VariableState";
+                    }
+                    // the node updates the state of the request in place, so it is not copied in and out
+                    cur_node->bindState(cur_state->getData(), cur_state->getRowOrder());
                 }
             }
         }
@@ -179,10 +157,6 @@ void InferRequestBase::InferImpl() {
 
     graph->Infer(this);
 
-    if (memoryStates.size() != 0) {
-        PullStates();
-    }
-
     ThrowIfCanceled();
 
     // update output control blocks, if any, in order to refresh internal buffers
@@ -114,7 +114,6 @@ protected:
 
 private:
     void PushStates();
-    void PullStates();
     void redefineMemoryForInputNodes();
 
     std::shared_ptr<ExecNetwork>        execNetwork;
@@ -13,6 +13,24 @@ namespace intel_cpu {
 
 void VariableState::Reset() {
     std::memset(state->buffer(), 0, state->byteSize());
+    rowOrder.reset();
+}
+
+void VariableState::SetState(const Blob::Ptr& newState) {
+    // the data is copied since the MemoryInput node updates the state in place
+    if (newState->byteSize() != state->byteSize())
+        IE_THROW() << "Variable state " << name << " can't be set: the size of the new state " << newState->byteSize()
+                   << " doesn't match the expected size " << state->byteSize();
+    cpu_memcpy(state->buffer(), newState->cbuffer().as<const void*>(), state->byteSize());
+    rowOrder.reset();
+}
+
+Blob::CPtr VariableState::GetState() const {
+    if (!rowOrder.isIdentity()) {
+        const auto& dims = state->getTensorDesc().getDims();
+        rowOrder.normalize(state->buffer().as<uint8_t*>(), state->byteSize() / dims[0]);
+    }
+    return state;
 }
 
 }   // namespace intel_cpu
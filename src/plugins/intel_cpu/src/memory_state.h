@@ -8,6 +8,7 @@
 #include "blob_factory.hpp"
 #include "cpu_memory.h"
 #include "nodes/common/cpu_memcpy.h"
+#include "nodes/common/state_row_order.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
 
 #include <string>
@@ -25,6 +26,21 @@ public:
     }
 
     void Reset() override;
+    void SetState(const InferenceEngine::Blob::Ptr& newState) override;
+    InferenceEngine::Blob::CPtr GetState() const override;
+
+    // the data the MemoryInput node of the state works on in place during the inference of the request
+    void* getData() {
+        return state->buffer();
+    }
+
+    StateRowOrder& getRowOrder() {
+        return rowOrder;
+    }
+
+private:
+    // the rows of the data are put in order when the state is queried
+    mutable StateRowOrder rowOrder;
 };
 
 }   // namespace intel_cpu
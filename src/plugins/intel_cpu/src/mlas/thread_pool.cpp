@@ -17,16 +17,16 @@ namespace cpu {
 
 size_t OVMlasThreadPool::DegreeOfParallelism() {
     // threadpool nullptr means single threaded
-    return threadNum;
+    return parallel.getNumThreads();
 }
 
 void OVMlasThreadPool::TrySimpleParallelFor(const std::ptrdiff_t total, const std::function<void(std::ptrdiff_t)>& fn) {
-    ov::parallel_nt(threadNum, [&](const size_t ithr, const size_t nthr) {
-        std::ptrdiff_t start = 0, end = 0;
-        ov::splitter(total, nthr, ithr, start, end);
-        for (std::ptrdiff_t i = start; i < end; i++) {
-            fn(i);
-        }
+    if (total <= 0)
+        return;
+    // MLAS splits the work into DegreeOfParallelism() parts at most, so each thread gets a single part
+    // and a small GEMM with a single part runs in the calling thread
+    parallel.parallelFor(static_cast<size_t>(total), [&](size_t i) {
+        fn(static_cast<std::ptrdiff_t>(i));
     });
 }
 };  // namespace cpu
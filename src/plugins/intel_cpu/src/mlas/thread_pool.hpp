@@ -8,18 +8,19 @@
 #include <cstdint>
 #include <functional>
 #include "mlas.h"
+#include "utils/work_splitter.hpp"
 
 namespace ov {
 namespace cpu {
+// Runs MLAS work on the threads of the current arena, one contiguous chunk of parts per thread
 class OVMlasThreadPool : public IMlasThreadPool {
 public:
     OVMlasThreadPool() = delete;
-    explicit OVMlasThreadPool(const size_t& threadNum) : threadNum(threadNum) {}
+    explicit OVMlasThreadPool(const ov::intel_cpu::WorkSplitter& parallel) : parallel(parallel) {}
     size_t DegreeOfParallelism() override;
     void TrySimpleParallelFor(const std::ptrdiff_t total, const std::function<void(std::ptrdiff_t)>& fn) override;
 public:
-    // the actual threads used for sgemm
-    size_t threadNum = 0;
+    const ov::intel_cpu::WorkSplitter& parallel;
 };
 };  // namespace cpu
 };  // namespace ov
\ No newline at end of file
@@ -0,0 +1,203 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+#include "topk_radix_select.h"
+#include "utils/bfloat16.hpp"
+#include "utils/work_splitter.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Softmax with temperature, top K / top P filtering and the multinomial draw of the token ids of the logits rows.
+ *
+ * The result is the same as the one of the reference implementation of Sampling: the probabilities are accumulated
+ * in the same order, only their computation and the selection of the best tokens are reorganized:
+ *  - with top K the best tokens are selected first (by the radix select for long rows), so only K exponents
+ *    are computed;
+ *  - with all tokens the probabilities are computed in parallel and accumulated into the prefix sums in one pass,
+ *    the token is found by a binary search over them;
+ *  - with top P only the sorted prefix of the tokens up to the nucleus is needed, it is selected for a growing K
+ *    until the cumulative probability reaches top P.
+ * Rows are distributed between the threads when there are enough of them, the threads work on a row otherwise.
+ */
+class SamplingKernel {
+public:
+    SamplingKernel(size_t vocab, float temperature, size_t topK, float topP)
+        : m_vocab(vocab), m_temperature(temperature), m_topK(topK < vocab ? topK : 0), m_topP(topP) {}
+
+    /**
+     * @brief Draws a token id of each of @p rows rows of the vocabulary length.
+     * @param uniforms uniform random numbers in [0, 1), one per row
+     */
+    template <typename T, typename U>
+    void execute(const T* logits, U* dst, const float* uniforms, size_t rows, const WorkSplitter& parallel) {
+        static_assert(sizeof(T) <= sizeof(float), "the selected values are stored in the float buffer");
+        if (rows == 0)
+            return;
+        const int nthr = parallel.getNumThreads();
+        const bool parallelRows = rows >= static_cast<size_t>(nthr);
+        const size_t slots = parallelRows ? static_cast<size_t>(nthr) : 1;
+        if (m_slots.size() < slots)
+            m_slots.resize(slots);
+
+        if (parallelRows) {
+            const WorkSplitter sequential(1);
+            parallel.parallelNt(nthr, [&](const int ithr, const int nthr) {
+                size_t start = 0, end = 0;
+                splitter(rows, nthr, ithr, start, end);
+                for (size_t row = start; row < end; row++)
+                    dst[row] = static_cast<U>(sampleRow(logits + row * m_vocab, uniforms[row], m_slots[ithr], sequential));
+            });
+        } else {
+            for (size_t row = 0; row < rows; row++)
+                dst[row] = static_cast<U>(sampleRow(logits + row * m_vocab, uniforms[row], m_slots[0], parallel));
+        }
+    }
+
+private:
+    // the first size of the sorted prefix the nucleus is looked for in
+    static constexpr size_t initialNucleus = 256;
+    static constexpr size_t minWork = 4096;
+    static constexpr size_t maxHeapSelect = 256;
+
+    struct Slot {
+        std::vector<float> probs;
+        std::vector<float> cumulative;
+        std::vector<int32_t> indices;
+        std::vector<float> values;
+        std::shared_ptr<TopKRadixSelect> select;
+    };
+
+    float prob(float logit, float maxLogit) const {
+        return std::exp((logit - maxLogit) / m_temperature);
+    }
+
+    // the indices of the best K tokens in the descending order of the logits, the equal ones in the order of the indices
+    template <typename T>
+    void selectBest(const T* row, size_t k, Slot& slot, const WorkSplitter& parallel) const {
+        if (slot.indices.size() < m_vocab)
+            slot.indices.resize(m_vocab);
+        // the heap selection is faster for a few best tokens of a row which is not split between the threads
+        const bool radix = TopKRadixSelect::isApplicable(m_vocab, k) &&
+                           (k > maxHeapSelect || parallel.getNumThreads(m_vocab, minWork) > 1);
+        if (radix) {
+            if (slot.values.size() < k)
+                slot.values.resize(k);
+            if (!slot.select || slot.select->getTopK() != k)
+                slot.select = std::make_shared<TopKRadixSelect>(m_vocab, k, true, false);
+            slot.select->execute(row, reinterpret_cast<T*>(slot.values.data()), slot.indices.data(), 1, parallel);
+            return;
+        }
+        std::iota(slot.indices.begin(), slot.indices.begin() + m_vocab, 0);
+        std::partial_sort(slot.indices.begin(), slot.indices.begin() + k, slot.indices.begin() + m_vocab,
+                          [row](int32_t a, int32_t b) {
+                              const float va = static_cast<float>(row[a]);
+                              const float vb = static_cast<float>(row[b]);
+                              return va > vb || (va == vb && a < b);
+                          });
+    }
+
+    // the first candidate the cumulative probability of which exceeds uniform * total, the last one if none does
+    size_t draw(const float* cumulative, size_t kept, float uniform) const {
+        const float target = uniform * cumulative[kept - 1];
+        const size_t k = std::upper_bound(cumulative, cumulative + kept, target) - cumulative;
+        return std::min(k, kept - 1);
+    }
+
+    template <typename T>
+    size_t sampleRow(const T* row, float uniform, Slot& slot, const WorkSplitter& parallel) const {
+        if (slot.cumulative.size() < m_vocab)
+            slot.cumulative.resize(m_vocab);
+        float* cumulative = slot.cumulative.data();
+
+        if (m_topK > 0) {
+            selectBest(row, m_topK, slot, parallel);
+            const int32_t* best = slot.indices.data();
+            const float maxLogit = static_cast<float>(row[best[0]]);
+            float sum = 0.0f;
+            for (size_t k = 0; k < m_topK; k++) {
+                sum += prob(static_cast<float>(row[best[k]]), maxLogit);
+                cumulative[k] = sum;
+            }
+            size_t kept = m_topK;
+            if (m_topP < 1.0f) {
+                const float threshold = m_topP * sum;
+                kept = std::min<size_t>(std::lower_bound(cumulative, cumulative + m_topK, threshold) - cumulative + 1,
+                                        m_topK);
+            }
+            return best[draw(cumulative, kept, uniform)];
+        }
+
+        // the probabilities of all tokens, the computation is split between the threads
+        const int nthr = parallel.getNumThreads(m_vocab, minWork);
+        std::vector<float> maxLogits(nthr, static_cast<float>(row[0]));
+        parallel.parallelNt(nthr, [&](const int ithr, const int nthr) {
+            size_t start = 0, end = 0;
+            splitter(m_vocab, nthr, ithr, start, end);
+            float maxLogit = maxLogits[ithr];
+            for (size_t i = start; i < end; i++)
+                maxLogit = std::max(maxLogit, static_cast<float>(row[i]));
+            maxLogits[ithr] = maxLogit;
+        });
+        const float maxLogit = *std::max_element(maxLogits.begin(), maxLogits.end());
+
+        if (m_topP >= 1.0f) {
+            parallel.parallelForRange(m_vocab, minWork, [&](size_t start, size_t end) {
+                for (size_t i = start; i < end; i++)
+                    cumulative[i] = prob(static_cast<float>(row[i]), maxLogit);
+            });
+            // the prefix sums in the index order
+            for (size_t i = 1; i < m_vocab; i++)
+                cumulative[i] += cumulative[i - 1];
+            return draw(cumulative, m_vocab, uniform);
+        }
+
+        if (slot.probs.size() < m_vocab)
+            slot.probs.resize(m_vocab);
+        float* probs = slot.probs.data();
+        parallel.parallelForRange(m_vocab, minWork, [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; i++)
+                probs[i] = prob(static_cast<float>(row[i]), maxLogit);
+        });
+        float total = 0.0f;
+        for (size_t i = 0; i < m_vocab; i++)
+            total += probs[i];
+
+        // the nucleus is looked for in the growing sorted prefixes, the sums of the previous prefix are kept
+        const float threshold = m_topP * total;
+        size_t kept = 0;
+        float sum = 0.0f;
+        for (size_t k = std::min(initialNucleus, m_vocab);; k = std::min(k * 4, m_vocab)) {
+            selectBest(row, k, slot, parallel);
+            const int32_t* best = slot.indices.data();
+            while (kept < k) {
+                sum += probs[best[kept]];
+                cumulative[kept++] = sum;
+                if (sum >= threshold)
+                    return best[draw(cumulative, kept, uniform)];
+            }
+            if (k == m_vocab)
+                return best[draw(cumulative, kept, uniform)];
+        }
+    }
+
+    size_t m_vocab;
+    float m_temperature;
+    size_t m_topK;
+    float m_topP;
+    std::vector<Slot> m_slots;
+};
+
+}  // namespace intel_cpu
+}  // namespace ov
@@ -0,0 +1,85 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Order of the rows of the outermost dimension of a variable state, e.g. of the beams of the beam search.
+ *
+ * The logical row i of the state is stored at the physical row order[i], so the state is reordered by the beam indices
+ * by a composition of the table instead of a copy of the data: the cost is O(beams) instead of O(state size).
+ * A physical row may be shared by several beams. It is safe since the rows are never written partially: the state is
+ * either rewritten completely, which resets the order, or reordered.
+ */
+class StateRowOrder {
+public:
+    // the row of zeros, Gather fills the rows of the indices out of the range with zeros
+    static constexpr size_t zeroRow = std::numeric_limits<size_t>::max();
+
+    // the rows are stored in order
+    bool isIdentity() const {
+        return m_order.empty();
+    }
+
+    const std::vector<size_t>& get() const {
+        return m_order;
+    }
+
+    void reset() {
+        m_order.clear();
+    }
+
+    /**
+     * @brief Reorders the @p rows rows of the state by the beam indices: the new row i is the current row beamIdx[i].
+     * The negative indices are counted from the end.
+     */
+    void reorder(const int32_t* beamIdx, size_t rows) {
+        m_next.resize(rows);
+        for (size_t i = 0; i < rows; i++) {
+            int64_t idx = beamIdx[i];
+            if (idx < 0)
+                idx += static_cast<int64_t>(rows);
+            if (idx < 0 || idx >= static_cast<int64_t>(rows)) {
+                m_next[i] = zeroRow;
+                continue;
+            }
+            m_next[i] = m_order.empty() ? static_cast<size_t>(idx) : m_order[idx];
+        }
+        std::swap(m_order, m_next);
+    }
+
+    /**
+     * @brief Rewrites the rows of @p data in order and resets the order.
+     * @param rowSize size of a row in bytes
+     */
+    void normalize(uint8_t* data, size_t rowSize) {
+        if (m_order.empty())
+            return;
+        const std::vector<uint8_t> rows(data, data + m_order.size() * rowSize);
+        for (size_t i = 0; i < m_order.size(); i++) {
+            if (m_order[i] == zeroRow) {
+                std::memset(data + i * rowSize, 0, rowSize);
+            } else {
+                std::memcpy(data + i * rowSize, rows.data() + m_order[i] * rowSize, rowSize);
+            }
+        }
+        reset();
+    }
+
+private:
+    std::vector<size_t> m_order;
+    std::vector<size_t> m_next;
+};
+
+}  // namespace intel_cpu
+}  // namespace ov
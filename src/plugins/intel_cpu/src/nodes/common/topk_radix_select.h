@@ -0,0 +1,243 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <vector>
+
+#include "utils/bfloat16.hpp"
+#include "utils/work_splitter.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief TopK over long rows (e.g. vocabulary sized logits) by the radix select.
+ *
+ * Each value is mapped to an unsigned key which is larger for the better elements. The keys are histogrammed
+ * by 11 bit digits starting from the most significant one: the elements above the bucket the K-th element falls into
+ * are selected, the elements of that bucket are filtered into the candidates of the next digit. Every pass touches the
+ * candidates only, so the cost is a few passes over the row regardless of K, while the heap or bubble sort cost grows
+ * with K. The passes of a row are split between the threads, the per thread histograms give the offsets each thread
+ * writes its part of the filtered elements at, so the order of the elements is kept without a merge of the buffers.
+ * Rows are distributed between the threads instead when there are enough of them.
+ *
+ * The equal values are ordered by the index, like the stable sorting of the reference implementation.
+ */
+class TopKRadixSelect {
+public:
+    // the radix select is used for the rows of this length and longer
+    static constexpr size_t minAxisDim = 4096;
+
+    TopKRadixSelect(size_t axisDim, size_t topK, bool modeMax, bool sortIndex)
+        : m_axisDim(axisDim), m_topK(topK), m_modeMax(modeMax), m_sortIndex(sortIndex) {}
+
+    static bool isApplicable(size_t axisDim, size_t topK) {
+        return axisDim >= minAxisDim && topK > 0 && topK <= axisDim / 4;
+    }
+
+    size_t getTopK() const {
+        return m_topK;
+    }
+
+    /**
+     * @brief Selects top K of each of @p rows rows of the axis length from @p src.
+     * @param dst values, @p rows x K
+     * @param dstIdx indices of the values along the axis, @p rows x K
+     */
+    template <typename T>
+    void execute(const T* src, T* dst, int32_t* dstIdx, size_t rows, const WorkSplitter& parallel) {
+        if (rows == 0)
+            return;
+        const int nthr = parallel.getNumThreads();
+        // a row per thread if there are enough rows, all the threads for a row otherwise
+        const bool parallelRows = rows >= static_cast<size_t>(nthr);
+        const size_t slots = parallelRows ? static_cast<size_t>(nthr) : 1;
+        const size_t slotSize = 2 * m_axisDim + m_topK;
+        if (m_buffer.size() < slots * slotSize)
+            m_buffer.resize(slots * slotSize);
+        if (m_histograms.size() < static_cast<size_t>(nthr) * buckets)
+            m_histograms.resize(static_cast<size_t>(nthr) * buckets);
+
+        if (parallelRows) {
+            parallel.parallelNt(nthr, [&](const int ithr, const int nthr) {
+                size_t start = 0, end = 0;
+                splitter(rows, nthr, ithr, start, end);
+                for (size_t row = start; row < end; row++) {
+                    selectRow(src + row * m_axisDim, dst + row * m_topK, dstIdx + row * m_topK,
+                              &m_buffer[ithr * slotSize], &m_histograms[ithr * buckets], parallel, 1);
+                }
+            });
+        } else {
+            for (size_t row = 0; row < rows; row++) {
+                selectRow(src + row * m_axisDim, dst + row * m_topK, dstIdx + row * m_topK,
+                          m_buffer.data(), m_histograms.data(), parallel, nthr);
+            }
+        }
+    }
+
+private:
+    static constexpr int digitBits = 11;
+    static constexpr size_t buckets = size_t{1} << digitBits;
+    static constexpr int keyBits = 32;
+    // the filtered parts of a thread are at least of this size
+    static constexpr size_t minWork = 4096;
+
+    // the key of an element in the upper half of the candidate, the inverted index in the lower one,
+    // so the candidates in the descending order are sorted by the value and then by the index
+    static uint64_t makeCandidate(uint32_t key, size_t idx) {
+        return (static_cast<uint64_t>(key) << 32) | static_cast<uint32_t>(~static_cast<uint32_t>(idx));
+    }
+
+    static int32_t candidateIndex(uint64_t candidate) {
+        return static_cast<int32_t>(~static_cast<uint32_t>(candidate));
+    }
+
+    static uint32_t orderedKey(float value) {
+        if (value == 0.f)
+            value = 0.f;  // -0 is equal to +0
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+    }
+    static uint32_t orderedKey(bfloat16_t value) {
+        return orderedKey(static_cast<float>(value));
+    }
+    static uint32_t orderedKey(int32_t value) {
+        return static_cast<uint32_t>(value) ^ 0x80000000u;
+    }
+    static uint32_t orderedKey(int8_t value) {
+        return orderedKey(static_cast<int32_t>(value));
+    }
+    static uint32_t orderedKey(uint8_t value) {
+        return value;
+    }
+
+    template <typename T>
+    uint32_t key(T value) const {
+        return m_modeMax ? orderedKey(value) : ~orderedKey(value);
+    }
+
+    static size_t digit(uint64_t candidate, int shift) {
+        return static_cast<size_t>(candidate >> (32 + shift)) & (buckets - 1);
+    }
+
+    template <typename T>
+    void selectRow(const T* src, T* dst, int32_t* dstIdx, uint64_t* buffer, uint32_t* histograms,
+                   const WorkSplitter& parallel, int maxThreads) const {
+        uint64_t* candidates = buffer;
+        uint64_t* filtered = buffer + m_axisDim;
+        uint64_t* selected = buffer + 2 * m_axisDim;
+        size_t selectedCount = 0;
+        size_t count = m_axisDim;
+        size_t need = m_topK;
+
+        auto numThreads = [&](size_t work) {
+            return std::min(maxThreads, parallel.getNumThreads(work, minWork));
+        };
+
+        // the first pass makes the candidates of all the elements
+        int shift = keyBits - digitBits;
+        int nthr = numThreads(count);
+        parallel.parallelNt(nthr, [&](const int ithr, const int nthr) {
+            size_t start = 0, end = 0;
+            splitter(count, nthr, ithr, start, end);
+            uint32_t* histogram = histograms + ithr * buckets;
+            std::fill(histogram, histogram + buckets, 0);
+            for (size_t i = start; i < end; i++) {
+                const auto candidate = makeCandidate(key(src[i]), i);
+                candidates[i] = candidate;
+                histogram[digit(candidate, shift)]++;
+            }
+        });
+
+        while (true) {
+            // the bucket the K-th element is in
+            size_t bucket = buckets;
+            size_t above = 0;
+            size_t equal = 0;
+            while (bucket > 0) {
+                bucket--;
+                equal = 0;
+                for (int t = 0; t < nthr; t++)
+                    equal += histograms[t * buckets + bucket];
+                if (above + equal >= need)
+                    break;
+                above += equal;
+            }
+            need -= above;
+
+            const bool last = shift == 0 || need == equal;
+            // the elements above the bucket are selected, the ones of the bucket are kept for the next digit
+            parallel.parallelNt(nthr, [&](const int ithr, const int nthr) {
+                size_t start = 0, end = 0;
+                splitter(count, nthr, ithr, start, end);
+                size_t selectedOffset = selectedCount;
+                size_t equalOffset = 0;
+                for (int t = 0; t < ithr; t++) {
+                    const uint32_t* histogram = histograms + t * buckets;
+                    for (size_t b = bucket + 1; b < buckets; b++)
+                        selectedOffset += histogram[b];
+                    equalOffset += histogram[bucket];
+                }
+                for (size_t i = start; i < end; i++) {
+                    const auto candidate = candidates[i];
+                    const auto d = digit(candidate, shift);
+                    if (d > bucket) {
+                        selected[selectedOffset++] = candidate;
+                    } else if (d == bucket) {
+                        filtered[equalOffset++] = candidate;
+                    }
+                }
+            });
+            selectedCount += above;
+            count = equal;
+            std::swap(candidates, filtered);
+
+            if (last) {
+                // the rest have the same key or all of them are needed, they are in the order of the indices
+                std::copy(candidates, candidates + need, selected + selectedCount);
+                break;
+            }
+
+            shift = std::max(shift - digitBits, 0);
+            nthr = numThreads(count);
+            parallel.parallelNt(nthr, [&](const int ithr, const int nthr) {
+                size_t start = 0, end = 0;
+                splitter(count, nthr, ithr, start, end);
+                uint32_t* histogram = histograms + ithr * buckets;
+                std::fill(histogram, histogram + buckets, 0);
+                for (size_t i = start; i < end; i++)
+                    histogram[digit(candidates[i], shift)]++;
+            });
+        }
+
+        if (m_sortIndex) {
+            std::sort(selected, selected + m_topK, [](uint64_t a, uint64_t b) {
+                return candidateIndex(a) < candidateIndex(b);
+            });
+        } else {
+            std::sort(selected, selected + m_topK, std::greater<uint64_t>());
+        }
+        for (size_t k = 0; k < m_topK; k++) {
+            const auto idx = candidateIndex(selected[k]);
+            dst[k] = src[idx];
+            dstIdx[k] = idx;
+        }
+    }
+
+    size_t m_axisDim;
+    size_t m_topK;
+    bool m_modeMax;
+    bool m_sortIndex;
+    std::vector<uint64_t> m_buffer;
+    std::vector<uint32_t> m_histograms;
+};
+
+}  // namespace intel_cpu
+}  // namespace ov
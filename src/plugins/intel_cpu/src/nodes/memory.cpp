@@ -3,6 +3,7 @@
 //
 
 #include <string>
+#include <cstring>
 #include <dnnl_types.h>
 #include <dnnl_extension_utils.h>
 #include "memory.hpp"
@@ -11,6 +12,7 @@
 #include "utils/general_utils.h"
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include "utils/ngraph_utils.hpp"
+#include "utils/work_splitter.hpp"
 
 using namespace dnnl;
 using namespace InferenceEngine;
@@ -71,18 +73,31 @@ void MemoryOutput::initSupportedPrimitiveDescriptors() {
 
     InferenceEngine::Precision precision = getOriginalInputPrecisionAtPort(0);
     NodeConfig config;
-    config.inConfs.resize(1);
+    config.inConfs.resize(beamReorder ? 2 : 1);
     config.inConfs[0].inPlace(-1);
     config.inConfs[0].constant(false);
     config.inConfs[0].setMemDesc(std::make_shared<CpuBlockedMemoryDesc>(precision, getInputShapeAtPort(0)));
+    if (beamReorder) {
+        config.inConfs[BEAM_IDX].inPlace(-1);
+        config.inConfs[BEAM_IDX].constant(false);
+        config.inConfs[BEAM_IDX].setMemDesc(std::make_shared<CpuBlockedMemoryDesc>(Precision::I32,
+                                                                                    getInputShapeAtPort(BEAM_IDX)));
+    }
     supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::unknown);
 }
 
 void MemoryOutput::execute(dnnl::stream strm)  {
-    auto& srcMemory = getParentEdgeAt(0)->getMemory();
-
     auto inputMemoryNode = dynamic_cast<MemoryInput*>(inputNode);
     IE_ASSERT(inputMemoryNode != nullptr);
+
+    if (beamReorder) {
+        auto& beamIdxMemory = getParentEdgeAt(BEAM_IDX)->getMemory();
+        inputMemoryNode->reorderState(static_cast<const int32_t*>(beamIdxMemory.getData()),
+                                      beamIdxMemory.getShape().getElementsCount());
+        return;
+    }
+
+    auto& srcMemory = getParentEdgeAt(0)->getMemory();
     inputMemoryNode->storeState(srcMemory);
 }
 
@@ -120,10 +135,18 @@ void MemoryInput::createPrimitive() {
     Input::createPrimitive();
 
     dataStore = std::make_shared<Memory>(getEngine(), getChildEdgeAt(0)->getMemory().getDesc());
+    stateStore = dataStore;
 
     // default memory state is zero filled
     if (dataStore->getDesc().hasDefinedMaxSize())
         dataStore->nullify();
+
+    needCopy = false;
+    for (const auto& edge : getChildEdgesAtPort(0)) {
+        auto memoryOutput = dynamic_cast<MemoryOutput*>(edge->getChild().get());
+        if (memoryOutput == nullptr || !memoryOutput->isBeamReorder())
+            needCopy = true;
+    }
 }
 
 /**
@@ -157,18 +180,61 @@ MemoryPtr MemoryInput::getStore() {
     return dataStore;
 }
 
+void MemoryInput::bindState(void* data, StateRowOrder& order) {
+    if (stateStore->getData() != data)
+        stateStore = std::make_shared<Memory>(getEngine(), dataStore->getDescPtr(), data);
+    rowOrder = &order;
+}
+
 void MemoryInput::storeState(const IMemory &new_state) {
     // TODO: Should be next one call:
     //           dataStore.load(new_state, false);
     //       But because of performance reason we use simple manual copy
-    simple_copy(*dataStore, new_state);
+    simple_copy(*stateStore, new_state);
+    rowOrder->reset();
+}
+
+void MemoryInput::reorderState(const int32_t* beamIdx, size_t beams) {
+    const auto& dims = stateStore->getStaticDims();
+    IE_ASSERT(!dims.empty() && dims[0] == beams) << "MemoryNode " << getName() << " has " << beams
+                                                 << " beam indices for the state with the outermost dimension "
+                                                 << (dims.empty() ? 0 : dims[0]);
+    rowOrder->reorder(beamIdx, beams);
+}
+
+void MemoryInput::readState(const IMemory& dst) const {
+    if (rowOrder->isIdentity()) {
+        // TODO: Should be simple call of:
+        //           dst_mem.load(dataStore, false);
+        //       But because of performance reason we use simple manual copy
+        simple_copy(dst, *stateStore);
+        return;
+    }
+
+    const auto& order = rowOrder->get();
+    const size_t rowLength = stateStore->getShape().getElementsCount() / order.size();
+    const auto srcPrc = stateStore->getDesc().getPrecision();
+    const auto dstPrc = dst.getDesc().getPrecision();
+    const size_t srcRowSize = rowLength * srcPrc.size();
+    const size_t dstRowSize = rowLength * dstPrc.size();
+    auto srcPtr = static_cast<const uint8_t*>(stateStore->getData());
+    auto dstPtr = static_cast<uint8_t*>(dst.getData());
+
+    WorkSplitter().parallelFor(order.size(), [&](size_t row) {
+        uint8_t* dstRow = dstPtr + row * dstRowSize;
+        if (order[row] == StateRowOrder::zeroRow) {
+            std::memset(dstRow, 0, dstRowSize);
+        } else if (srcPrc == dstPrc) {
+            cpu_memcpy(dstRow, srcPtr + order[row] * srcRowSize, dstRowSize);
+        } else {
+            cpu_convert(srcPtr + order[row] * srcRowSize, dstRow, srcPrc, dstPrc, rowLength);
+        }
+    });
 }
 
 void MemoryInput::execute(dnnl::stream strm) {
-    // TODO: Should be simple call of:
-    //           dst_mem.load(dataStore, false);
-    //       But because of performance reason we use simple manual copy
-    simple_copy(getChildEdgeAt(0)->getMemory(), *dataStore);
+    if (needCopy)
+        readState(getChildEdgeAt(0)->getMemory());
 }
 
 MemoryNodeVirtualEdge::Holder* MemoryNodeVirtualEdge::registerInput(MemoryInput * node) {
@@ -8,6 +8,7 @@
 #include <cpu_types.h>
 #include "ie_algorithm.hpp"
 #include "input.h"
+#include "common/state_row_order.h"
 #include <node.h>
 #include <string>
 #include <memory>
@@ -76,12 +77,26 @@ public:
         inputNode = node;
     }
 
+    /**
+     * @brief The node stores the state reordered by the beam indices of the second input: Gather(ReadValue, beam_idx)
+     * is fused, the rows of the state are permuted without a copy of the data.
+     */
+    void setBeamReorder(bool value) {
+        beamReorder = value;
+    }
+    bool isBeamReorder() const {
+        return beamReorder;
+    }
+
  private:
     /**
      * @brief keeps reference to input sibling node
      */
     Node* inputNode = nullptr;
     MemoryNodeVirtualEdge::Holder* holder = nullptr;
+    bool beamReorder = false;
+
+    static constexpr size_t BEAM_IDX = 1;
 };
 
 class MemoryInput : public Input, public MemoryNode {
@@ -102,9 +117,25 @@ public:
 
     void setInputNode(Node* node) override {}
     void storeState(const IMemory& mem);
+    void reorderState(const int32_t* beamIdx, size_t beams);
     MemoryPtr getStore();
+
+    /**
+     * @brief Binds the state of an infer request, the node reads and updates it in place until the next binding.
+     */
+    void bindState(void* data, StateRowOrder& order);
+
  private:
+    // copies the state with the rows in the logical order
+    void readState(const IMemory& dst) const;
+
     MemoryPtr dataStore;
+    // the state of the bound infer request or the own store
+    MemoryPtr stateStore;
+    StateRowOrder ownRowOrder;
+    StateRowOrder* rowOrder = &ownRowOrder;
+    // the output is not needed if the state is only reordered by the beam indices
+    bool needCopy = true;
     MemoryNodeVirtualEdge::Holder* holder = nullptr;
 };
 
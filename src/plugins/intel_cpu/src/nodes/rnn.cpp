@@ -12,6 +12,7 @@
 #include <dnnl_extension_utils.h>
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include <common/primitive_hashing_utils.hpp>
+#include <algorithm>
 #include <memory>
 #include <utils/shape_inference/shape_inference_ngraph.hpp>
 #include "transformations/utils/utils.hpp"
@@ -459,8 +460,17 @@ RNN::RNN(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr context)
     if (rtInfo.count("inputShift"))
         inputShift = rtInfo.at("inputShift").as<float>();
 
-    if (rtInfo.count("weightsScales"))
+    if (rtInfo.count("weightsScales")) {
         weightsScales = rtInfo.at("weightsScales").as<std::vector<float>>();
+        // oneDNN expects a scale per gate and output channel, so a per tensor scale is broadcasted
+        if (weightsScales.size() == 1)
+            weightsScales.resize(G * SC, weightsScales[0]);
+        if (weightsScales.size() != G * SC)
+            THROW_ERROR << "has unexpected number of weights scales: " << weightsScales.size();
+        // the scales follow the gates of the weights, which are reordered FICO -> IFCO for LSTM
+        if (cell_type == dnnl::algorithm::vanilla_lstm)
+            std::swap_ranges(weightsScales.begin(), weightsScales.begin() + SC, weightsScales.begin() + SC);
+    }
 
     if (is_cell) {
         initCell();
@@ -484,13 +494,13 @@ void RNN::configurePortDataTypes() {
     inDataTypes[xIdx] = DnnlExtensionUtils::IEPrecisionToDataType(getOriginalInputPrecisionAtPort(0));
     inDataTypes[hIdx] = DnnlExtensionUtils::IEPrecisionToDataType(getOriginalInputPrecisionAtPort(1));
     if (haveCellState(cell_type))
-        inDataTypes[cIdx] = memory::data_type::f32; // @todo bf16 is also allowed, should be tried out
+        inDataTypes[cIdx] = memory::data_type::f32; // bf16 is tried out below
     if (!is_cell)
         inDataTypes[sIdx] = memory::data_type::s32;
     inDataTypes[wIdx] = DnnlExtensionUtils::IEPrecisionToDataType(getOriginalInputPrecisionAtPort(wIdx));
     inDataTypes[rIdx] = DnnlExtensionUtils::IEPrecisionToDataType(getOriginalInputPrecisionAtPort(rIdx));
 
-    inDataTypes[bIdx] = memory::data_type::f32; // @todo bf16 is also allowed, should be tried out
+    inDataTypes[bIdx] = memory::data_type::f32; // bf16 is tried out below
     if (haveAttention(cell_type))
         inDataTypes[aIdx] = DnnlExtensionUtils::IEPrecisionToDataType(getOriginalInputPrecisionAtPort(aIdx));
 
@@ -505,8 +515,24 @@ void RNN::configurePortDataTypes() {
     if (one_of(memory::data_type::bf16, inDataTypes[xIdx], inDataTypes[hIdx]))
         inDataTypes[xIdx] = outDataTypes[yIdx] = outDataTypes[hoIdx] = inDataTypes[hIdx] = memory::data_type::bf16; // required by oneDNN.
 
-    if (outDataTypes[yIdx] == memory::data_type::bf16 && one_of(inDataTypes[xIdx], memory::data_type::s8, memory::data_type::u8))
-        outDataTypes[yIdx] = memory::data_type::f32; // oneDNN does not support bf16 output precision for quantized rnn primitive yet
+    if (outDataTypes[yIdx] != memory::data_type::bf16)
+        return;
+
+    // bf16 inference: the output of the quantized cell, the cell state and the bias are kept in bf16 as well,
+    // so the sequences are chained without f32 tensors and conversions in between.
+    // oneDNN supports it depending on the cell type and its version, so each type is lowered only if the primitive exists.
+    if (one_of(inDataTypes[xIdx], memory::data_type::s8, memory::data_type::u8) && !isPrimitiveSupported())
+        outDataTypes[yIdx] = memory::data_type::f32;
+
+    if (haveCellState(cell_type)) {
+        inDataTypes[cIdx] = outDataTypes[coIdx] = memory::data_type::bf16;
+        if (!isPrimitiveSupported())
+            inDataTypes[cIdx] = outDataTypes[coIdx] = memory::data_type::f32;
+    }
+
+    inDataTypes[bIdx] = memory::data_type::bf16;
+    if (!isPrimitiveSupported())
+        inDataTypes[bIdx] = memory::data_type::f32;
 }
 
 void RNN::getSupportedDescriptors() {
@@ -795,7 +821,7 @@ template <Precision::ePrecision Prec>
 void RNN::fillBiases(const int *gate_map) {
     using dataType = typename PrecisionTrait<Prec>::value_type;
 
-    if (inDataTypes[bIdx] != memory::data_type::f32) {
+    if (inDataTypes[bIdx] != DnnlExtensionUtils::IEPrecisionToDataType(Prec)) {
         THROW_ERROR << "doesn't support bias data type: " << DnnlExtensionUtils::DataTypeToIEPrecision(inDataTypes[bIdx]);
     }
 
@@ -895,7 +921,11 @@ void RNN::copyWeightsData() {
         THROW_ERROR << "has unsupported data type: " << DnnlExtensionUtils::DataTypeToIEPrecision(dataType);
     }
 
-    fillBiases<Precision::FP32>(gate_map);
+    if (inDataTypes[bIdx] == memory::data_type::bf16) {
+        fillBiases<Precision::BF16>(gate_map);
+    } else {
+        fillBiases<Precision::FP32>(gate_map);
+    }
 }
 
 namespace {
@@ -906,7 +936,8 @@ dnnl::primitive_desc createPrimitiveDescriptor(const dnnl::engine        engine,
                                                const std::vector<DnnlBlockedMemoryDescPtr>& inDataDescs,
                                                const std::vector<DnnlBlockedMemoryDescPtr>& outDataDescs,
                                                const std::vector<dnnl::memory::desc>& wDescs,
-                                               const dnnl::primitive_attr& attr) {
+                                               const dnnl::primitive_attr& attr,
+                                               const bool allowEmpty = false) {
     const dnnl::prop_kind propKind = dnnl::prop_kind::forward_inference;
 
     switch (cellType) {
@@ -923,7 +954,8 @@ dnnl::primitive_desc createPrimitiveDescriptor(const dnnl::engine        engine,
             wDescs[2],                                                 // Bias
             outDataDescs[RNN::InOutKind::Layer]->getDnnlDesc(),        // Out Data
             outDataDescs[RNN::InOutKind::HiddenState]->getDnnlDesc(),  // Out State
-            attr);
+            attr,
+            allowEmpty);
     case dnnl::algorithm::vanilla_gru:
         return dnnl::gru_forward::primitive_desc(
             engine,
@@ -936,7 +968,8 @@ dnnl::primitive_desc createPrimitiveDescriptor(const dnnl::engine        engine,
             wDescs[2],                                                 // Bias
             outDataDescs[RNN::InOutKind::Layer]->getDnnlDesc(),        // Out Data
             outDataDescs[RNN::InOutKind::HiddenState]->getDnnlDesc(),  // Out State
-            attr);
+            attr,
+            allowEmpty);
     case dnnl::algorithm::lbr_gru:
         return dnnl::lbr_gru_forward::primitive_desc(
             engine,
@@ -949,7 +982,8 @@ dnnl::primitive_desc createPrimitiveDescriptor(const dnnl::engine        engine,
             wDescs[2],                                                 // Bias
             outDataDescs[RNN::InOutKind::Layer]->getDnnlDesc(),        // Out Data
             outDataDescs[RNN::InOutKind::HiddenState]->getDnnlDesc(),  // Out State
-            attr);
+            attr,
+            allowEmpty);
     case dnnl::algorithm::vanilla_lstm:
         return dnnl::lstm_forward::primitive_desc(
             engine,
@@ -964,7 +998,8 @@ dnnl::primitive_desc createPrimitiveDescriptor(const dnnl::engine        engine,
             outDataDescs[RNN::InOutKind::Layer]->getDnnlDesc(),        // Out Data
             outDataDescs[RNN::InOutKind::HiddenState]->getDnnlDesc(),  // Out State
             outDataDescs[RNN::InOutKind::CellState]->getDnnlDesc(),    // Out State C
-            attr);
+            attr,
+            allowEmpty);
     case dnnl::algorithm::vanilla_augru:
         return dnnl::augru_forward::primitive_desc(
             engine,
@@ -978,7 +1013,8 @@ dnnl::primitive_desc createPrimitiveDescriptor(const dnnl::engine        engine,
             wDescs[2],                                                 // Bias
             outDataDescs[RNN::InOutKind::Layer]->getDnnlDesc(),        // Out Data
             outDataDescs[RNN::InOutKind::HiddenState]->getDnnlDesc(),  // Out State
-            attr);
+            attr,
+            allowEmpty);
     case dnnl::algorithm::lbr_augru:
         return dnnl::lbr_augru_forward::primitive_desc(
             engine,
@@ -992,13 +1028,54 @@ dnnl::primitive_desc createPrimitiveDescriptor(const dnnl::engine        engine,
             wDescs[2],                                                 // Bias
             outDataDescs[RNN::InOutKind::Layer]->getDnnlDesc(),        // Out Data
             outDataDescs[RNN::InOutKind::HiddenState]->getDnnlDesc(),  // Out State
-            attr);
+            attr,
+            allowEmpty);
     default:
         IE_THROW() << "RNN. Unknown cell type";
     }
 }
 } // namespace
 
+bool RNN::isPrimitiveSupported() {
+    const Shape shapeS_4D{L, D, 1, SC};
+    std::vector<DnnlBlockedMemoryDescPtr> inDescs{
+        std::make_shared<DnnlBlockedMemoryDesc>(Shape{1, 1, DC}, inDataTypes[xIdx], memory::format_tag::tnc),
+        std::make_shared<DnnlBlockedMemoryDesc>(shapeS_4D, inDataTypes[hIdx], memory::format_tag::ldnc)};
+    std::vector<DnnlBlockedMemoryDescPtr> outDescs{
+        std::make_shared<DnnlBlockedMemoryDesc>(Shape{1, 1, D * SC}, outDataTypes[yIdx], memory::format_tag::tnc),
+        std::make_shared<DnnlBlockedMemoryDesc>(shapeS_4D, outDataTypes[hoIdx], memory::format_tag::ldnc)};
+
+    if (haveCellState(cell_type)) {
+        inDescs.emplace_back(std::make_shared<DnnlBlockedMemoryDesc>(shapeS_4D, inDataTypes[cIdx], memory::format_tag::ldnc));
+        outDescs.emplace_back(std::make_shared<DnnlBlockedMemoryDesc>(shapeS_4D, outDataTypes[coIdx], memory::format_tag::ldnc));
+    } else if (haveAttention(cell_type)) {
+        inDescs.emplace_back(std::make_shared<DnnlBlockedMemoryDesc>(Shape{1, 1, 1}, inDataTypes[aIdx], memory::format_tag::tnc));
+    }
+
+    const auto& targetWeightDataType = weightsByinputDataType.at(inDataTypes[xIdx]);
+    const std::vector<dnnl::memory::desc> weightsDescs{
+        dnnl::memory::desc(DnnlExtensionUtils::convertToDnnlDims(VectorDims{ L, D, DC, G, SC }),
+                           targetWeightDataType, memory::format_tag::any),
+        dnnl::memory::desc(DnnlExtensionUtils::convertToDnnlDims(VectorDims{ L, D, SC, G, SC }),
+                           targetWeightDataType, memory::format_tag::any),
+        dnnl::memory::desc(DnnlExtensionUtils::convertToDnnlDims(VectorDims{ L, D, Gb, SC }),
+                           inDataTypes[bIdx], memory::format_tag::ldgo)};
+
+    const auto attr = initPrimitiveAttr();
+    const auto desc = createPrimitiveDescriptor(
+        getEngine(),
+        cell_type,
+        cell_act,
+        direction,
+        inDescs,
+        outDescs,
+        weightsDescs,
+        *attr,
+        true);
+
+    return static_cast<bool>(desc);
+}
+
 void RNN::fillDescs() {
     descs.clear();
 
@@ -53,6 +53,8 @@ protected:
 
 private:
     void configurePortDataTypes();
+    // whether oneDNN has an implementation for the current data types of the ports
+    bool isPrimitiveSupported();
     void initCell();
     void initSequence();
     void fillCellDesc();
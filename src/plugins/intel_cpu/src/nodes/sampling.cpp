@@ -0,0 +1,114 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "sampling.h"
+
+#include <openvino/op/constant.hpp>
+#include <openvino/op/parameter.hpp>
+#include <openvino/op/random_uniform.hpp>
+#include <openvino/op/sampling.hpp>
+
+#include "utils/bfloat16.hpp"
+
+using namespace InferenceEngine;
+
+#define THROW_ERROR IE_THROW() << getTypeStr() << " node with name '" << getName() << "' "
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+
+bool Sampling::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        if (!ov::is_type<op::v13::Sampling>(op)) {
+            errorMessage = "Not supported Sampling operation version. CPU plug-in supports only 13th version.";
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+
+    return true;
+}
+
+Sampling::Sampling(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr context)
+    : Node(op, context, NgraphShapeInferFactory(op, EMPTY_PORT_MASK)) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+
+    const auto sampling = ov::as_type_ptr<const op::v13::Sampling>(op);
+    temperature = sampling->get_temperature();
+    topK = static_cast<size_t>(sampling->get_top_k());
+    topP = sampling->get_top_p();
+
+    const auto shape = std::make_shared<op::v0::Parameter>(element::i64, ov::Shape{1});
+    const auto minVal = op::v0::Constant::create(element::f32, ov::Shape{}, {0.0f});
+    const auto maxVal = op::v0::Constant::create(element::f32, ov::Shape{}, {1.0f});
+    randomUniform = std::make_shared<op::v8::RandomUniform>(shape, minVal, maxVal, element::f32,
+                                                            sampling->get_global_seed(), sampling->get_op_seed());
+
+    // new token ids are drawn by each inference even if the logits are constant
+    constant = ConstantType::NoConst;
+}
+
+void Sampling::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    logitsPrecision = getOriginalInputPrecisionAtPort(LOGITS);
+    if (logitsPrecision != Precision::BF16) {
+        logitsPrecision = Precision::FP32;
+    }
+
+    addSupportedPrimDesc({{LayoutType::ncsp, logitsPrecision}},
+                         {{LayoutType::ncsp, Precision::I32}},
+                         impl_desc_type::ref_any);
+}
+
+void Sampling::prepareParams() {
+    const auto& logitsDims = getParentEdgeAt(LOGITS)->getMemoryPtr()->getStaticDims();
+    kernel = std::make_shared<SamplingKernel>(logitsDims[1], temperature, topK, topP);
+}
+
+void Sampling::generateUniforms(size_t rows) {
+    uniforms.resize(rows);
+    int64_t shape = static_cast<int64_t>(rows);
+    float minVal = 0.0f;
+    float maxVal = 1.0f;
+    ov::TensorVector inputs{ov::Tensor(element::i64, ov::Shape{1}, &shape),
+                            ov::Tensor(element::f32, ov::Shape{}, &minVal),
+                            ov::Tensor(element::f32, ov::Shape{}, &maxVal)};
+    ov::TensorVector outputs{ov::Tensor(element::f32, ov::Shape{rows}, uniforms.data())};
+    if (!randomUniform->evaluate(outputs, inputs))
+        THROW_ERROR << "failed to generate the random numbers.";
+}
+
+void Sampling::execute(dnnl::stream strm) {
+    const auto& logitsDims = getParentEdgeAt(LOGITS)->getMemoryPtr()->getStaticDims();
+    const size_t rows = logitsDims[0];
+    generateUniforms(rows);
+
+    const auto* src = getParentEdgeAt(LOGITS)->getMemoryPtr()->getData();
+    auto* dst = reinterpret_cast<int32_t*>(getChildEdgeAt(0)->getMemoryPtr()->getData());
+    const WorkSplitter parallel;
+    if (logitsPrecision == Precision::BF16) {
+        kernel->execute(reinterpret_cast<const bfloat16_t*>(src), dst, uniforms.data(), rows, parallel);
+    } else {
+        kernel->execute(reinterpret_cast<const float*>(src), dst, uniforms.data(), rows, parallel);
+    }
+}
+
+void Sampling::executeDynamicImpl(dnnl::stream strm) {
+    execute(strm);
+}
+
+bool Sampling::created() const {
+    return getType() == Type::Sampling;
+}
+
+}   // namespace node
+}   // namespace intel_cpu
+}   // namespace ov
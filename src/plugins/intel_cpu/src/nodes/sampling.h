@@ -0,0 +1,54 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <node.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/sampling_kernel.h"
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+
+class Sampling : public Node {
+public:
+    Sampling(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr context);
+
+    void getSupportedDescriptors() override {};
+    void initSupportedPrimitiveDescriptors() override;
+    void execute(dnnl::stream strm) override;
+    bool created() const override;
+
+    static bool isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept;
+
+protected:
+    void executeDynamicImpl(dnnl::stream strm) override;
+    void prepareParams() override;
+
+private:
+    // generates the uniform numbers of the rows with the seeds and the state of the operation
+    void generateUniforms(size_t rows);
+
+    float temperature = 1.0f;
+    size_t topK = 0;
+    float topP = 1.0f;
+
+    // RandomUniform with the seeds of Sampling, its state is advanced by each inference like the one of Sampling
+    std::shared_ptr<ov::Node> randomUniform;
+    std::vector<float> uniforms;
+
+    std::shared_ptr<SamplingKernel> kernel;
+    InferenceEngine::Precision logitsPrecision;
+
+    static constexpr size_t LOGITS = 0;
+};
+
+}   // namespace node
+}   // namespace intel_cpu
+}   // namespace ov
@@ -9,10 +9,14 @@
 #include <dnnl_extension_utils.h>
 #include "ie_parallel.hpp"
 #include <algorithm>
+#include <cmath>
 #include "common/cpu_memcpy.h"
+#include "utils/bfloat16.hpp"
+#include "utils/work_splitter.hpp"
 
 #include <ngraph/opsets/opset3.hpp>
 #include <ngraph/opsets/opset4.hpp>
+#include <openvino/op/scatter_elements_update.hpp>
 
 using namespace dnnl;
 using namespace InferenceEngine;
@@ -24,13 +28,19 @@ namespace node {
 bool ScatterUpdate::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
         auto scatterElemUpd = ngraph::as_type_ptr<const ngraph::opset3::ScatterElementsUpdate>(op);
+        auto scatterElemUpd12 = ov::as_type_ptr<const ov::op::v12::ScatterElementsUpdate>(op);
         auto scatterUpd = ngraph::as_type_ptr<const ngraph::opset3::ScatterUpdate>(op);
         auto scatterNdUpd = ngraph::as_type_ptr<const ngraph::opset4::ScatterNDUpdate>(op);
-        if (!scatterElemUpd && !scatterUpd && !scatterNdUpd) {
+        if (!scatterElemUpd && !scatterElemUpd12 && !scatterUpd && !scatterNdUpd) {
             const std::string opType = op->get_type_name();
             errorMessage = "Only opset" + opType == "ScatterNDUpdate" ? "4 " : "3 " + opType + " operation is supported";
             return false;
         }
+        if (scatterElemUpd12 && scatterElemUpd12->get_reduction() != ov::op::v12::ScatterElementsUpdate::Reduction::NONE &&
+            op->get_input_element_type(DATA_ID) == ov::element::boolean) {
+            errorMessage = "ScatterElementsUpdate reduction is not supported for boolean data";
+            return false;
+        }
     } catch (...) {
         return false;
     }
@@ -53,6 +63,20 @@ ScatterUpdate::ScatterUpdate(const std::shared_ptr<ngraph::Node>& op, const Grap
     } else {
         IE_THROW(NotImplemented) << errorMessage;
     }
+
+    if (const auto scatterElemUpd12 = ov::as_type_ptr<const ov::op::v12::ScatterElementsUpdate>(op)) {
+        using Reduction = ov::op::v12::ScatterElementsUpdate::Reduction;
+        switch (scatterElemUpd12->get_reduction()) {
+            case Reduction::NONE: reductionMode = ScatterReductionMode::None; break;
+            case Reduction::SUM: reductionMode = ScatterReductionMode::Sum; break;
+            case Reduction::PROD: reductionMode = ScatterReductionMode::Prod; break;
+            case Reduction::MIN: reductionMode = ScatterReductionMode::Min; break;
+            case Reduction::MAX: reductionMode = ScatterReductionMode::Max; break;
+            case Reduction::MEAN: reductionMode = ScatterReductionMode::Mean; break;
+            default: IE_THROW(NotImplemented) << errorPrefix << " has unsupported reduction type";
+        }
+        useInitVal = scatterElemUpd12->get_use_init_val();
+    }
 }
 
 void ScatterUpdate::getSupportedDescriptors() {
@@ -186,6 +210,10 @@ void ScatterUpdate::initSupportedPrimitiveDescriptors() {
     }
 
     dataPrec = getOriginalInputPrecisionAtPort(DATA_ID);
+    // reductions are computed for f32, bf16 and i32 data, other types are converted
+    if (reductionMode != ScatterReductionMode::None && !one_of(dataPrec, Precision::FP32, Precision::BF16, Precision::I32)) {
+        dataPrec = dataPrec.is_float() ? Precision::FP32 : Precision::I32;
+    }
     dataSize = dataPrec.size();
 
     bool canBeInplace = !isDynamicNode() && getParentEdgeAt(DATA_ID)->getParent()->getChildEdges().size() == 1 &&
@@ -355,7 +383,15 @@ void ScatterUpdate::execute(dnnl::stream strm) {
             break;
         }
         case ScatterUpdateMode::ScatterElementsUpdate: {
-            scatterElementsUpdate(indicesPtr, updatePtr, axis, dstPtr);
+            if (reductionMode == ScatterReductionMode::None) {
+                scatterElementsUpdate(indicesPtr, updatePtr, axis, dstPtr);
+            } else {
+                ScatterElementsReduceContext ctx{this, indicesPtr, updatePtr, axis, dstPtr};
+                OV_SWITCH(intel_cpu, ScatterElementsReduceExecute, ctx, dataPrec,
+                          OV_CASE(Precision::FP32, float),
+                          OV_CASE(Precision::BF16, bfloat16_t),
+                          OV_CASE(Precision::I32, int32_t))
+            }
             break;
         }
         default: {
@@ -485,6 +521,124 @@ void ScatterUpdate::scatterElementsUpdate(uint8_t *indices, uint8_t *update, int
     });
 }
 
+namespace {
+// bf16 updates are reduced in f32, the result of each step is stored in bf16 as the reference does
+template <typename T>
+struct ReduceType {
+    using type = T;
+};
+template <>
+struct ReduceType<bfloat16_t> {
+    using type = float;
+};
+
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value, T>::type arithmeticMean(const T sum, const int32_t count) {
+    return sum / count;
+}
+
+// the mean of integers is rounded down
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value, T>::type arithmeticMean(const T sum, const int32_t count) {
+    return static_cast<T>(std::floor(static_cast<double>(sum) / count));
+}
+}  // namespace
+
+template <typename DataType>
+void ScatterUpdate::scatterElementsReduce(uint8_t *indices, uint8_t *update, int axis, uint8_t *dstData) {
+    using T = typename ReduceType<DataType>::type;
+    switch (reductionMode) {
+        case ScatterReductionMode::Sum:
+        case ScatterReductionMode::Mean:
+            scatterElementsReduce<DataType>(indices, update, axis, dstData, [](T a, T b) { return a + b; });
+            break;
+        case ScatterReductionMode::Prod:
+            scatterElementsReduce<DataType>(indices, update, axis, dstData, [](T a, T b) { return a * b; });
+            break;
+        case ScatterReductionMode::Min:
+            scatterElementsReduce<DataType>(indices, update, axis, dstData, [](T a, T b) { return a < b ? a : b; });
+            break;
+        case ScatterReductionMode::Max:
+            scatterElementsReduce<DataType>(indices, update, axis, dstData, [](T a, T b) { return a > b ? a : b; });
+            break;
+        default:
+            IE_THROW() << errorPrefix << " has unsupported reduction type";
+    }
+}
+
+// Updates which differ in any coordinate but the axis one never point to the same output element, so the lines of
+// updates along the axis are reduced in parallel without atomics or per thread copies of the output.
+// Within a line the number of updates reduced into each element is counted to compute the mean and to take
+// the first update as is when the initial value is not used.
+template <typename DataType, typename ReduceFunc>
+void ScatterUpdate::scatterElementsReduce(uint8_t *indices, uint8_t *update, int axis, uint8_t *dstData, const ReduceFunc& reduce) {
+    using T = typename ReduceType<DataType>::type;
+    const auto& srcDataDim = getParentEdgeAt(DATA_ID)->getMemory().getStaticDims();
+    const auto& updateDim = getParentEdgeAt(UPDATE_ID)->getMemory().getStaticDims();
+    const int updateRank = static_cast<int>(updateDim.size());
+
+    std::vector<size_t> srcBlockND = getBlockND(srcDataDim);
+    std::vector<size_t> updateBlockND = getBlockND(updateDim);
+
+    const int64_t axisDim = static_cast<int64_t>(srcDataDim[axis]);
+    const size_t lineLength = updateDim[axis];
+    const size_t lineStride = updateBlockND[axis + 1];
+    const size_t linesNum = updateBlockND[0] / lineLength;
+    const size_t dstAxisStride = srcBlockND[axis + 1];
+    const bool isMean = reductionMode == ScatterReductionMode::Mean;
+
+    auto *dst = reinterpret_cast<DataType*>(dstData);
+    const auto *upd = reinterpret_cast<const DataType*>(update);
+
+    WorkSplitter().parallelForRange(linesNum, 1, [&](size_t start, size_t end) {
+        std::vector<int32_t> counts(axisDim, 0);
+
+        for (size_t line = start; line < end; line++) {
+            const size_t outer = line / lineStride;
+            const size_t inner = line % lineStride;
+            const size_t updOffset = outer * updateBlockND[axis] + inner;
+            // offset of the line in the output
+            size_t dstOffset = 0;
+            size_t rest = inner;
+            for (int j = updateRank - 1; j > axis; j--) {
+                dstOffset += (rest % updateDim[j]) * srcBlockND[j + 1];
+                rest /= updateDim[j];
+            }
+            rest = outer;
+            for (int j = axis - 1; j >= 0; j--) {
+                dstOffset += (rest % updateDim[j]) * srcBlockND[j + 1];
+                rest /= updateDim[j];
+            }
+
+            for (size_t k = 0; k < lineLength; k++) {
+                const size_t updIdx = updOffset + k * lineStride;
+                int64_t idxValue = getIndicesValue(indices, updIdx);
+                if (idxValue < 0)
+                    idxValue += axisDim;
+                if (idxValue < 0 || idxValue >= axisDim)
+                    continue;
+                auto& dstValue = dst[dstOffset + idxValue * dstAxisStride];
+                const auto updValue = static_cast<T>(upd[updIdx]);
+                dstValue = (counts[idxValue]++ == 0 && !useInitVal) ? updValue : reduce(static_cast<T>(dstValue), updValue);
+            }
+
+            // the counters are reset through the same indices to keep the line processing linear in its length
+            for (size_t k = 0; k < lineLength; k++) {
+                int64_t idxValue = getIndicesValue(indices, updOffset + k * lineStride);
+                if (idxValue < 0)
+                    idxValue += axisDim;
+                if (idxValue < 0 || idxValue >= axisDim || counts[idxValue] == 0)
+                    continue;
+                if (isMean) {
+                    auto& dstValue = dst[dstOffset + idxValue * dstAxisStride];
+                    dstValue = arithmeticMean(static_cast<T>(dstValue), counts[idxValue] + static_cast<int32_t>(useInitVal));
+                }
+                counts[idxValue] = 0;
+            }
+        }
+    });
+}
+
 bool ScatterUpdate::created() const {
     return getType() == Type::ScatterUpdate
             || getType() == Type::ScatterElementsUpdate
@@ -20,6 +20,15 @@ enum class ScatterUpdateMode {
     ScatterElementsUpdate
 };
 
+enum class ScatterReductionMode {
+    None,
+    Sum,
+    Prod,
+    Min,
+    Max,
+    Mean
+};
+
 class ScatterUpdate : public Node {
 public:
     ScatterUpdate(const std::shared_ptr<ngraph::Node>& op, const GraphContext::CPtr context);
@@ -42,9 +51,31 @@ private:
     void scatterUpdate(uint8_t *indicesPtr, uint8_t *updatePtr, int axis, uint8_t *dstDataPtr);
     void scatterNDUpdate(uint8_t *indicesPtr, uint8_t *updatePtr, uint8_t *dstDataPtr);
     void scatterElementsUpdate(uint8_t *indicesPtr, uint8_t *updatePtr, int axis, uint8_t *dstDataPtr);
+    template <typename DataType>
+    void scatterElementsReduce(uint8_t *indicesPtr, uint8_t *updatePtr, int axis, uint8_t *dstDataPtr);
+    template <typename DataType, typename ReduceFunc>
+    void scatterElementsReduce(uint8_t *indicesPtr, uint8_t *updatePtr, int axis, uint8_t *dstDataPtr, const ReduceFunc& reduce);
     inline int64_t getIndicesValue(uint8_t *indices, size_t offset);
 
+    struct ScatterElementsReduceContext {
+        ScatterUpdate* node;
+        uint8_t *indicesPtr;
+        uint8_t *updatePtr;
+        int axis;
+        uint8_t *dstDataPtr;
+    };
+
+    template<typename T>
+    struct ScatterElementsReduceExecute {
+        void operator()(ScatterElementsReduceContext& ctx) {
+            ctx.node->scatterElementsReduce<T>(ctx.indicesPtr, ctx.updatePtr, ctx.axis, ctx.dstDataPtr);
+        }
+    };
+
     ScatterUpdateMode scatterUpdateMode = ScatterUpdateMode::ScatterUpdate;
+    // ScatterElementsUpdate-12 reduction of the updates pointing to the same element
+    ScatterReductionMode reductionMode = ScatterReductionMode::None;
+    bool useInitVal = true;
     enum { DATA_ID, INDICES_ID, UPDATE_ID, AXIS_ID };
 
     // if axis can be set other than default 0.
@@ -78,10 +78,27 @@ static void nullifyUndefinedDims(VectorDims& dims) {
     });
 }
 
+// Body memory may be bound to another buffer only if it's the base of its memory cluster (not a partition of
+// another buffer) and owns no allocation
+static bool isRebindable(const MemoryPtr& mem) {
+    const auto mngr = std::dynamic_pointer_cast<DnnlMemoryMngr>(mem->getMemoryMngr());
+    return mngr && mngr->hasExtBuffer();
+}
+
+static bool isOverlapped(const IMemory& lhs, const IMemory& rhs) {
+    const auto lhs_ptr = static_cast<const uint8_t*>(lhs.getData());
+    const auto rhs_ptr = static_cast<const uint8_t*>(rhs.getData());
+    return lhs_ptr < rhs_ptr + rhs.getSize() && rhs_ptr < lhs_ptr + lhs.getSize();
+}
+
+/**
+ * Moves a chunk between a sliced tensor and the body. If the chunk is a dense block of the sliced tensor and
+ * the body memory may be rebound, the body memory is bound right to the chunk, otherwise the chunk is reordered.
+ */
 class PortIteratorHelper : public PortMapHelper {
 public:
     PortIteratorHelper(MultiCachePtr cache, const MemoryPtr &from, const MemoryPtr &to, bool sliced_src,
-                       const PortMap &slice_rule, const dnnl::engine& eng)
+                       const PortMap &slice_rule, const dnnl::engine& eng, bool rebindable = false)
                        : sliced_src(sliced_src) {
         const auto &full_blob = sliced_src ? from : to;
         const auto &part_blob = !sliced_src ? from : to;
@@ -115,6 +132,15 @@ public:
         chunk_offset_in_byte = sign_of_stride < 0 ? (iter_count - 1) * chunk_stride_in_byte : 0;
         chunk_stride_in_byte *= sign_of_stride;
 
+        // with unit outer dimensions the chunk of a plain tensor is laid out exactly as the plain part
+        const bool dense_chunk = std::all_of(full_dims.begin(), full_dims.begin() + axis, [](size_t dim) { return dim == 1; });
+        if (rebindable && dense_chunk && full_blob->getDataType() == part_blob->getDataType() &&
+            full_blob->getDesc().hasLayoutType(LayoutType::ncsp) && part_blob->getDesc().hasLayoutType(LayoutType::ncsp)) {
+            part_mngr = part_blob->getMemoryMngr();
+            chunk_size = part_blob->getSize();
+            return;
+        }
+
         if (sliced_src) {
             mem_holder_src = chunk_mem;
             mem_holder_dst = to->getPrimitive();
@@ -125,12 +151,21 @@ public:
         reorder = getReorderPrim(cache, mem_holder_dst.get_engine(), mem_holder_src.get_desc(), mem_holder_dst.get_desc());
     }
 
+    bool isInPlace() const {
+        return part_mngr != nullptr;
+    }
+
     void execute(dnnl::stream strm, int iter) override {
         IE_ASSERT(iter >= 0 && iter < iter_count);
 
+        auto chunk_ptr = static_cast<uint8_t *>(full_mem.get_data_handle()) + chunk_offset_in_byte + chunk_stride_in_byte * iter;
+        if (part_mngr) {
+            part_mngr->setExtBuff(chunk_ptr, chunk_size);
+            return;
+        }
+
         auto &chunk_mem = sliced_src ? mem_holder_src : mem_holder_dst;
-        chunk_mem.set_data_handle(static_cast<uint8_t *>(full_mem.get_data_handle()) +
-                                          chunk_offset_in_byte + chunk_stride_in_byte * iter);
+        chunk_mem.set_data_handle(chunk_ptr);
 
         reorder.execute(strm, {{DNNL_ARG_FROM, mem_holder_src}, {DNNL_ARG_TO, mem_holder_dst}});
     }
@@ -142,6 +177,10 @@ private:
     bool sliced_src;
     dnnl::memory full_mem;
 
+    // memory manager of the body memory bound to the chunk in place
+    MemoryMngrPtr part_mngr;
+    size_t chunk_size = 0lu;
+
     int iter_count;
 };
 
@@ -150,14 +189,52 @@ public:
     BackEdgePortHelper(MultiCachePtr cache, const MemoryPtr &from, const MemoryPtr &to, const dnnl::engine& eng) {
         mem_holder_src = from->getPrimitive();
         mem_holder_dst = to->getPrimitive();
-        reorder = getReorderPrim(cache, mem_holder_dst.get_engine(), mem_holder_src.get_desc(), mem_holder_dst.get_desc());
+        // the same layout on both sides doesn't need a reorder
+        if (mem_holder_src.get_desc() == mem_holder_dst.get_desc()) {
+            copy_size = mem_holder_src.get_desc().get_size();
+        } else {
+            reorder = getReorderPrim(cache, mem_holder_dst.get_engine(), mem_holder_src.get_desc(), mem_holder_dst.get_desc());
+        }
     }
 
     void execute(dnnl::stream strm, int iter = -1) override {
         if (iter != 0) {
-            reorder.execute(strm, {{DNNL_ARG_FROM, mem_holder_src}, {DNNL_ARG_TO, mem_holder_dst}});
+            if (reorder) {
+                reorder.execute(strm, {{DNNL_ARG_FROM, mem_holder_src}, {DNNL_ARG_TO, mem_holder_dst}});
+                return;
+            }
+            const auto src = mem_holder_src.get_data_handle();
+            const auto dst = mem_holder_dst.get_data_handle();
+            if (src != dst)
+                cpu_memcpy(dst, src, copy_size);
         }
     }
+
+private:
+    size_t copy_size = 0lu;
+};
+
+/**
+ * Passes a back edge to the next iteration by exchanging the buffers of the body output and the body input,
+ * so they ping-pong between two buffers without any copy.
+ */
+class BackEdgeSwapHelper : public PortMapHelper {
+public:
+    BackEdgeSwapHelper(const MemoryPtr &from, const MemoryPtr &to)
+        : from_mngr(from->getMemoryMngr()), to_mngr(to->getMemoryMngr()), size(from->getSize()) {}
+
+    void execute(dnnl::stream strm, int iter = -1) override {
+        if (iter != 0) {
+            auto from_ptr = from_mngr->getRawPtr();
+            from_mngr->setExtBuff(to_mngr->getRawPtr(), size);
+            to_mngr->setExtBuff(from_ptr, size);
+        }
+    }
+
+private:
+    MemoryMngrPtr from_mngr;
+    MemoryMngrPtr to_mngr;
+    size_t size;
 };
 
 class IterCountPortHelper : public PortMapHelper {
@@ -546,7 +623,9 @@ void TensorIterator::prepareParams() {
     prepareInitialCond();
 
     first_mappers.clear();
+    last_mappers.clear();
     before_mappers.clear();
+    after_mappers.clear();
     back_mappers.clear();
 
     if ((lastUsedCond && lastUsedTripCount != 0) || !isDynamicNode()) {
@@ -556,6 +635,10 @@ void TensorIterator::prepareParams() {
         prepareContinueCond();
         prepareLoopBodyCurrentIteration();
 
+        // Sliced outputs written in place and swapped back edges are set up for static bodies only.
+        // Memory of a dynamic body is resized whenever a shape changes, and a resize may free a buffer
+        // that was handed over to another memory, so a dynamic body copies its back edges
+        // (prepareDynamicBackEdges) and gathers its sliced outputs in DynamicBuffer.
         if (!isDynamicNode()) {
             prepareOutputPorts();
             prepareBackEdges();
@@ -637,11 +720,15 @@ void TensorIterator::prepareInputPorts() {
         auto from_mem = getParentEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
         auto &to_mem = input_mems[map_rule.to].front();  // first memory is enough to access the shared underlying physical memory
 
-        if (map_rule.axis == -1)
+        if (map_rule.axis == -1) {
             first_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(context->getParamsCache(), from_mem, to_mem, eng));
-        else
+        } else {
+            // the body of a static node reads the chunk right from the input of the node,
+            // a dynamic body gets it copied, see prepareParams()
+            const bool rebindable = !isDynamicNode() && isExclusiveBodyMemory(to_mem) && isReadOnlyBodyInput(to_mem);
             before_mappers.emplace_back(
-                    std::make_shared<PortIteratorHelper>(context->getParamsCache(), from_mem, to_mem, true, map_rule, eng));
+                    std::make_shared<PortIteratorHelper>(context->getParamsCache(), from_mem, to_mem, true, map_rule, eng, rebindable));
+        }
     }
 }
 
@@ -651,10 +738,22 @@ void TensorIterator::prepareOutputPorts() {
         auto to_mem = getChildEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
         auto &from_mem = output_mem[map_rule.to];
 
-        if (map_rule.axis == -1)
+        if (map_rule.axis == -1) {
             last_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(context->getParamsCache(), from_mem, to_mem, eng));
+            continue;
+        }
+
+        // the body writes the chunk right to the output of the node, unless the buffer of the body output
+        // goes to the next iteration through a back edge
+        const bool is_back_edge = std::any_of(backEdges.begin(), backEdges.end(), [&](const PortMap& back_edge) {
+            return back_edge.from == map_rule.to;
+        });
+        const bool rebindable = !is_back_edge && isExclusiveBodyMemory(from_mem);
+        auto mapper = std::make_shared<PortIteratorHelper>(context->getParamsCache(), from_mem, to_mem, false, map_rule, eng, rebindable);
+        if (mapper->isInPlace())
+            before_mappers.emplace_back(mapper);
         else
-            after_mappers.emplace_back(std::make_shared<PortIteratorHelper>(context->getParamsCache(), from_mem, to_mem, false, map_rule, eng));
+            after_mappers.emplace_back(mapper);
     }
 }
 
@@ -664,7 +763,16 @@ void TensorIterator::prepareBackEdges() {
         auto from_mem = output_mem[map_rule.from];
         auto to_mem = input_mems[map_rule.to].front();
 
-        before_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(context->getParamsCache(), from_mem, to_mem, eng));
+        // the buffers may be exchanged only if the body output isn't passed to several body inputs
+        const auto from_uses = std::count_if(backEdges.begin(), backEdges.end(), [&](const PortMap& back_edge) {
+            return back_edge.from == map_rule.from;
+        });
+        if (from_uses == 1 && from_mem->getDesc().isCompatible(to_mem->getDesc()) &&
+            isExclusiveBodyMemory(from_mem) && isExclusiveBodyMemory(to_mem)) {
+            before_mappers.emplace_back(std::make_shared<BackEdgeSwapHelper>(from_mem, to_mem));
+        } else {
+            before_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(context->getParamsCache(), from_mem, to_mem, eng));
+        }
     }
 }
 
@@ -725,6 +833,40 @@ void TensorIterator::prepareTripCount() {
     lastUsedTripCount = trip_count_check->getStatus();
 }
 
+bool TensorIterator::isExclusiveBodyMemory(const MemoryPtr& mem) const {
+    if (!isRebindable(mem))
+        return false;
+
+    // the memory itself is the only input or output of the body within its buffer
+    size_t shared_ports = 0;
+    for (const auto& mems : input_mems) {
+        if (isOverlapped(*mems.front(), *mem))
+            shared_ports++;
+    }
+    for (const auto& out : output_mem) {
+        if (isOverlapped(*out, *mem))
+            shared_ports++;
+    }
+    return shared_ports == 1;
+}
+
+bool TensorIterator::isReadOnlyBodyInput(const MemoryPtr& mem) {
+    for (const auto& edge : sub_graph.GetEdges()) {
+        const auto parent = edge->getParent();
+        if (parent->getType() == Type::Input || !isOverlapped(edge->getMemory(), *mem))
+            continue;
+
+        // only views (Reshape, Squeeze, Unsqueeze, Split) share the buffer of their input without writing to it,
+        // any other node inside the buffer writes to it, including the in-place ones like Eltwise
+        if (!one_of(parent->getType(), Type::Reshape, Type::Split))
+            return false;
+        const auto& outConfs = parent->getSelectedPrimitiveDescriptor()->getConfig().outConfs;
+        if (outConfs[edge->getInputNum()].inPlace() < 0)
+            return false;
+    }
+    return true;
+}
+
 /* *==============* *==============* *==============* *==============* *==============* */
 
 inline SizeVector sliced_input_dims(const MemoryPtr& mem, const int axis, const int stride) {
@@ -133,6 +133,10 @@ private:
     void prepareInitialCond();
     void prepareTripCount();
 
+    /* Zero-copy support */
+    bool isExclusiveBodyMemory(const MemoryPtr& mem) const;
+    bool isReadOnlyBodyInput(const MemoryPtr& mem);
+
     /* Dynamic support */
     void reshapeSubgraphInput();
     void reshapeAndFillOutput(dnnl::stream strm);
@@ -2004,6 +2004,16 @@ void TopK::prepareParams() {
         top_k = reinterpret_cast<int *>(getParentEdgeAt(TOPK_K)->getMemoryPtr()->getData())[0];
     }
 
+    // long rows along the innermost axis of planar layouts are processed by the radix select in both jit and
+    // reference modes, it scales with the number of threads even for a single row
+    const bool planar_innermost = (layout == TopKLayoutType::topk_ncsp && axis == static_cast<int>(src_dims.size() - 1)) ||
+                                  (layout == TopKLayoutType::topk_nspc && axis == 1);
+    if (planar_innermost && TopKRadixSelect::isApplicable(src_dims[axis], static_cast<size_t>(top_k))) {
+        radix_select = std::make_shared<TopKRadixSelect>(src_dims[axis], static_cast<size_t>(top_k), mode_max, sort_index);
+    } else {
+        radix_select.reset();
+    }
+
     if (jit_mode) {
         if (!preset_params_done) {
             preset_params();
@@ -2145,7 +2155,9 @@ void TopK::execute(dnnl::stream strm) {
     uint8_t *dst_data = reinterpret_cast<uint8_t *>(dstMemPtr->getData());
     uint8_t *dst_idx = reinterpret_cast<uint8_t *>(dstIndexesMemPtr->getData());
 
-    if (jit_mode) {
+    if (radix_select) {
+        topk_radix_select_process(src_data, dst_data, dst_idx);
+    } else if (jit_mode) {
         topk_process(src_data, dst_data, dst_idx);
     } else {
         if (layout == TopKLayoutType::topk_ncsp) {
@@ -2212,6 +2224,37 @@ void TopK::topk_process(const uint8_t *in_ptr, uint8_t *out_ptr, uint8_t *out_id
     }
 }
 
+void TopK::topk_radix_select_process(const uint8_t *in_ptr, uint8_t *out_ptr, uint8_t *out_idx_ptr) {
+    const size_t rows = static_cast<size_t>(count(src_dims)) / src_dims[axis];
+    auto out_idx = reinterpret_cast<int32_t *>(out_idx_ptr);
+    const WorkSplitter parallel;
+    const auto precision = getParentEdgeAt(TOPK_DATA)->getMemory().getDesc().getPrecision();
+    switch (precision) {
+    case Precision::FP32:
+        radix_select->execute(reinterpret_cast<const float *>(in_ptr), reinterpret_cast<float *>(out_ptr),
+                              out_idx, rows, parallel);
+        break;
+    case Precision::BF16:
+        radix_select->execute(reinterpret_cast<const bfloat16_t *>(in_ptr), reinterpret_cast<bfloat16_t *>(out_ptr),
+                              out_idx, rows, parallel);
+        break;
+    case Precision::I32:
+        radix_select->execute(reinterpret_cast<const int32_t *>(in_ptr), reinterpret_cast<int32_t *>(out_ptr),
+                              out_idx, rows, parallel);
+        break;
+    case Precision::I8:
+        radix_select->execute(reinterpret_cast<const int8_t *>(in_ptr), reinterpret_cast<int8_t *>(out_ptr),
+                              out_idx, rows, parallel);
+        break;
+    case Precision::U8:
+        radix_select->execute(reinterpret_cast<const uint8_t *>(in_ptr), reinterpret_cast<uint8_t *>(out_ptr),
+                              out_idx, rows, parallel);
+        break;
+    default:
+        IE_THROW() << errorPrefix << " doesn't support precision " << precision << " in the radix select.";
+    }
+}
+
 inline void TopK::topk_kernel_process(const uint8_t *in_p, uint8_t *out_p, uint8_t *out_idx_p,
                                                 uint8_t *process_p, uint8_t *process_idx_p, size_t work_amount) {
     auto arg = jit_topk_call_args();
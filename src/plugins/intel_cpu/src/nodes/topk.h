@@ -11,6 +11,8 @@
 #include <memory>
 #include <vector>
 
+#include "common/topk_radix_select.h"
+
 namespace ov {
 namespace intel_cpu {
 namespace node {
@@ -100,6 +102,7 @@ public:
 
 private:
     void topk_process(const uint8_t *in_ptr, uint8_t *out_ptr, uint8_t *dst_idx);
+    void topk_radix_select_process(const uint8_t *in_ptr, uint8_t *out_ptr, uint8_t *dst_idx);
     void topk_ref(const float *in_ptr, float *out_ptr, int32_t *dst_idx);
     inline void topk_kernel_process(const uint8_t *in_p, uint8_t *out_p, uint8_t *src_idx,
                                     uint8_t *process_p, uint8_t *process_idx_p, size_t work_amount);
@@ -146,6 +149,9 @@ private:
 
     std::shared_ptr<jit_uni_topk_kernel> topk_kernel = nullptr;
 
+    // selection by radix for long innermost axes, chosen by the axis length and K on each shape change
+    std::shared_ptr<TopKRadixSelect> radix_select = nullptr;
+
     std::string errorPrefix;
 };
 
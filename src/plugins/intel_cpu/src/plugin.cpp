@@ -150,6 +150,18 @@ Engine::~Engine() {
     executorManager()->clear("CPUCallbackExecutor");
 }
 
+// NUMA nodes are exposed as sub-devices on request only, by default the whole CPU is a single device
+static std::vector<std::string> getAvailableDevices(const Config& config) {
+    const auto numaNodes = getAvailableNUMANodes();
+    if (!config.numaSubDevices || numaNodes.size() < 2)
+        return {""};
+
+    std::vector<std::string> devices;
+    for (const auto node : numaNodes)
+        devices.push_back(std::to_string(node));
+    return devices;
+}
+
 static bool streamsSet(const std::map<std::string, std::string>& config) {
     return config.count(PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS) ||
            config.count(ov::num_streams.name());
@@ -274,7 +286,9 @@ void Engine::ApplyPerformanceHints(std::map<std::string, std::string> &config, c
 
 void Engine::GetPerformanceStreams(Config& config, const std::shared_ptr<ngraph::Function>& ngraphFunc) {
     const auto perf_hint_name = config.perfHintsConfig.ovPerfHint;
-    const int latency_streams = get_default_latency_streams(config.latencyThreadingMode);
+    // a NUMA node sub-device is a single NUMA node for the latency hint
+    const int latency_streams =
+        config.numaNodeIndex >= 0 ? 1 : get_default_latency_streams(config.latencyThreadingMode);
     int streams;
 
     if (config.streamExecutorConfig._streams_changed) {
@@ -627,7 +641,7 @@ Parameter Engine::GetMetricLegacy(const std::string& name, const std::map<std::s
     } else if (name == METRIC_KEY(FULL_DEVICE_NAME)) {
         IE_SET_METRIC_RETURN(FULL_DEVICE_NAME, deviceFullName);
     } else if (name == METRIC_KEY(AVAILABLE_DEVICES)) {
-        std::vector<std::string> availableDevices = { "" };
+        std::vector<std::string> availableDevices = getAvailableDevices(engConfig);
         IE_SET_METRIC_RETURN(AVAILABLE_DEVICES, availableDevices);
     } else if (name == METRIC_KEY(OPTIMIZATION_CAPABILITIES)) {
         std::vector<std::string> capabilities;
@@ -699,6 +713,9 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
                                                     RW_property(ov::device::id.name()),
                                                     RW_property(ov::intel_cpu::denormals_optimization.name()),
                                                     RW_property(ov::intel_cpu::sparse_weights_decompression_rate.name()),
+                                                    RW_property(ov::intel_cpu::huge_pages.name()),
+                                                    RW_property(ov::intel_cpu::numa_memory_placement.name()),
+                                                    RW_property(ov::intel_cpu::numa_sub_devices.name()),
         };
 
         std::vector<ov::PropertyName> supportedProperties;
@@ -714,7 +731,7 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
     } else if (name == ov::device::full_name) {
         return decltype(ov::device::full_name)::value_type(deviceFullName);
     } else if (name == ov::available_devices) {
-        const std::vector<std::string> availableDevices = { "" };
+        const std::vector<std::string> availableDevices = getAvailableDevices(engConfig);
         return decltype(ov::available_devices)::value_type(availableDevices);
     } else if (name == ov::device::capabilities) {
         std::vector<std::string> capabilities;
@@ -741,6 +758,12 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
         return decltype(ov::intel_cpu::denormals_optimization)::value_type(engConfig.denormalsOptMode == Config::DenormalsOptMode::DO_On);
     } else if (name == ov::intel_cpu::sparse_weights_decompression_rate) {
         return decltype(ov::intel_cpu::sparse_weights_decompression_rate)::value_type(engConfig.fcSparseWeiDecompressionRate);
+    } else if (name == ov::intel_cpu::huge_pages) {
+        return decltype(ov::intel_cpu::huge_pages)::value_type(engConfig.hugePages);
+    } else if (name == ov::intel_cpu::numa_memory_placement) {
+        return decltype(ov::intel_cpu::numa_memory_placement)::value_type(engConfig.numaMemoryPlacement);
+    } else if (name == ov::intel_cpu::numa_sub_devices) {
+        return decltype(ov::intel_cpu::numa_sub_devices)::value_type(engConfig.numaSubDevices);
     }
     /* Internally legacy parameters are used with new API as part of migration procedure.
      * This fallback can be removed as soon as migration completed */
@@ -155,11 +155,13 @@ ov::intel_cpu::ConvertFqRnnToQuantizedRnn::ConvertFqRnnToQuantizedRnn() {
         // input scales (Multiply per tensor) and weights_scales (Multiply per multiple dimensions) must be present
         const auto& input_scale_output   = pattern_map.at(input_scale_X);
         const auto& weights_scale_output = pattern_map.at(weights_scale_W);
+        const auto& r_weights_scale_output = pattern_map.at(weights_scale_R);
         // extract constant values
         const auto input_scale_constant   = std::dynamic_pointer_cast<ngraph::opset9::Constant>(input_scale_output.get_node_shared_ptr());
         const auto weights_scale_constant = std::dynamic_pointer_cast<ngraph::opset9::Constant>(weights_scale_output.get_node_shared_ptr());
+        const auto r_weights_scale_constant = std::dynamic_pointer_cast<ngraph::opset9::Constant>(r_weights_scale_output.get_node_shared_ptr());
 
-        if (!input_scale_constant || !weights_scale_constant)
+        if (!input_scale_constant || !weights_scale_constant || !r_weights_scale_constant)
             return false;
 
         const float* input_scale_ptr = input_scale_constant->get_data_ptr<float>();
@@ -169,6 +171,12 @@ ov::intel_cpu::ConvertFqRnnToQuantizedRnn::ConvertFqRnnToQuantizedRnn() {
         const float input_scale  = 1 / *input_scale_ptr;
         std::vector<float> weights_scales  = weights_scale_constant->get_vector<float>();
 
+        // oneDNN applies the same weights scales to W and R, either per tensor or per gate and output channel
+        const auto gates_channels = weights.get_shape()[1];
+        if (r_weights_scale_constant->get_vector<float>() != weights_scales ||
+            (weights_scales.size() != 1 && weights_scales.size() != gates_channels))
+            return false;
+
         // transform dequantization scales into quantization ones
         std::transform(weights_scales.begin(), weights_scales.end(), weights_scales.begin(), [](float& scale) { return 1 / scale; });
 
@@ -0,0 +1,109 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "memory_placement.hpp"
+
+#include <algorithm>
+#include <climits>
+
+#include <common/utils.hpp>
+#include <ie_system_conf.h>
+
+#if defined(__linux__)
+#   include <sys/mman.h>
+#   include <sys/syscall.h>
+#   include <unistd.h>
+#endif
+
+namespace ov {
+namespace intel_cpu {
+namespace {
+
+thread_local const MemoryPlacement* currentPlacement = nullptr;
+
+const MemoryPlacement& defaultPlacement() {
+    static const MemoryPlacement placement;
+    return placement;
+}
+
+#if defined(__linux__)
+constexpr size_t pageSize = 4096;
+constexpr size_t hugePageSize = 2 * 1024 * 1024;
+
+// Values from linux/mempolicy.h, mbind is called through syscall to avoid the dependency on libnuma
+constexpr int mpolPreferred = 1;
+constexpr int mpolInterleave = 3;
+constexpr unsigned mpolMfMove = 1 << 1;
+
+void bindToNodes(void* ptr, size_t size, const std::vector<int>& nodes) {
+#   if defined(SYS_mbind)
+    if (*std::min_element(nodes.begin(), nodes.end()) < 0) {
+        return;
+    }
+    const auto maxNode = static_cast<size_t>(*std::max_element(nodes.begin(), nodes.end()));
+    constexpr size_t bitsPerMask = sizeof(unsigned long) * CHAR_BIT;  // NOLINT
+    std::vector<unsigned long> nodeMask(maxNode / bitsPerMask + 1, 0);  // NOLINT
+    for (const auto node : nodes) {
+        nodeMask[node / bitsPerMask] |= 1ul << (node % bitsPerMask);
+    }
+    const int mode = nodes.size() == 1 ? mpolPreferred : mpolInterleave;
+    // The policy is only a hint: if the kernel rejects it, memory stays on the first touch node
+    syscall(SYS_mbind, ptr, size, mode, nodeMask.data(), nodeMask.size() * bitsPerMask + 1, mpolMfMove);
+#   endif
+}
+#endif
+
+}  // namespace
+
+MemoryPlacementScope::MemoryPlacementScope(const MemoryPlacement& placement) : m_prev(currentPlacement) {
+    currentPlacement = &placement;
+}
+
+MemoryPlacementScope::~MemoryPlacementScope() {
+    currentPlacement = m_prev;
+}
+
+const MemoryPlacement& MemoryPlacementScope::current() {
+    return currentPlacement ? *currentPlacement : defaultPlacement();
+}
+
+std::vector<int> getSocketNumaNodes(int socketId) {
+    std::vector<int> nodes;
+    for (const auto node : InferenceEngine::getAvailableNUMANodes()) {
+        if (node >= 0 && InferenceEngine::get_socket_by_numa_node(node) == socketId) {
+            nodes.push_back(node);
+        }
+    }
+    return nodes;
+}
+
+void* allocatePlaced(size_t size, size_t alignment) {
+#if defined(__linux__)
+    const auto& placement = MemoryPlacementScope::current();
+    const bool useHugePages = placement.hugePages && size >= hugePageSize;
+    // memory policy is applied per page, smaller buffers stay on the node of the allocating stream anyway
+    const bool bindToNuma = !placement.numaNodes.empty() && size >= pageSize;
+    if (useHugePages || bindToNuma) {
+        const size_t placementAlignment = useHugePages ? hugePageSize : pageSize;
+        const size_t placedSize = dnnl::impl::utils::rnd_up(size, placementAlignment);
+        void* ptr = dnnl::impl::malloc(placedSize, static_cast<int>(std::max(alignment, placementAlignment)));
+        if (!ptr) {
+            return nullptr;
+        }
+#   if defined(MADV_HUGEPAGE)
+        if (useHugePages) {
+            madvise(ptr, placedSize, MADV_HUGEPAGE);
+        }
+#   endif
+        if (bindToNuma) {
+            bindToNodes(ptr, placedSize, placement.numaNodes);
+        }
+        return ptr;
+    }
+#endif
+    return dnnl::impl::malloc(size, static_cast<int>(alignment));
+}
+
+}  // namespace intel_cpu
+}  // namespace ov
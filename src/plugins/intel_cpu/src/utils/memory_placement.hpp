@@ -0,0 +1,61 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Placement policy of the memory allocated by the plugin for weights and intermediate tensors.
+ */
+struct MemoryPlacement {
+    // Large buffers are aligned to huge page size and advised to be backed by transparent huge pages
+    bool hugePages = false;
+    // NUMA nodes the memory is placed on: empty - no explicit placement (first touch),
+    // single node - memory is bound to the node, several nodes - memory pages are interleaved across the nodes
+    std::vector<int> numaNodes;
+
+    bool isDefault() const {
+        return !hugePages && numaNodes.empty();
+    }
+};
+
+/**
+ * @brief Sets the placement policy used by allocations of the current thread for the scope lifetime.
+ *
+ * The plugin creates the graph and runs the inference on the stream threads, so the policy of the stream
+ * is applied to both weights and activations without passing it through every node.
+ */
+class MemoryPlacementScope {
+public:
+    explicit MemoryPlacementScope(const MemoryPlacement& placement);
+    ~MemoryPlacementScope();
+
+    MemoryPlacementScope(const MemoryPlacementScope&) = delete;
+    MemoryPlacementScope& operator=(const MemoryPlacementScope&) = delete;
+
+    static const MemoryPlacement& current();
+
+private:
+    const MemoryPlacement* m_prev;
+};
+
+/**
+ * @brief Returns NUMA nodes of the socket, empty if the information is not available
+ */
+std::vector<int> getSocketNumaNodes(int socketId);
+
+/**
+ * @brief Allocates memory according to the placement policy of the current thread.
+ * The memory must be released with dnnl::impl::free().
+ * @return pointer to the allocated memory or nullptr if the allocation failed
+ */
+void* allocatePlaced(size_t size, size_t alignment);
+
+}  // namespace intel_cpu
+}  // namespace ov
@@ -0,0 +1,85 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+
+#include "openvino/core/parallel.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Splits work into one contiguous chunk per thread and runs it with parallel_nt_static.
+ *
+ * Unlike a plain parallel_nt_static call, the number of threads is bounded by the amount of work,
+ * and work of a single thread runs in the calling thread without entering a parallel region.
+ * It holds no threads and no state except the thread limit, so it is created where it is needed.
+ */
+class WorkSplitter {
+public:
+    /**
+     * @param maxThreads upper bound of the number of threads, 0 - all threads of the current arena
+     */
+    explicit WorkSplitter(int maxThreads = 0) : m_maxThreads(maxThreads) {}
+
+    int getNumThreads() const {
+        const int arenaThreads = parallel_get_max_threads();
+        return m_maxThreads > 0 ? std::min(m_maxThreads, arenaThreads) : arenaThreads;
+    }
+
+    /**
+     * @brief Number of threads to wake up for the work of @p work items, each thread gets @p minWork items at least.
+     */
+    int getNumThreads(size_t work, size_t minWork = 1) const {
+        const size_t maxChunks = (work + minWork - 1) / std::max<size_t>(minWork, 1);
+        return static_cast<int>(std::max<size_t>(1, std::min<size_t>(getNumThreads(), maxChunks)));
+    }
+
+    /**
+     * @brief Calls func(ithr, nthr) on @p nthr threads, inline if @p nthr is 1.
+     */
+    template <typename F>
+    void parallelNt(int nthr, const F& func) const {
+        if (nthr <= 1) {
+            func(0, 1);
+            return;
+        }
+        parallel_nt_static(nthr, func);
+    }
+
+    /**
+     * @brief Splits [0, work) into contiguous ranges and calls func(start, end) once per non empty range.
+     */
+    template <typename F>
+    void parallelForRange(size_t work, size_t minWork, const F& func) const {
+        if (work == 0)
+            return;
+        parallelNt(getNumThreads(work, minWork), [&](const int ithr, const int nthr) {
+            size_t start = 0, end = 0;
+            splitter(work, nthr, ithr, start, end);
+            if (start < end)
+                func(start, end);
+        });
+    }
+
+    /**
+     * @brief Calls func(i) for each i in [0, work).
+     */
+    template <typename F>
+    void parallelFor(size_t work, const F& func, size_t minWork = 1) const {
+        parallelForRange(work, minWork, [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; i++)
+                func(i);
+        });
+    }
+
+private:
+    int m_maxThreads;
+};
+
+}  // namespace intel_cpu
+}  // namespace ov
@@ -45,6 +45,11 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::findOrCreate(
 
         if (found == sharedWeights.end()
             || !((ptr = found->second) && (newPtr = ptr->sharedMemory.lock()))) {
+            MemoryPlacement placement = MemoryPlacementScope::current();
+            if (!placement.numaNodes.empty() && !numaNodes.empty()) {
+                placement.numaNodes = numaNodes;
+            }
+            MemoryPlacementScope memoryPlacementScope(placement);
             newPtr = create();
             ptr = std::make_shared<MemoryInfo>(newPtr, valid);
             sharedWeights[key] = ptr;
@@ -74,7 +79,7 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::get(const std::string& key) co
 SocketsWeights::SocketsWeights() {
     int num_sockets = get_num_sockets();
     for (int socket_id = 0; socket_id < num_sockets; socket_id++)
-         _cache_map[socket_id] = std::make_shared<WeightsSharing>();
+         _cache_map[socket_id] = std::make_shared<WeightsSharing>(getSocketNumaNodes(socket_id));
 }
 
 WeightsSharing::Ptr& SocketsWeights::operator[](int socket_id) {
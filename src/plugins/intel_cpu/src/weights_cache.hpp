@@ -5,6 +5,7 @@
 #pragma once
 
 #include "cpu_memory.h"
+#include "utils/memory_placement.hpp"
 
 #include <unordered_map>
 #include <functional>
@@ -13,6 +14,7 @@
 #include <atomic>
 #include <mutex>
 #include <map>
+#include <vector>
 
 // TODO: While CPU plugin has no ease way to clone graph object we use weight
 //       caching in global Engine context to avoid tensor memory duplication.
@@ -70,6 +72,13 @@ class WeightsSharing {
 public:
     typedef std::shared_ptr<WeightsSharing> Ptr;
 
+    WeightsSharing() = default;
+    /**
+     * @param numaNodes NUMA nodes of the streams sharing the cache, weights are interleaved across them
+     *        when the memory of the streams is explicitly placed on NUMA nodes
+     */
+    explicit WeightsSharing(std::vector<int> numaNodes) : numaNodes(std::move(numaNodes)) {}
+
     class SharedMemory {
     public:
         typedef std::shared_ptr<SharedMemory> Ptr;
@@ -99,6 +108,7 @@ public:
 protected:
     mutable std::mutex guard;
     std::unordered_map<std::string, MemoryInfo::Ptr> sharedWeights;
+    std::vector<int> numaNodes;
     static const SimpleDataHash simpleCRC;
 };
 
@@ -40,6 +40,8 @@ TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkSupportedPropertiesAreAvailable
         RO_property(ov::execution_devices.name()),
         RO_property(ov::intel_cpu::denormals_optimization.name()),
         RO_property(ov::intel_cpu::sparse_weights_decompression_rate.name()),
+        RO_property(ov::intel_cpu::huge_pages.name()),
+        RO_property(ov::intel_cpu::numa_memory_placement.name()),
     };
 
     ov::Core ie;
@@ -144,6 +146,37 @@ TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckSparseWeigthsDecompression
     ASSERT_NO_THROW(ov::CompiledModel compiledModel = core.compile_model(model, deviceName));
 }
 
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckMemoryPlacement) {
+    ov::Core core;
+
+    core.set_property(deviceName, ov::intel_cpu::huge_pages(true));
+    ov::CompiledModel compiledModel;
+    ASSERT_NO_THROW(compiledModel = core.compile_model(model, deviceName, ov::intel_cpu::numa_memory_placement(true)));
+    ASSERT_TRUE(compiledModel.get_property(ov::intel_cpu::huge_pages));
+    ASSERT_TRUE(compiledModel.get_property(ov::intel_cpu::numa_memory_placement));
+
+    auto request = compiledModel.create_infer_request();
+    ASSERT_NO_THROW(request.infer());
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkNumaSubDevices) {
+    ov::Core core;
+    const auto numaNodes = InferenceEngine::getAvailableNUMANodes().size();
+
+    core.set_property(deviceName, ov::intel_cpu::numa_sub_devices(true));
+    const auto devices = core.get_property(deviceName, ov::available_devices);
+    ASSERT_EQ(devices.size(), numaNodes > 1 ? numaNodes : 1);
+
+    const auto lastNode = deviceName + "." + std::to_string(numaNodes - 1);
+    ov::CompiledModel compiledModel;
+    ASSERT_NO_THROW(compiledModel = core.compile_model(model, lastNode, ov::hint::performance_mode(ov::hint::PerformanceMode::THROUGHPUT)));
+    auto request = compiledModel.create_infer_request();
+    ASSERT_NO_THROW(request.infer());
+
+    const auto outOfRange = deviceName + "." + std::to_string(numaNodes);
+    ASSERT_THROW(core.compile_model(model, outOfRange), ov::Exception);
+}
+
 const auto bf16_if_can_be_emulated = InferenceEngine::with_cpu_x86_avx512_core() ? ov::element::bf16 : ov::element::f32;
 
 TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckExecutionModeIsAvailableInCoreAndModel) {
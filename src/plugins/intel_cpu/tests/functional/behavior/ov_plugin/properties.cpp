@@ -47,6 +47,9 @@ TEST_F(OVClassConfigTestCPU, smoke_PluginAllSupportedPropertiesAreAvailable) {
         RW_property(ov::device::id.name()),
         RW_property(ov::intel_cpu::denormals_optimization.name()),
         RW_property(ov::intel_cpu::sparse_weights_decompression_rate.name()),
+        RW_property(ov::intel_cpu::huge_pages.name()),
+        RW_property(ov::intel_cpu::numa_memory_placement.name()),
+        RW_property(ov::intel_cpu::numa_sub_devices.name()),
     };
 
     ov::Core ie;
@@ -0,0 +1,22 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "behavior/ov_infer_request/streaming_session.hpp"
+#include "common_test_utils/test_constants.hpp"
+
+using namespace ov::test::behavior;
+
+namespace {
+
+const std::vector<ov::AnyMap> configs = {
+    {}
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_BehaviorTests, OVStreamingSessionTest,
+                        ::testing::Combine(
+                                ::testing::Values(ov::test::utils::DEVICE_CPU),
+                                ::testing::ValuesIn(configs)),
+                        OVStreamingSessionTest::getTestCaseName);
+
+}  // namespace
@@ -8,6 +8,8 @@
 #include "test_utils/fusing_test_utils.hpp"
 #include <ngraph_functions/builders.hpp>
 #include <common_test_utils/ov_tensor_utils.hpp>
+#include "shared_test_classes/base/benchmark.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
 
 using namespace InferenceEngine;
 using namespace CPUTestUtils;
@@ -557,6 +559,52 @@ const auto params_5D_dyn_param_Blocked_Blocked = ::testing::Combine(
 INSTANTIATE_TEST_SUITE_P(smoke_CompareWithRefs_5D_MemOrder_dyn_param_Blocked_Blocked, EltwiseLayerCPUTest, params_5D_dyn_param_Blocked_Blocked,
                          EltwiseLayerCPUTest::getTestCaseName);
 
+const std::vector<std::vector<ov::Shape>>& inShapes_4D_Benchmark() {
+        static const std::vector<std::vector<ov::Shape>> inShapes_4D_Benchmark = {
+                {{1, 64, 112, 112}, {1, 64, 112, 112}},
+                {{1, 256, 56, 56}, {1, 256, 1, 1}},
+                {{8, 512, 28, 28}, {8, 512, 28, 28}},
+        };
+        return inShapes_4D_Benchmark;
+}
+
+const std::vector<ov::AnyMap>& additional_config_Benchmark() {
+        // snippets are disabled to measure Eltwise node itself instead of tokenized Subgraph
+        static const std::vector<ov::AnyMap> additional_config_Benchmark = {
+                {{ov::hint::inference_precision.name(), ov::element::f32},
+                 {PluginConfigInternalParams::KEY_SNIPPETS_MODE, PluginConfigInternalParams::DISABLE}},
+                {{ov::hint::inference_precision.name(), ov::element::bf16},
+                 {PluginConfigInternalParams::KEY_SNIPPETS_MODE, PluginConfigInternalParams::DISABLE}},
+        };
+        return additional_config_Benchmark;
+}
+
+struct EltwiseBenchmarkCPUTest : ov::test::BenchmarkLayerTest<EltwiseLayerCPUTest> {};
+
+TEST_P(EltwiseBenchmarkCPUTest, DISABLED_Eltwise_Benchmark) {
+    // the perf counters are named by the type of the operation (Add, Multiply, ...), not by the type of the CPU node
+    const std::string opTypeName = function->get_results().front()->get_input_node_ptr(0)->get_type_name();
+    run_benchmark(opTypeName, std::chrono::milliseconds(1000), 1000);
+}
+
+const auto params_4D_Benchmark = ::testing::Combine(
+        ::testing::Combine(
+                ::testing::ValuesIn(static_shapes_to_test_representation(inShapes_4D_Benchmark())),
+                ::testing::Values(ngraph::helpers::EltwiseTypes::ADD,
+                                  ngraph::helpers::EltwiseTypes::MULTIPLY,
+                                  ngraph::helpers::EltwiseTypes::DIVIDE),
+                ::testing::Values(ngraph::helpers::InputLayerType::PARAMETER),
+                ::testing::Values(ov::test::utils::OpType::VECTOR),
+                ::testing::Values(ElementType::f32),
+                ::testing::Values(ov::element::undefined, ov::element::i8),
+                ::testing::Values(ov::element::undefined),
+                ::testing::Values(ov::test::utils::DEVICE_CPU),
+                ::testing::ValuesIn(additional_config_Benchmark())),
+        ::testing::ValuesIn(filterCPUSpecificParams(cpuParams_4D())),
+        ::testing::Values(emptyFusingSpec));
+
+INSTANTIATE_TEST_SUITE_P(Benchmark_4D, EltwiseBenchmarkCPUTest, params_4D_Benchmark, EltwiseLayerCPUTest::getTestCaseName);
+
 } // namespace
 } // namespace Eltwise
 } // namespace CPULayerTestsDefinitions
\ No newline at end of file
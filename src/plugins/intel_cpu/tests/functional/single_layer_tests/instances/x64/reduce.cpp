@@ -7,6 +7,7 @@
 #include "test_utils/cpu_test_utils.hpp"
 #include "test_utils/fusing_test_utils.hpp"
 #include "lpt_ngraph_functions/common/builders.hpp"
+#include "shared_test_classes/base/benchmark.hpp"
 
 using namespace InferenceEngine;
 using namespace CPUTestUtils;
@@ -619,6 +620,75 @@ INSTANTIATE_TEST_SUITE_P(
         ReduceCPULayerTest::getTestCaseName
 );
 
+/* ============= Benchmark ============= */
+std::vector<std::vector<ov::test::InputShape>> inputShapes_Benchmark = {
+    {{{}, {{1, 256, 56, 56}}}},
+    {{{}, {{8, 512, 28, 28}}}},
+    {{{}, {{1, 64, 112, 112}}}},
+};
+
+const std::vector<std::vector<int>> axes_Benchmark = {
+        {1},
+        {2, 3},
+        {3},
+};
+
+const std::vector<ngraph::helpers::ReductionType> reductionTypes_Benchmark = {
+        ngraph::helpers::ReductionType::Mean,
+        ngraph::helpers::ReductionType::Max,
+        ngraph::helpers::ReductionType::Sum,
+};
+
+struct ReduceBenchmarkCPUTest : ov::test::BenchmarkLayerTest<ReduceCPULayerTest> {};
+
+TEST_P(ReduceBenchmarkCPUTest, DISABLED_Reduce_Benchmark) {
+    // the perf counters are named by the type of the operation (ReduceMean, ReduceMax, ...), not by the type of the CPU node
+    const std::string opTypeName = function->get_results().front()->get_input_node_ptr(0)->get_type_name();
+    run_benchmark(opTypeName, std::chrono::milliseconds(1000), 1000);
+}
+
+const auto params_Benchmark = testing::Combine(
+        testing::Combine(
+            testing::ValuesIn(axes_Benchmark),
+            testing::Values(ov::test::utils::OpType::VECTOR),
+            testing::Values(true),
+            testing::ValuesIn(reductionTypes_Benchmark),
+            testing::Values(ElementType::f32),
+            testing::Values(ElementType::undefined),
+            testing::Values(ElementType::undefined),
+            testing::ValuesIn(inputShapes_Benchmark)),
+        testing::ValuesIn(filterCPUSpecificParams(cpuParams_4D)),
+        testing::Values(emptyFusingSpec),
+        testing::ValuesIn(additionalConfig()));
+
+const auto params_Benchmark_I8 = testing::Combine(
+        testing::Combine(
+            testing::ValuesIn(axes_Benchmark),
+            testing::Values(ov::test::utils::OpType::VECTOR),
+            testing::Values(true),
+            testing::Values(ngraph::helpers::ReductionType::Max, ngraph::helpers::ReductionType::Sum),
+            testing::Values(ElementType::i8),
+            testing::Values(ElementType::undefined),
+            testing::Values(ElementType::undefined),
+            testing::ValuesIn(inputShapes_Benchmark)),
+        testing::ValuesIn(filterCPUSpecificParams(cpuParams_4D)),
+        testing::Values(emptyFusingSpec),
+        testing::ValuesIn(additionalConfigFP32()));
+
+INSTANTIATE_TEST_SUITE_P(
+        Benchmark_Reduce_CPU,
+        ReduceBenchmarkCPUTest,
+        params_Benchmark,
+        ReduceCPULayerTest::getTestCaseName
+);
+
+INSTANTIATE_TEST_SUITE_P(
+        Benchmark_Reduce_I8_CPU,
+        ReduceBenchmarkCPUTest,
+        params_Benchmark_I8,
+        ReduceCPULayerTest::getTestCaseName
+);
+
 } // namespace
 } // namespace Reduce
 } // namespace CPULayerTestsDefinitions
\ No newline at end of file
@@ -9,6 +9,7 @@
 #include <common_test_utils/ov_tensor_utils.hpp>
 #include "openvino/core/preprocess/pre_post_process.hpp"
 #include <transformations/op_conversions/convert_interpolate11_downgrade.hpp>
+#include "shared_test_classes/base/benchmark.hpp"
 
 using namespace ov::test;
 using namespace CPUTestUtils;
@@ -1015,6 +1016,68 @@ INSTANTIATE_TEST_SUITE_P(smoke_InterpolateBicubicPillow_LayoutAlign_Test, Interp
             ::testing::ValuesIn(filterPillowAdditionalConfig())),
     InterpolateLayerCPUTest::getTestCaseName);
 
+/* ============= Benchmark ============= */
+const std::vector<ShapeParams> shapeParams4D_Benchmark = {
+    ShapeParams{
+        ov::op::v11::Interpolate::ShapeCalcMode::SCALES,
+        InputShape{{}, {{1, 64, 56, 56}}},
+        ngraph::helpers::InputLayerType::CONSTANT,
+        {{1.f, 1.f, 2.f, 2.f}},
+        defaultAxes4D.front()
+    },
+    ShapeParams{
+        ov::op::v11::Interpolate::ShapeCalcMode::SCALES,
+        InputShape{{}, {{1, 256, 28, 28}}},
+        ngraph::helpers::InputLayerType::CONSTANT,
+        {{1.f, 1.f, 2.f, 2.f}},
+        defaultAxes4D.front()
+    },
+    ShapeParams{
+        ov::op::v11::Interpolate::ShapeCalcMode::SIZES,
+        InputShape{{}, {{1, 3, 720, 1280}}},
+        ngraph::helpers::InputLayerType::CONSTANT,
+        {{1, 3, 224, 224}},
+        defaultAxes4D.front()
+    },
+};
+
+const auto interpolateCases_Benchmark = ::testing::Combine(
+        ::testing::Values(ov::op::v11::Interpolate::InterpolateMode::NEAREST,
+                          ov::op::v11::Interpolate::InterpolateMode::LINEAR_ONNX,
+                          ov::op::v11::Interpolate::InterpolateMode::CUBIC),
+        ::testing::Values(ov::op::v11::Interpolate::CoordinateTransformMode::HALF_PIXEL),
+        ::testing::ValuesIn(defNearestModes),
+        ::testing::ValuesIn(antialias),
+        ::testing::Values(pads4D.front()),
+        ::testing::Values(pads4D.front()),
+        ::testing::ValuesIn(cubeCoefs));
+
+struct InterpolateBenchmarkCPUTest : ov::test::BenchmarkLayerTest<InterpolateLayerCPUTest> {};
+
+TEST_P(InterpolateBenchmarkCPUTest, DISABLED_Interpolate_Benchmark) {
+    run_benchmark("Interpolate", std::chrono::milliseconds(1000), 1000);
+}
+
+INSTANTIATE_TEST_SUITE_P(Benchmark_Interpolate_Layout_Test, InterpolateBenchmarkCPUTest,
+        ::testing::Combine(
+            interpolateCases_Benchmark,
+            ::testing::ValuesIn(shapeParams4D_Benchmark),
+            ::testing::Values(ElementType::f32),
+            ::testing::ValuesIn(filterCPUInfoForDevice()),
+            ::testing::Values(emptyFusingSpec),
+            ::testing::ValuesIn(filterAdditionalConfig())),
+    InterpolateLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(Benchmark_Interpolate_I8_Layout_Test, InterpolateBenchmarkCPUTest,
+        ::testing::Combine(
+            interpolateCases_Benchmark,
+            ::testing::ValuesIn(shapeParams4D_Benchmark),
+            ::testing::Values(ElementType::i8),
+            ::testing::ValuesIn(filterCPUInfoForDevice()),
+            ::testing::Values(emptyFusingSpec),
+            ::testing::Values(std::map<std::string, std::string>{})),
+    InterpolateLayerCPUTest::getTestCaseName);
+
 } // namespace
 
 } // namespace CPULayerTestsDefinitions
@@ -6,6 +6,7 @@
 #include "shared_test_classes/base/ov_subgraph.hpp"
 #include "ngraph_functions/builders.hpp"
 #include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/benchmark.hpp"
 #include "transformations/op_conversions/bidirectional_sequences_decomposition.hpp"
 #include "transformations/op_conversions/convert_sequences_to_tensor_iterator.hpp"
 
@@ -102,6 +103,12 @@ protected:
             abs_threshold = 0.001f;
             WRB_range = 1.0f;
         }
+        auto it_long_sequence = additionalConfig.find("_long_sequence_test");
+        if (it_long_sequence != additionalConfig.end() && it_long_sequence->second == "yes") {
+            additionalConfig.erase(it_long_sequence);
+            // with bf16 the cell state is rounded on each time step, the error must not accumulate over the sequence
+            abs_threshold = 0.05f;
+        }
 
         configuration.insert(additionalConfig.begin(), additionalConfig.end());
 
@@ -265,6 +272,27 @@ INSTANTIATE_TEST_SUITE_P(nightly_static_bf16_BatchSizeOne, LSTMSequenceCPUTest,
                                    ::testing::ValuesIn(additionalConfig)),
                 LSTMSequenceCPUTest::getTestCaseName);
 
+// the hidden and the cell states pass through 300 time steps
+const std::vector<InputShape> longSequenceShapes = {
+    { {}, { {4, 300, 64} } },
+    { {}, { {4, 1, 128} } },
+    { {}, { {4, 1, 128} } },
+    { {}, { {4} } },
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_static_bf16_LongSequence, LSTMSequenceCPUTest,
+                ::testing::Combine(::testing::Values(longSequenceShapes),
+                                   ::testing::ValuesIn(mode),
+                                   ::testing::ValuesIn(activations),
+                                   ::testing::ValuesIn(clip),
+                                   ::testing::ValuesIn(direction),
+                                   ::testing::ValuesIn(netPrecisions),
+                                   ::testing::Values(cpuParams),
+                                   ::testing::Values(std::map<std::string, std::string>{
+                                       {InferenceEngine::PluginConfigParams::KEY_ENFORCE_BF16, InferenceEngine::PluginConfigParams::YES},
+                                       {"_long_sequence_test", "yes"}})),
+                LSTMSequenceCPUTest::getTestCaseName);
+
 const std::vector<std::vector<InputShape>> dynamicShapes = {
     { { {-1, {1, 5}, 10},                           // #0. Dynamic shape 0
         { {10, 2, 10}, {8, 3, 10}, {5, 4, 10} } },  // Target shapes
@@ -446,5 +474,35 @@ INSTANTIATE_TEST_SUITE_P(nightly_dynamic_bf16_BatchSizeOne, LSTMSequenceCPUTest,
                                ::testing::Values(cpuParamsBatchSizeOne),
                                ::testing::Values(additionalConfig[1])),
             LSTMSequenceCPUTest::getTestCaseName);
+
+/* ============= Benchmark ============= */
+// speech-like sequences, compare the f32 and the bf16 (ENFORCE_BF16) runs of the same instance
+const std::vector<std::vector<InputShape>> shapesBenchmark = {
+    { { {}, { {1, 500, 80} } },
+      { {}, { {1, 1, 512} } },
+      { {}, { {1, 1, 512} } },
+      { {}, { {1} } } },
+    { { {}, { {16, 100, 256} } },
+      { {}, { {16, 1, 256} } },
+      { {}, { {16, 1, 256} } },
+      { {}, { {16} } } },
+};
+
+struct LSTMSequenceBenchmarkCPUTest : ov::test::BenchmarkLayerTest<LSTMSequenceCPUTest> {};
+
+TEST_P(LSTMSequenceBenchmarkCPUTest, DISABLED_RNNSeq_Benchmark) {
+    run_benchmark("RNNSeq", std::chrono::milliseconds(1000), 100);
+}
+
+INSTANTIATE_TEST_SUITE_P(Benchmark_LSTMSequence, LSTMSequenceBenchmarkCPUTest,
+            ::testing::Combine(::testing::ValuesIn(shapesBenchmark),
+                               ::testing::ValuesIn(mode),
+                               ::testing::ValuesIn(activations),
+                               ::testing::ValuesIn(clip),
+                               ::testing::ValuesIn(direction),
+                               ::testing::ValuesIn(netPrecisions),
+                               ::testing::Values(cpuParams),
+                               ::testing::ValuesIn(additionalConfig)),
+            LSTMSequenceCPUTest::getTestCaseName);
 } // namespace
 } // namespace CPULayerTestsDefinitions
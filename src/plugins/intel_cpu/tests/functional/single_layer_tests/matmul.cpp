@@ -7,6 +7,8 @@
 #include "ie_precision.hpp"
 #include "test_utils/fusing_test_utils.hpp"
 #include "ngraph_functions/builders.hpp"
+#include "shared_test_classes/base/benchmark.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
 #include <string>
 
 using namespace ngraph;
@@ -859,6 +861,41 @@ const auto testParams2D_Brgemm_Amx_nightly = ::testing::Combine(fullyConnectedPa
 
 INSTANTIATE_TEST_SUITE_P(nightly_FC_2D_Brgemm_Amx, MatMulLayerCPUTest, testParams2D_Brgemm_Amx_nightly, MatMulLayerCPUTest::getTestCaseName);
 
+/* ============= Benchmark ============= */
+// FullyConnected with large weights is bound by memory bandwidth and TLB misses, so the memory placement
+// properties are benchmarked on it. NUMA placement makes a difference on multi-socket hosts only.
+const std::vector<ShapeRelatedParams> IS2D_Benchmark = {
+    {static_shapes_to_test_representation({{1, 4096}, {4096, 4096}}), {false, true}},
+    {static_shapes_to_test_representation({{32, 4096}, {4096, 11008}}), {false, true}},
+};
+
+const std::vector<std::map<std::string, std::string>> memoryPlacementConfig_Benchmark {
+    {},
+    {{ov::intel_cpu::huge_pages.name(), PluginConfigParams::YES}},
+    {{ov::intel_cpu::numa_memory_placement.name(), PluginConfigParams::YES}},
+    {{ov::intel_cpu::huge_pages.name(), PluginConfigParams::YES},
+     {ov::intel_cpu::numa_memory_placement.name(), PluginConfigParams::YES}},
+};
+
+struct MatMulBenchmarkCPUTest : ov::test::BenchmarkLayerTest<MatMulLayerCPUTest> {};
+
+TEST_P(MatMulBenchmarkCPUTest, DISABLED_FullyConnected_Benchmark) {
+    run_benchmark("FullyConnected", std::chrono::milliseconds(1000), 100);
+}
+
+const auto testParams2D_Benchmark = ::testing::Combine(::testing::Combine(::testing::ValuesIn(IS2D_Benchmark),
+                                                                    ::testing::Values(ElementType::f32),
+                                                                    ::testing::Values(ElementType::undefined),
+                                                                    ::testing::Values(ElementType::undefined),
+                                                                    ::testing::Values(helpers::InputLayerType::CONSTANT),
+                                                                    ::testing::Values(ov::test::utils::DEVICE_CPU),
+                                                                    ::testing::ValuesIn(memoryPlacementConfig_Benchmark)),
+                                                 ::testing::Values(MatMulNodeType::FullyConnected),
+                                                 ::testing::Values(emptyFusingSpec),
+                                                 ::testing::Values(emptyCPUSpec));
+
+INSTANTIATE_TEST_SUITE_P(Benchmark_FC_2D, MatMulBenchmarkCPUTest, testParams2D_Benchmark, MatMulLayerCPUTest::getTestCaseName);
+
 } // namespace fullyConnected
 
 
@@ -0,0 +1,201 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <common_test_utils/ov_tensor_utils.hpp>
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include <openvino/op/sampling.hpp>
+
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+using namespace ov::test;
+
+namespace CPULayerTestsDefinitions {
+
+struct SamplingAttributes {
+    float temperature;
+    int64_t topK;
+    float topP;
+};
+
+using SamplingLayerTestParams = std::tuple<
+        ElementType,            // logits precision
+        ElementType,            // output type
+        InputShape,             // logits shape
+        SamplingAttributes,
+        std::pair<uint64_t, uint64_t>>;  // global seed, op seed
+
+class SamplingLayerCPUTest : public testing::WithParamInterface<SamplingLayerTestParams>,
+                             virtual public SubgraphBaseTest, public CPUTestsBase {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<SamplingLayerTestParams> obj) {
+        ElementType logitsPrecision, outType;
+        InputShape shapes;
+        SamplingAttributes attrs;
+        std::pair<uint64_t, uint64_t> seeds;
+        std::tie(logitsPrecision, outType, shapes, attrs, seeds) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << ov::test::utils::partialShape2str({shapes.first}) << "_";
+        result << "TS=";
+        for (const auto& item : shapes.second) {
+            result << ov::test::utils::vec2str(item) << "_";
+        }
+        result << "logitsPrc=" << logitsPrecision << "_outType=" << outType << "_";
+        result << "temperature=" << attrs.temperature << "_topK=" << attrs.topK << "_topP=" << attrs.topP << "_";
+        result << "seeds=" << seeds.first << "_" << seeds.second;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        ElementType logitsPrecision;
+        InputShape shapes;
+        SamplingAttributes attrs;
+        std::pair<uint64_t, uint64_t> seeds;
+        std::tie(logitsPrecision, outType, shapes, attrs, seeds) = this->GetParam();
+
+        // platforms without bf16 support convert bf16 logits to f32, the values are the same
+        const bool bf16Logits = logitsPrecision == ElementType::bf16 && with_cpu_x86_avx512_core();
+        selectedType = makeSelectedTypeStr("ref_any", bf16Logits ? ElementType::bf16 : ElementType::f32);
+        // the logits of f32 models must not be rounded to bf16, the drawn tokens are compared exactly
+        configuration.insert({ov::hint::inference_precision.name(), ov::element::f32});
+
+        init_input_shapes({shapes});
+        auto params = ngraph::builder::makeDynamicParams(logitsPrecision, inputDynamicShapes);
+        auto sampling = std::make_shared<ov::op::v13::Sampling>(params[0],
+                                                                attrs.temperature,
+                                                                attrs.topK,
+                                                                attrs.topP,
+                                                                outType,
+                                                                seeds.first,
+                                                                seeds.second);
+        function = std::make_shared<ov::Model>(sampling->outputs(), params, "Sampling");
+    }
+
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        inputs.clear();
+        const auto& funcInput = function->inputs()[0];
+        // the step of 0.01 produces equal logits as well, both the plugin and the reference order them by the index
+        auto tensor = ov::test::utils::create_and_fill_tensor(funcInput.get_element_type(),
+                                                              targetInputStaticShapes[0], 40, -20, 100);
+        inputs.insert({funcInput.get_node_shared_ptr(), tensor});
+    }
+
+    static std::vector<int64_t> tokens(const ov::Tensor& tensor) {
+        std::vector<int64_t> result(tensor.get_size());
+        for (size_t i = 0; i < result.size(); i++) {
+            result[i] = tensor.get_element_type() == ov::element::i32 ? tensor.data<const int32_t>()[i]
+                                                                      : tensor.data<const int64_t>()[i];
+        }
+        return result;
+    }
+
+    // the token ids are produced as i32 and converted to i64 by the output of the graph
+    void checkOutputPrecision() const {
+        const auto execModel = compiledModel.get_runtime_model();
+        ASSERT_NE(nullptr, execModel);
+        for (const auto& node : execModel->get_ops()) {
+            const auto& rtInfo = node->get_rt_info();
+            if (rtInfo.at(ExecGraphInfoSerialization::LAYER_TYPE).as<std::string>() == "Sampling") {
+                ASSERT_EQ(rtInfo.at(ExecGraphInfoSerialization::OUTPUT_PRECISIONS).as<std::string>(), "I32");
+            }
+        }
+    }
+
+    ElementType outType;
+};
+
+TEST_P(SamplingLayerCPUTest, CompareWithRefs) {
+    compile_model();
+    CheckPluginRelatedResults(compiledModel, "Sampling");
+    checkOutputPrecision();
+
+    // the reference model keeps the state of the random generator between the evaluations the same way
+    // the CPU node does between the inferences, so each inference draws the next uniform number of the stream
+    const auto refModel = function->clone();
+    const auto refSampling =
+        ov::as_type_ptr<ov::op::v13::Sampling>(refModel->get_results()[0]->get_input_node_shared_ptr(0));
+    ASSERT_NE(nullptr, refSampling);
+
+    inferRequest = compiledModel.create_infer_request();
+    for (const auto& targetStaticShapeVec : targetStaticShapes) {
+        generate_inputs(targetStaticShapeVec);
+        const auto& logits = inputs.begin()->second;
+        inferRequest.set_tensor(inputs.begin()->first, logits);
+
+        for (size_t iteration = 0; iteration < 3; iteration++) {
+            inferRequest.infer();
+            const auto actual = inferRequest.get_output_tensor(0);
+            ASSERT_EQ(actual.get_element_type(), outType);
+            ASSERT_EQ(actual.get_shape(), (ov::Shape{logits.get_shape()[0], 1}));
+
+            const auto stateBefore = refSampling->get_state();
+            ov::TensorVector expected{ov::Tensor(outType, actual.get_shape())};
+            ASSERT_TRUE(refModel->evaluate(expected, ov::TensorVector{logits}));
+            ASSERT_NE(stateBefore, refSampling->get_state());
+
+            ASSERT_EQ(tokens(expected[0]), tokens(actual))
+                << "shape " << logits.get_shape() << ", inference " << iteration;
+        }
+    }
+}
+
+namespace {
+
+const std::vector<SamplingAttributes> attributes = {
+    {1.0f, 0, 1.0f},    // multinomial over the whole vocabulary
+    {0.7f, 40, 1.0f},   // top-k
+    {1.3f, 0, 0.9f},    // top-p
+    {0.8f, 50, 0.95f},  // top-k and top-p
+    {1.0f, 1, 1.0f},    // greedy
+};
+
+const std::vector<std::pair<uint64_t, uint64_t>> seeds = {
+    {0, 42},
+    {150, 10},
+};
+
+const std::vector<InputShape> staticShapes = {
+    {{}, {{1, 1000}}},
+    {{}, {{4, 32000}}},
+};
+
+const std::vector<InputShape> dynamicShapes = {
+    // dynamic batch
+    {{-1, 1000}, {{1, 1000}, {8, 1000}, {3, 1000}, {8, 1000}}},
+    {{-1, -1}, {{2, 50}, {5, 32000}, {1, 7}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_Sampling_static, SamplingLayerCPUTest,
+        ::testing::Combine(
+                ::testing::Values(ElementType::f32),
+                ::testing::Values(ElementType::i32, ElementType::i64),
+                ::testing::ValuesIn(staticShapes),
+                ::testing::ValuesIn(attributes),
+                ::testing::ValuesIn(seeds)),
+        SamplingLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_Sampling_dynamic, SamplingLayerCPUTest,
+        ::testing::Combine(
+                ::testing::Values(ElementType::f32),
+                ::testing::Values(ElementType::i64),
+                ::testing::ValuesIn(dynamicShapes),
+                ::testing::ValuesIn(attributes),
+                ::testing::Values(seeds[0])),
+        SamplingLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_Sampling_bf16, SamplingLayerCPUTest,
+        ::testing::Combine(
+                ::testing::Values(ElementType::bf16),
+                ::testing::Values(ElementType::i32, ElementType::i64),
+                ::testing::Values(staticShapes[1], dynamicShapes[0]),
+                ::testing::ValuesIn(attributes),
+                ::testing::Values(seeds[1])),
+        SamplingLayerCPUTest::getTestCaseName);
+
+}  // namespace
+}  // namespace CPULayerTestsDefinitions
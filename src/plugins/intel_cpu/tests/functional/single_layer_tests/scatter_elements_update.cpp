@@ -6,6 +6,7 @@
 #include <common_test_utils/ov_tensor_utils.hpp>
 #include "shared_test_classes/base/ov_subgraph.hpp"
 #include "ngraph_functions/builders.hpp"
+#include "shared_test_classes/base/benchmark.hpp"
 
 using namespace ngraph;
 using namespace InferenceEngine;
@@ -27,6 +28,61 @@ using scatterUpdateParams = std::tuple<
     ElementType,        // input precision
     ElementType>;       // indices precision
 
+using Reduction = ov::op::v12::ScatterElementsUpdate::Reduction;
+
+using scatterUpdate12Params = std::tuple<
+    ScatterElementsUpdateLayerParams,
+    std::int64_t,       // axis
+    Reduction,          // reduction
+    bool,               // use_init_val
+    ElementType,        // input precision
+    ElementType>;       // indices precision
+
+// Fills indices with the given values or with random values along the axis if no values are given
+static void generateScatterElementsInputs(const std::shared_ptr<ov::Model>& function,
+                                          const std::vector<ov::Shape>& targetInputStaticShapes,
+                                          const IndicesValues& indicesVals,
+                                          const std::int64_t axis,
+                                          std::map<std::shared_ptr<ov::Node>, ov::Tensor>& inputs) {
+    inputs.clear();
+    const auto& funcInputs = function->inputs();
+    for (size_t i = 0; i < funcInputs.size(); ++i) {
+        const auto& funcInput = funcInputs[i];
+        const auto& inputPrecision = funcInput.get_element_type();
+        const auto& targetShape = targetInputStaticShapes[i];
+        ov::Tensor tensor;
+        if (i == 1) {
+            if (indicesVals.empty()) {
+                const auto& dataShape = targetInputStaticShapes[0];
+                const auto axisDim = dataShape[axis < 0 ? axis + dataShape.size() : axis];
+                tensor = ov::test::utils::create_and_fill_tensor(inputPrecision, targetShape, axisDim, 0);
+            } else {
+                tensor = ov::Tensor{ inputPrecision, targetShape };
+                if (inputPrecision == ElementType::i32) {
+                    auto data = tensor.data<std::int32_t>();
+                    for (size_t i = 0; i < tensor.get_size(); ++i) {
+                        data[i] = static_cast<std::int32_t>(indicesVals[i]);
+                    }
+                } else if (inputPrecision == ElementType::i64) {
+                    auto data = tensor.data<std::int64_t>();
+                    for (size_t i = 0; i < tensor.get_size(); ++i) {
+                        data[i] = indicesVals[i];
+                    }
+                } else {
+                    IE_THROW() << "GatherElementsUpdate. Unsupported indices precision: " << inputPrecision;
+                }
+            }
+        } else {
+            if (inputPrecision.is_real()) {
+                tensor = ov::test::utils::create_and_fill_tensor(inputPrecision, targetShape, 10, 0, 1000);
+            } else {
+                tensor = ov::test::utils::create_and_fill_tensor(inputPrecision, targetShape);
+            }
+        }
+        inputs.insert({ funcInput.get_node_shared_ptr(), tensor });
+    }
+}
+
 class ScatterElementsUpdateLayerCPUTest : public testing::WithParamInterface<scatterUpdateParams>, public SubgraphBaseTest, public CPUTestsBase {
 public:
     static std::string getTestCaseName(testing::TestParamInfo<scatterUpdateParams> obj) {
@@ -58,38 +114,8 @@ public:
 
 protected:
     void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
-        inputs.clear();
-        const auto& funcInputs = function->inputs();
-        for (size_t i = 0; i < funcInputs.size(); ++i) {
-            const auto& funcInput = funcInputs[i];
-            const auto& inputPrecision = funcInput.get_element_type();
-            const auto& targetShape = targetInputStaticShapes[i];
-            ov::Tensor tensor;
-            if (i == 1) {
-                tensor = ov::Tensor{ inputPrecision, targetShape };
-                const auto indicesVals = std::get<0>(this->GetParam()).indicesValues;
-                if (inputPrecision == ElementType::i32) {
-                    auto data = tensor.data<std::int32_t>();
-                    for (size_t i = 0; i < tensor.get_size(); ++i) {
-                        data[i] = static_cast<std::int32_t>(indicesVals[i]);
-                    }
-                } else if (inputPrecision == ElementType::i64) {
-                    auto data = tensor.data<std::int64_t>();
-                    for (size_t i = 0; i < tensor.get_size(); ++i) {
-                        data[i] = indicesVals[i];
-                    }
-                } else {
-                    IE_THROW() << "GatherElementsUpdate. Unsupported indices precision: " << inputPrecision;
-                }
-            } else {
-                if (inputPrecision.is_real()) {
-                    tensor = ov::test::utils::create_and_fill_tensor(inputPrecision, targetShape, 10, 0, 1000);
-                } else {
-                    tensor = ov::test::utils::create_and_fill_tensor(inputPrecision, targetShape);
-                }
-            }
-            inputs.insert({ funcInput.get_node_shared_ptr(), tensor });
-        }
+        generateScatterElementsInputs(function, targetInputStaticShapes, std::get<0>(this->GetParam()).indicesValues,
+                                      std::get<1>(this->GetParam()), inputs);
     }
 
     void SetUp() override {
@@ -124,6 +150,63 @@ TEST_P(ScatterElementsUpdateLayerCPUTest, CompareWithRefs) {
     CheckPluginRelatedResults(compiledModel, "ScatterUpdate");
 }
 
+class ScatterElementsUpdate12LayerCPUTest : public testing::WithParamInterface<scatterUpdate12Params>,
+                                            public SubgraphBaseTest, public CPUTestsBase {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<scatterUpdate12Params> obj) {
+        ScatterElementsUpdateLayerParams scatterParams;
+        std::int64_t axis;
+        Reduction reduction;
+        bool useInitVal;
+        ElementType inputPrecision;
+        ElementType idxPrecision;
+        std::tie(scatterParams, axis, reduction, useInitVal, inputPrecision, idxPrecision) = obj.param;
+
+        std::ostringstream result;
+        result << ScatterElementsUpdateLayerCPUTest::getTestCaseName(testing::TestParamInfo<scatterUpdateParams>(
+                      scatterUpdateParams{scatterParams, axis, inputPrecision, idxPrecision}, obj.index));
+        result << "_reduction=" << reduction << "_use_init_val=" << std::boolalpha << useInitVal;
+        return result.str();
+    }
+
+protected:
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        generateScatterElementsInputs(function, targetInputStaticShapes, std::get<0>(this->GetParam()).indicesValues,
+                                      std::get<1>(this->GetParam()), inputs);
+    }
+
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        ScatterElementsUpdateLayerParams scatterParams;
+        std::int64_t axis;
+        Reduction reduction;
+        bool useInitVal;
+        ElementType inputPrecision;
+        ElementType idxPrecision;
+        std::tie(scatterParams, axis, reduction, useInitVal, inputPrecision, idxPrecision) = this->GetParam();
+
+        init_input_shapes(scatterParams.inputShapes);
+        selectedType = makeSelectedTypeStr("unknown", inputPrecision);
+
+        auto dataParams = ngraph::builder::makeDynamicParams(inputPrecision, { inputDynamicShapes[0], inputDynamicShapes[2] });
+        auto indicesParam = ngraph::builder::makeDynamicParams(idxPrecision, { inputDynamicShapes[1] });
+
+        auto axisNode = ngraph::opset3::Constant::create(idxPrecision, {}, { axis });
+        auto scatter = std::make_shared<ov::op::v12::ScatterElementsUpdate>(dataParams[0], indicesParam[0], dataParams[1], axisNode,
+                                                                            reduction, useInitVal);
+
+        ngraph::ParameterVector allParams{ dataParams[0], indicesParam[0], dataParams[1] };
+        function = makeNgraphFunction(inputPrecision, allParams, scatter, "ScatterElementsUpdate12LayerCPUTest");
+    }
+};
+
+TEST_P(ScatterElementsUpdate12LayerCPUTest, CompareWithRefs) {
+    run();
+    CheckPluginRelatedResults(compiledModel, "ScatterElementsUpdate");
+    // the reductions are executed natively rather than by the reference fallback
+    CheckNumberOfNodesWithType(compiledModel, "ScatterElementsUpdate", 1);
+}
+
 const std::vector<std::int64_t> axes = { -3, -2, -1, 0, 1, 2 };
 
 const std::vector<ScatterElementsUpdateLayerParams> scatterParams = {
@@ -171,4 +254,81 @@ INSTANTIATE_TEST_SUITE_P(smoke_CompareWithRefs, ScatterElementsUpdateLayerCPUTes
         ::testing::ValuesIn(inputPrecisions),
         ::testing::ValuesIn(constantPrecisions)),
     ScatterElementsUpdateLayerCPUTest::getTestCaseName);
+
+// several updates point to the same output element
+const std::vector<ScatterElementsUpdateLayerParams> scatterReductionParams = {
+    ScatterElementsUpdateLayerParams{
+        ScatterElementsUpdateShapes{{{-1, -1, -1}, {{10, 12, 15}, {8, 9, 10}, {11, 8, 12}}},
+                                    {{-1, -1, -1}, {{2, 2, 4}, {4, 2, 2}, {2, 4, 2}}},
+                                    {{-1, -1, -1}, {{2, 2, 4}, {4, 2, 2}, {2, 4, 2}}}},
+        IndicesValues{1, 0, 1, 1, 0, 1, 0, 0, 3, 3, 2, 1, 1, 0, 3, 3},
+    },
+    ScatterElementsUpdateLayerParams{
+        ScatterElementsUpdateShapes{{{}, {{8, 9, 10}}},
+                                    {{}, {{4, 3, 2}}},
+                                    {{}, {{4, 3, 2}}}},
+        IndicesValues{-1, 0, -1, -1, -2, -1, 0, -2, 2, 2, -1, 1, 1, 0, -3, -3, 0, 0, -1, -1, 1, 1, 2, 2},
+    },
+};
+
+const std::vector<Reduction> reductions = {
+    Reduction::SUM,
+    Reduction::PROD,
+    Reduction::MIN,
+    Reduction::MAX,
+    Reduction::MEAN,
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_Reduction_CompareWithRefs, ScatterElementsUpdate12LayerCPUTest,
+    ::testing::Combine(
+        ::testing::ValuesIn(scatterReductionParams),
+        ::testing::ValuesIn(axes),
+        ::testing::ValuesIn(reductions),
+        ::testing::Bool(),
+        ::testing::ValuesIn(inputPrecisions),
+        ::testing::Values(ElementType::i32)),
+    ScatterElementsUpdate12LayerCPUTest::getTestCaseName);
+
+/* ============= Benchmark ============= */
+// segment reduction of the rows of a message tensor into the nodes of a graph
+const std::vector<ScatterElementsUpdateLayerParams> scatterParams_Benchmark = {
+    ScatterElementsUpdateLayerParams{
+        ScatterElementsUpdateShapes{{{}, {{10000, 64}}},
+                                    {{}, {{100000, 64}}},
+                                    {{}, {{100000, 64}}}},
+        IndicesValues{},
+    },
+    ScatterElementsUpdateLayerParams{
+        ScatterElementsUpdateShapes{{{}, {{64, 32000}}},
+                                    {{}, {{64, 4096}}},
+                                    {{}, {{64, 4096}}}},
+        IndicesValues{},
+    },
+};
+
+struct ScatterElementsUpdate12BenchmarkCPUTest : ov::test::BenchmarkLayerTest<ScatterElementsUpdate12LayerCPUTest> {};
+
+TEST_P(ScatterElementsUpdate12BenchmarkCPUTest, DISABLED_ScatterElementsUpdate_Benchmark) {
+    run_benchmark("ScatterElementsUpdate", std::chrono::milliseconds(1000), 100);
+}
+
+INSTANTIATE_TEST_SUITE_P(Benchmark_ScatterElementsUpdate12, ScatterElementsUpdate12BenchmarkCPUTest,
+    ::testing::Combine(
+        ::testing::Values(scatterParams_Benchmark[0]),
+        ::testing::Values(0),
+        ::testing::Values(Reduction::SUM, Reduction::MAX, Reduction::MEAN),
+        ::testing::Values(true),
+        ::testing::ValuesIn(inputPrecisions),
+        ::testing::Values(ElementType::i32)),
+    ScatterElementsUpdate12LayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(Benchmark_ScatterElementsUpdate12_lastAxis, ScatterElementsUpdate12BenchmarkCPUTest,
+    ::testing::Combine(
+        ::testing::Values(scatterParams_Benchmark[1]),
+        ::testing::Values(-1),
+        ::testing::Values(Reduction::SUM, Reduction::MAX, Reduction::MEAN),
+        ::testing::Values(true),
+        ::testing::ValuesIn(inputPrecisions),
+        ::testing::Values(ElementType::i32)),
+    ScatterElementsUpdate12LayerCPUTest::getTestCaseName);
 } // namespace CPULayerTestsDefinitions
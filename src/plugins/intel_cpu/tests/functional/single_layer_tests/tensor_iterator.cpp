@@ -151,5 +151,25 @@ INSTANTIATE_TEST_SUITE_P(smoke_TensorIteratorSimple, TensorIteratorCPUTest,
                                  ::testing::ValuesIn(inputPrecisions)),
                          TensorIteratorCPUTest::getTestCaseName);
 
+// chunks with unit outer dimensions are bound to the body in place, others are still copied,
+// the binding itself is checked by TensorIteratorZeroCopyTest of the unit tests
+std::vector<std::vector<InputShape>> staticInputs = {
+    {
+        {{1, 12, 10}, {{1, 12, 10}}},
+        {{1, 12, 10}, {{1, 12, 10}}}
+    },
+    {
+        {{10, 12, 10}, {{10, 12, 10}}},
+        {{10, 12, 10}, {{10, 12, 10}}}
+    },
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_TensorIteratorStatic, TensorIteratorCPUTest,
+                         ::testing::Combine(
+                                 ::testing::ValuesIn(staticInputs),
+                                 ::testing::ValuesIn(direction),
+                                 ::testing::ValuesIn(inputPrecisions)),
+                         TensorIteratorCPUTest::getTestCaseName);
+
 }  // namespace
 } // namespace CPULayerTestsDefinitions
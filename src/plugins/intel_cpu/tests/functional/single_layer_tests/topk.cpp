@@ -6,6 +6,7 @@
 #include "test_utils/cpu_test_utils.hpp"
 #include "shared_test_classes/base/ov_subgraph.hpp"
 #include "ngraph_functions/builders.hpp"
+#include "shared_test_classes/base/benchmark.hpp"
 
 using namespace InferenceEngine;
 using namespace CPUTestUtils;
@@ -427,6 +428,156 @@ INSTANTIATE_TEST_CASE_P(smoke_Top1_dynamic, TopKLayerCPUTest,
         ::testing::ValuesIn(additionalConfig)),
     TopKLayerCPUTest::getTestCaseName);
 
+const std::vector<int64_t> k_radix_select = {1, 10, 1000};
+
+std::vector<ov::test::InputShape> inputShapes_radix_select = {
+    {{}, {{2, 5000}}},
+};
+
+std::vector<ov::test::InputShape> inputShapesDynamic_radix_select = {
+    {{-1, -1}, {{2, 5000}, {1, 4096}, {3, 100}, {1, 8192}}}
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_TopK_radix_select, TopKLayerCPUTest,
+    ::testing::Combine(
+        ::testing::Combine(
+            ::testing::ValuesIn(k_radix_select),
+            ::testing::Values(1),
+            ::testing::ValuesIn(modes),
+            ::testing::ValuesIn(sortTypeStable),
+            ::testing::Values(ElementType::f32, ElementType::i32),
+            ::testing::Values(ElementType::undefined),
+            ::testing::Values(ElementType::undefined),
+            ::testing::ValuesIn(inputShapes_radix_select)),
+        ::testing::Values(emptyCPUSpec),
+        ::testing::Values(additionalConfig[0])),
+    TopKLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_CASE_P(smoke_TopK_radix_select_dynamic, TopKLayerCPUTest,
+    ::testing::Combine(
+        ::testing::Combine(
+            ::testing::Values(1),
+            ::testing::Values(1),
+            ::testing::ValuesIn(modes),
+            ::testing::ValuesIn(sortTypeStable),
+            ::testing::Values(ElementType::f32),
+            ::testing::Values(ElementType::undefined),
+            ::testing::Values(ElementType::undefined),
+            ::testing::ValuesIn(inputShapesDynamic_radix_select)),
+        ::testing::Values(emptyCPUSpec),
+        ::testing::Values(additionalConfig[0])),
+    TopKLayerCPUTest::getTestCaseName);
+
+std::vector<ov::test::InputShape> inputShapes_radix_select_nhwc = {
+    {{}, {{1, 4100, 2, 3}}},
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_TopK_radix_select_nhwc, TopKLayerCPUTest,
+    ::testing::Combine(
+        ::testing::Combine(
+            ::testing::Values(10),
+            ::testing::Values(1),
+            ::testing::ValuesIn(modes),
+            ::testing::ValuesIn(sortTypeStable),
+            ::testing::Values(ElementType::f32),
+            ::testing::Values(ElementType::undefined),
+            ::testing::Values(ElementType::undefined),
+            ::testing::ValuesIn(inputShapes_radix_select_nhwc)),
+        ::testing::Values(CPUSpecificParams({nhwc, x}, {nhwc, nhwc}, {}, {})),
+        ::testing::Values(additionalConfig[0])),
+    TopKLayerCPUTest::getTestCaseName);
+
+/* ============= Benchmark ============= */
+const std::vector<int64_t> k_Benchmark = {1, 10, 50};
+
+std::vector<ov::test::InputShape> inputShapes_Benchmark = {
+    {{}, {{1, 32000}}},
+    {{}, {{8, 50272}}},
+    {{}, {{64, 1024}}},
+};
+
+struct TopKBenchmarkCPUTest : ov::test::BenchmarkLayerTest<TopKLayerCPUTest> {};
+
+TEST_P(TopKBenchmarkCPUTest, DISABLED_TopK_Benchmark) {
+    run_benchmark("TopK", std::chrono::milliseconds(1000), 1000);
+}
+
+INSTANTIATE_TEST_CASE_P(Benchmark_TopK, TopKBenchmarkCPUTest,
+    ::testing::Combine(
+        ::testing::Combine(
+            ::testing::ValuesIn(k_Benchmark),
+            ::testing::Values(1),
+            ::testing::Values(SortMode::MAX),
+            ::testing::Values(std::tuple<SortType, bool>(SortType::SORT_VALUES, false)),
+            ::testing::Values(ElementType::f32),
+            ::testing::Values(ElementType::undefined),
+            ::testing::Values(ElementType::undefined),
+            ::testing::ValuesIn(inputShapes_Benchmark)),
+        ::testing::Values(emptyCPUSpec),
+        ::testing::ValuesIn(additionalConfig)),
+    TopKLayerCPUTest::getTestCaseName);
+
+// vocabulary sized rows of the sampling and thousands of the best scores of the retrieval
+const std::vector<int64_t> k_Benchmark_LargeAxis = {1, 50, 100};
+const std::vector<int64_t> k_Benchmark_LargeK = {1000, 4000};
+
+std::vector<ov::test::InputShape> inputShapes_Benchmark_LargeAxis = {
+    {{}, {{1, 50272}}},
+    {{}, {{1, 128256}}},
+    {{}, {{1, 250002}}},
+    {{}, {{16, 128256}}},
+};
+
+std::vector<ov::test::InputShape> inputShapes_Benchmark_LargeK = {
+    {{}, {{1, 100000}}},
+    {{}, {{32, 100000}}},
+};
+
+INSTANTIATE_TEST_CASE_P(Benchmark_TopK_large_axis, TopKBenchmarkCPUTest,
+    ::testing::Combine(
+        ::testing::Combine(
+            ::testing::ValuesIn(k_Benchmark_LargeAxis),
+            ::testing::Values(1),
+            ::testing::Values(SortMode::MAX),
+            ::testing::Values(std::tuple<SortType, bool>(SortType::SORT_VALUES, false)),
+            ::testing::Values(ElementType::f32),
+            ::testing::Values(ElementType::undefined),
+            ::testing::Values(ElementType::undefined),
+            ::testing::ValuesIn(inputShapes_Benchmark_LargeAxis)),
+        ::testing::Values(emptyCPUSpec),
+        ::testing::Values(additionalConfig[0])),
+    TopKLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_CASE_P(Benchmark_TopK_large_k, TopKBenchmarkCPUTest,
+    ::testing::Combine(
+        ::testing::Combine(
+            ::testing::ValuesIn(k_Benchmark_LargeK),
+            ::testing::Values(1),
+            ::testing::Values(SortMode::MAX),
+            ::testing::Values(std::tuple<SortType, bool>(SortType::SORT_VALUES, false)),
+            ::testing::Values(ElementType::f32),
+            ::testing::Values(ElementType::undefined),
+            ::testing::Values(ElementType::undefined),
+            ::testing::ValuesIn(inputShapes_Benchmark_LargeK)),
+        ::testing::Values(emptyCPUSpec),
+        ::testing::Values(additionalConfig[0])),
+    TopKLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_CASE_P(Benchmark_TopK_int32, TopKBenchmarkCPUTest,
+    ::testing::Combine(
+        ::testing::Combine(
+            ::testing::ValuesIn(k_Benchmark),
+            ::testing::Values(1),
+            ::testing::Values(SortMode::MAX),
+            ::testing::Values(std::tuple<SortType, bool>(SortType::SORT_VALUES, false)),
+            ::testing::Values(ElementType::i32),
+            ::testing::Values(ElementType::undefined),
+            ::testing::Values(ElementType::undefined),
+            ::testing::ValuesIn(inputShapes_Benchmark)),
+        ::testing::Values(emptyCPUSpec),
+        ::testing::Values(additionalConfig[0])),
+    TopKLayerCPUTest::getTestCaseName);
+
 } // namespace
 
 } // namespace CPULayerTestsDefinitions
@@ -0,0 +1,89 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/openvino.hpp"
+#include "openvino/opsets/opset8.hpp"
+#include "openvino/op/util/variable.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+/* The state is reordered by the beam indices: Gather(ReadValue, beam_idx) -> Assign is fused into the memory nodes
+ * and the rows of the state are permuted without a copy of the data.
+
+    Param(beam_idx)   ReadValue    Param(x)
+            \        /     \        /
+             Gather          Add
+               |              |
+             Assign         Result
+*/
+class BeamStateReorderTest : public ::testing::Test, public CPUTestsBase {
+protected:
+    static constexpr size_t beams = 4;
+    static constexpr size_t rowLength = 3;
+
+    std::shared_ptr<ov::Model> createModel() {
+        const ov::Shape stateShape{beams, rowLength};
+        auto beamIdx = std::make_shared<ov::opset8::Parameter>(ov::element::i32, ov::Shape{beams});
+        auto x = std::make_shared<ov::opset8::Parameter>(ov::element::f32, stateShape);
+        auto variable = std::make_shared<ov::op::util::Variable>(
+            ov::op::util::VariableInfo{stateShape, ov::element::f32, "beam_state"});
+        auto init = ov::opset8::Constant::create(ov::element::f32, stateShape, {0.f});
+        auto readValue = std::make_shared<ov::opset8::ReadValue>(init, variable);
+        auto axis = ov::opset8::Constant::create(ov::element::i32, ov::Shape{}, {0});
+        auto gather = std::make_shared<ov::opset8::Gather>(readValue, beamIdx, axis);
+        auto assign = std::make_shared<ov::opset8::Assign>(gather, variable);
+        auto add = std::make_shared<ov::opset8::Add>(readValue, x);
+        auto result = std::make_shared<ov::opset8::Result>(add);
+        return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::SinkVector{assign},
+                                           ov::ParameterVector{beamIdx, x}, "BeamStateReorder");
+    }
+};
+
+TEST_F(BeamStateReorderTest, smoke_CompareWithRef) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    ov::Core core;
+    auto compiledModel = core.compile_model(createModel(), ov::test::utils::DEVICE_CPU);
+    CheckNumberOfNodesWithType(compiledModel, "Gather", 0);
+
+    auto inferRequest = compiledModel.create_infer_request();
+    std::vector<float> expected(beams * rowLength);
+    for (size_t i = 0; i < expected.size(); i++)
+        expected[i] = static_cast<float>(i + 1);
+    auto states = inferRequest.query_state();
+    ASSERT_EQ(states.size(), 1);
+    states.front().set_state(ov::Tensor(ov::element::f32, ov::Shape{beams, rowLength}, expected.data()));
+
+    ov::Tensor x(ov::element::f32, ov::Shape{beams, rowLength});
+    std::fill_n(x.data<float>(), x.get_size(), 0.5f);
+    inferRequest.set_tensor(compiledModel.input(1), x);
+
+    const std::vector<std::vector<int32_t>> steps{{0, 0, 1, 2}, {3, 1, 1, 0}, {2, -1, 0, 0}};
+    for (const auto& step : steps) {
+        ov::Tensor beamIdx(ov::element::i32, ov::Shape{beams}, const_cast<int32_t*>(step.data()));
+        inferRequest.set_tensor(compiledModel.input(0), beamIdx);
+        inferRequest.infer();
+
+        // the output is computed from the state before the reorder
+        auto output = inferRequest.get_tensor(compiledModel.output(0));
+        for (size_t i = 0; i < expected.size(); i++)
+            ASSERT_FLOAT_EQ(output.data<float>()[i], expected[i] + 0.5f);
+
+        std::vector<float> reordered(expected.size());
+        for (size_t row = 0; row < beams; row++) {
+            const size_t src = step[row] < 0 ? step[row] + beams : step[row];
+            std::copy_n(expected.begin() + src * rowLength, rowLength, reordered.begin() + row * rowLength);
+        }
+        expected = reordered;
+    }
+
+    auto state = inferRequest.query_state().front().get_state();
+    for (size_t i = 0; i < expected.size(); i++)
+        ASSERT_FLOAT_EQ(state.data<float>()[i], expected[i]);
+}
+
+} // namespace SubgraphTestsDefinitions
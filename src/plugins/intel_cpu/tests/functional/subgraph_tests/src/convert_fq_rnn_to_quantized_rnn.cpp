@@ -13,11 +13,13 @@
 #include "shared_test_classes/base/ov_subgraph.hpp"
 #include "test_utils/fusing_test_utils.hpp"
 #include "ngraph_functions/builders.hpp"
+#include "shared_test_classes/base/benchmark.hpp"
 #include "common_test_utils/common_utils.hpp"
 #include <common_test_utils/ov_tensor_utils.hpp>
 
 #include <algorithm>
 #include <cassert>
+#include <map>
 #include <memory>
 #include <vector>
 
@@ -28,7 +30,12 @@ using namespace ov;
 
 namespace SubgraphTestsDefinitions {
 
-using ConvertFqRnnToQuantizedRnnTestParams = std::tuple<std::string, std::vector<InputShape>, bool>;
+using ConvertFqRnnToQuantizedRnnTestParams = std::tuple<std::string,                        // RNN type
+                                                        std::vector<InputShape>,            // Shapes
+                                                        bool,                               // Quantized hidden state
+                                                        bool,                               // Per channel weights
+                                                        std::map<std::string, std::string>  // Additional config
+                                                        >;
 
 class ConvertFqRnnToQuantizedRnn : public testing::WithParamInterface<ConvertFqRnnToQuantizedRnnTestParams>,
                                    public CpuTestWithFusing,
@@ -38,8 +45,10 @@ public:
         std::vector<InputShape> inputShapes;
         std::string rnnType;
         bool quantizedHiddenState = false;
+        bool perChannelWeights = false;
+        std::map<std::string, std::string> additionalConfig;
 
-        std::tie(rnnType, inputShapes, quantizedHiddenState) = obj.param;
+        std::tie(rnnType, inputShapes, quantizedHiddenState, perChannelWeights, additionalConfig) = obj.param;
 
         auto batchSize  = inputShapes[0];
         auto inputSize  = inputShapes[1];
@@ -62,7 +71,16 @@ public:
             result << "}_";
         }
 
-        result << "quantizedHiddenState=" << quantizedHiddenState;
+        result << "quantizedHiddenState=" << quantizedHiddenState << "_";
+        result << "perChannelWeights=" << perChannelWeights;
+
+        if (!additionalConfig.empty()) {
+            result << "_PluginConf";
+            for (auto& item : additionalConfig) {
+                if (item.second == InferenceEngine::PluginConfigParams::YES)
+                    result << "_" << item.first << "=" << item.second;
+            }
+        }
 
         return result.str();
     }
@@ -95,8 +113,11 @@ protected:
         std::vector<InputShape> inputShapes;
         std::string rnnType;
         bool quantizedHiddenState = false;
+        bool perChannelWeights = false;
+        std::map<std::string, std::string> additionalConfig;
 
-        std::tie(rnnType, inputShapes, quantizedHiddenState) = this->GetParam();
+        std::tie(rnnType, inputShapes, quantizedHiddenState, perChannelWeights, additionalConfig) = this->GetParam();
+        configuration.insert(additionalConfig.begin(), additionalConfig.end());
 
         if (rnnType != "LSTMSequence") // remove cell input for non-cell rnn types
             inputShapes.erase(inputShapes.begin() + cellIdx);
@@ -136,12 +157,21 @@ protected:
         auto R = ngraph::builder::makeConstant(ngraph::element::f32, {numDirections, numOfGates     * hiddenSize, hiddenSize}, {}, true, 1.f, -1.f);
         auto B = ngraph::builder::makeConstant(ngraph::element::f32, {numDirections, numOfBiasGates * hiddenSize},             {}, true, 0.1f, -0.1f);
 
-        auto makeWeightsFQ = [](const std::shared_ptr<Node> weight) {
+        // the same scales are used for W and R, since oneDNN applies a single set of weights scales
+        const size_t channels = perChannelWeights ? numOfGates * hiddenSize : 1;
+        std::vector<float> weightsLow(channels), weightsHigh(channels);
+        for (size_t i = 0; i < channels; i++) {
+            weightsHigh[i] = 127.f / (63 + i % 5 * 16);
+            weightsLow[i] = -weightsHigh[i];
+        }
+        const auto weightsConstShape = perChannelWeights ? std::vector<size_t>{numDirections, channels, 1} : std::vector<size_t>{};
+
+        auto makeWeightsFQ = [&](const std::shared_ptr<Node> weight) {
             const auto fqLevelsW = 255;
             return ngraph::builder::makeFakeQuantize(weight, ngraph::element::f32,
-                                                     fqLevelsW, std::vector<size_t>{},
-                                                     {-127.f/63}, {127.f/63},
-                                                     {-127.f/63}, {127.f/63});
+                                                     fqLevelsW, weightsConstShape,
+                                                     weightsLow, weightsHigh,
+                                                     weightsLow, weightsHigh);
         };
 
         auto W_FQ = makeWeightsFQ(W);
@@ -178,6 +208,9 @@ protected:
 
         if (maxSeqLen > 1)
             abs_threshold = 0.05; // RNN int8 computation is expected to affect the accuracy, especially when sequence_length > 1
+        // with bf16 the layer output and the cell state are kept in bf16 as well
+        if (additionalConfig[InferenceEngine::PluginConfigParams::KEY_ENFORCE_BF16] == InferenceEngine::PluginConfigParams::YES)
+            abs_threshold = 0.05;
 
         function = makeNgraphFunction(ngPrec, inputParams, rnnCellOp, "ConvertFqRnnToQuantizedRnn");
     }
@@ -207,12 +240,55 @@ const std::vector<std::vector<InputShape>> staticShapesLSTM = {
 };
 
 std::vector<bool> quantizedHiddenStateParam{true, false};
+std::vector<bool> perChannelWeightsParam{false, true};
+
+const std::map<std::string, std::string> enforceBF16{
+    {InferenceEngine::PluginConfigParams::KEY_ENFORCE_BF16, InferenceEngine::PluginConfigParams::YES}};
 
 INSTANTIATE_TEST_SUITE_P(smoke_static, ConvertFqRnnToQuantizedRnn,
                          ::testing::Combine(::testing::Values("LSTMSequence", "GRUSequence"),
                                             // "LBRGRUSequence", // enable after implemented in oneDNN
                                             ::testing::ValuesIn(staticShapesLSTM),
-                                            ::testing::ValuesIn(quantizedHiddenStateParam)),
+                                            ::testing::ValuesIn(quantizedHiddenStateParam),
+                                            ::testing::ValuesIn(perChannelWeightsParam),
+                                            ::testing::Values(std::map<std::string, std::string>{})),
+                         ConvertFqRnnToQuantizedRnn::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_static_bf16, ConvertFqRnnToQuantizedRnn,
+                         ::testing::Combine(::testing::Values("LSTMSequence", "GRUSequence"),
+                                            ::testing::ValuesIn(staticShapesLSTM),
+                                            ::testing::ValuesIn(quantizedHiddenStateParam),
+                                            ::testing::ValuesIn(perChannelWeightsParam),
+                                            ::testing::Values(enforceBF16)),
+                         ConvertFqRnnToQuantizedRnn::getTestCaseName);
+
+/* ============= Benchmark ============= */
+// speech-like sequences, compare the f32 and the bf16 (ENFORCE_BF16) runs of the same instance
+const std::vector<std::vector<InputShape>> shapesBenchmark = {
+    {
+        { {}, { {1, 500, 80} } },   // X
+        { {}, { {1, 1, 512}} },     // H
+        { {}, { {1, 1, 512}} },     // C
+    },
+    {
+        { {}, { {16, 100, 256} } }, // X
+        { {}, { {16, 1, 256}} },    // H
+        { {}, { {16, 1, 256}} },    // C
+    },
+};
+
+struct ConvertFqRnnToQuantizedRnnBenchmark : ov::test::BenchmarkLayerTest<ConvertFqRnnToQuantizedRnn> {};
+
+TEST_P(ConvertFqRnnToQuantizedRnnBenchmark, DISABLED_RNNSeq_Benchmark) {
+    run_benchmark("RNNSeq", std::chrono::milliseconds(1000), 100);
+}
+
+INSTANTIATE_TEST_SUITE_P(Benchmark_QuantizedRNNSeq, ConvertFqRnnToQuantizedRnnBenchmark,
+                         ::testing::Combine(::testing::Values("LSTMSequence", "GRUSequence"),
+                                            ::testing::ValuesIn(shapesBenchmark),
+                                            ::testing::Values(true),
+                                            ::testing::Values(true),
+                                            ::testing::Values(std::map<std::string, std::string>{}, enforceBF16)),
                          ConvertFqRnnToQuantizedRnn::getTestCaseName);
 } // namespace
 
@@ -0,0 +1,53 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <thread>
+
+#include <common/utils.hpp>
+#include "utils/memory_placement.hpp"
+
+using namespace ov::intel_cpu;
+
+TEST(MemoryPlacementTest, ScopesAreNestedPerThread) {
+    ASSERT_TRUE(MemoryPlacementScope::current().isDefault());
+
+    MemoryPlacement hugePages;
+    hugePages.hugePages = true;
+    MemoryPlacement numa;
+    numa.numaNodes = {0};
+    {
+        MemoryPlacementScope outer(hugePages);
+        ASSERT_TRUE(MemoryPlacementScope::current().hugePages);
+        {
+            MemoryPlacementScope inner(numa);
+            ASSERT_FALSE(MemoryPlacementScope::current().hugePages);
+            ASSERT_EQ(MemoryPlacementScope::current().numaNodes, numa.numaNodes);
+        }
+        ASSERT_TRUE(MemoryPlacementScope::current().hugePages);
+
+        std::thread([] {
+            ASSERT_TRUE(MemoryPlacementScope::current().isDefault());
+        }).join();
+    }
+    ASSERT_TRUE(MemoryPlacementScope::current().isDefault());
+}
+
+TEST(MemoryPlacementTest, PlacedMemoryIsUsable) {
+    MemoryPlacement placement;
+    placement.hugePages = true;
+    placement.numaNodes = {0};
+    MemoryPlacementScope scope(placement);
+
+    for (size_t size : {size_t{100}, size_t{10000}, size_t{5} << 20}) {
+        void* ptr = allocatePlaced(size, 64);
+        ASSERT_NE(ptr, nullptr);
+        ASSERT_EQ(reinterpret_cast<uintptr_t>(ptr) % 64, 0u);
+        std::memset(ptr, 1, size);
+        dnnl::impl::free(ptr);
+    }
+}
@@ -0,0 +1,96 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "ngraph/runtime/reference/sampling.hpp"
+#include "nodes/common/sampling_kernel.h"
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+struct SamplingCase {
+    float temperature;
+    size_t topK;
+    float topP;
+};
+
+template <typename T>
+void check_sampling(const std::vector<T>& logits, size_t rows, size_t vocab, const SamplingCase& c,
+                    const WorkSplitter& parallel) {
+    std::mt19937 gen(static_cast<unsigned>(rows + vocab + c.topK));
+    std::uniform_real_distribution<float> dist(0.f, 1.f);
+    std::vector<float> uniforms(rows);
+    for (auto& u : uniforms)
+        u = dist(gen);
+
+    std::vector<int32_t> expected(rows), actual(rows);
+    ngraph::runtime::reference::sampling(logits.data(), expected.data(), uniforms.data(), ngraph::Shape{rows, vocab},
+                                         c.temperature, static_cast<int64_t>(c.topK), c.topP);
+
+    SamplingKernel kernel(vocab, c.temperature, c.topK, c.topP);
+    kernel.execute(logits.data(), actual.data(), uniforms.data(), rows, parallel);
+    ASSERT_EQ(expected, actual) << "vocab " << vocab << " temperature " << c.temperature << " top_k " << c.topK
+                                << " top_p " << c.topP;
+}
+
+const std::vector<SamplingCase> cases = {
+    {1.0f, 0, 1.0f},
+    {0.7f, 0, 1.0f},
+    {1.0f, 1, 1.0f},
+    {0.8f, 50, 1.0f},
+    {1.0f, 3000, 1.0f},
+    {1.0f, 0, 0.9f},
+    {1.5f, 0, 0.99f},
+    {0.7f, 40, 0.9f},
+    {1.0f, 0, 0.01f},
+};
+
+}  // namespace
+
+TEST(SamplingKernelTest, Float) {
+    std::mt19937 gen(0);
+    std::normal_distribution<float> dist(0.f, 3.f);
+    for (size_t rows : {size_t(1), size_t(5), size_t(16)}) {
+        for (size_t vocab : {size_t(100), size_t(32000)}) {
+            std::vector<float> logits(rows * vocab);
+            for (auto& v : logits)
+                v = dist(gen);
+            for (const auto& c : cases) {
+                check_sampling(logits, rows, vocab, c, WorkSplitter());
+                check_sampling(logits, rows, vocab, c, WorkSplitter(1));
+            }
+        }
+    }
+}
+
+TEST(SamplingKernelTest, FlatDistribution) {
+    // the nucleus of the almost uniform distribution is most of the vocabulary, the sorted prefix grows several times
+    const size_t vocab = 50272;
+    std::mt19937 gen(1);
+    std::uniform_real_distribution<float> dist(-0.01f, 0.01f);
+    std::vector<float> logits(2 * vocab);
+    for (auto& v : logits)
+        v = dist(gen);
+    logits[7] = 0.f;
+    logits[8] = -0.f;
+    for (float topP : {0.5f, 0.95f, 1.0f})
+        check_sampling(logits, 2, vocab, {1.0f, 0, topP}, WorkSplitter());
+}
+
+TEST(SamplingKernelTest, BFloat16) {
+    // many equal logits, the ties are broken by the index
+    std::mt19937 gen(2);
+    std::uniform_real_distribution<float> dist(-8.f, 8.f);
+    const size_t vocab = 8192;
+    std::vector<bfloat16_t> logits(3 * vocab);
+    for (auto& v : logits)
+        v = bfloat16_t(dist(gen));
+    for (const auto& c : cases)
+        check_sampling(logits, 3, vocab, c, WorkSplitter());
+}
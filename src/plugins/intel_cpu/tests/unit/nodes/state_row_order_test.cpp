@@ -0,0 +1,72 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "nodes/common/state_row_order.h"
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+// Gather along the outermost axis, the rows of the indices out of the range are zeros
+std::vector<float> gather_rows(const std::vector<float>& data, const std::vector<int32_t>& beamIdx, size_t rowLength) {
+    const auto rows = static_cast<int64_t>(beamIdx.size());
+    std::vector<float> result(data.size(), 0.f);
+    for (size_t i = 0; i < beamIdx.size(); i++) {
+        int64_t idx = beamIdx[i] < 0 ? beamIdx[i] + rows : beamIdx[i];
+        if (idx < 0 || idx >= rows)
+            continue;
+        std::copy(data.begin() + idx * rowLength, data.begin() + (idx + 1) * rowLength, result.begin() + i * rowLength);
+    }
+    return result;
+}
+
+}  // namespace
+
+TEST(StateRowOrderTest, ReorderMatchesGather) {
+    const size_t beams = 6, rowLength = 5;
+    std::vector<float> data(beams * rowLength);
+    for (size_t i = 0; i < data.size(); i++)
+        data[i] = static_cast<float>(i + 1);
+
+    std::mt19937 gen(0);
+    std::uniform_int_distribution<int32_t> dist(-static_cast<int32_t>(beams), static_cast<int32_t>(beams) - 1);
+    StateRowOrder order;
+    std::vector<float> state = data;
+    std::vector<float> expected = data;
+    for (int step = 0; step < 10; step++) {
+        std::vector<int32_t> beamIdx(beams);
+        for (auto& idx : beamIdx)
+            idx = dist(gen);
+        if (step == 3)
+            beamIdx[1] = static_cast<int32_t>(beams);  // a zero row
+        expected = gather_rows(expected, beamIdx, rowLength);
+        order.reorder(beamIdx.data(), beams);
+        ASSERT_FALSE(order.isIdentity());
+        ASSERT_EQ(order.get().size(), beams);
+    }
+
+    // the data is not touched by the reorder, it is rewritten by the normalization only
+    ASSERT_EQ(state, data);
+    order.normalize(reinterpret_cast<uint8_t*>(state.data()), rowLength * sizeof(float));
+    ASSERT_TRUE(order.isIdentity());
+    ASSERT_EQ(state, expected);
+}
+
+TEST(StateRowOrderTest, Reset) {
+    StateRowOrder order;
+    const std::vector<int32_t> beamIdx{1, 1, 0};
+    order.reorder(beamIdx.data(), beamIdx.size());
+    ASSERT_EQ(order.get(), std::vector<size_t>({1, 1, 0}));
+    order.reset();
+    ASSERT_TRUE(order.isIdentity());
+
+    std::vector<float> state{1.f, 2.f, 3.f};
+    order.normalize(reinterpret_cast<uint8_t*>(state.data()), sizeof(float));
+    ASSERT_EQ(state, std::vector<float>({1.f, 2.f, 3.f}));
+}
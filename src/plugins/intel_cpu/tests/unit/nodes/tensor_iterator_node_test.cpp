@@ -0,0 +1,165 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cpu_memory.h>
+#include <edge.h>
+#include <graph_context.h>
+#include <memory_desc/cpu_blocked_memory_desc.h>
+#include <nodes/input.h>
+#include <nodes/tensoriterator.h>
+
+#include <algorithm>
+#include <functional>
+#include <openvino/opsets/opset5.hpp>
+#include <vector>
+
+using namespace InferenceEngine;
+using namespace ov::intel_cpu;
+
+namespace {
+
+// gives access to the body memories, which are bound right to the chunks of the node memories on the zero-copy path
+class TensorIteratorNode : public node::TensorIterator {
+public:
+    using node::TensorIterator::TensorIterator;
+    using node::TensorIterator::input_mems;
+    using node::TensorIterator::output_mem;
+};
+
+using BodyBuilder = std::function<ov::Output<ov::Node>(const ov::ParameterVector&)>;
+
+/*
+ * Runs the static TensorIterator of smoke_TensorIteratorStatic: two [1, 12, 10] inputs sliced by axis 1 and
+ * the output concatenated by axis 1, so every chunk is a dense block of its tensor.
+ */
+class TensorIteratorZeroCopyTest : public ::testing::Test {
+protected:
+    void build(const BodyBuilder& makeBody) {
+        const ov::Shape bodyShape{1, 1, 10};
+        ov::ParameterVector bodyParams{std::make_shared<ov::opset5::Parameter>(ov::element::f32, bodyShape),
+                                       std::make_shared<ov::opset5::Parameter>(ov::element::f32, bodyShape)};
+        const auto body = std::make_shared<ov::Model>(ov::OutputVector{makeBody(bodyParams)}, bodyParams, "body");
+
+        ov::ParameterVector params{std::make_shared<ov::opset5::Parameter>(ov::element::f32, shape),
+                                   std::make_shared<ov::opset5::Parameter>(ov::element::f32, shape)};
+        const auto ti = std::make_shared<ov::opset5::TensorIterator>();
+        ti->set_function(body);
+        ti->set_sliced_input(bodyParams[0], params[0], 0, 1, 1, -1, 1);
+        ti->set_sliced_input(bodyParams[1], params[1], 0, 1, 1, -1, 1);
+        ti->get_concatenated_slices(body->get_results()[0]->input_value(0), 0, 1, 1, -1, 1);
+
+        Config conf;
+        conf.rtCacheCapacity = 100;
+        context = std::make_shared<GraphContext>(conf, nullptr, std::make_shared<WeightsSharing>(), false);
+        const auto& engine = context->getEngine();
+        const CpuBlockedMemoryDesc desc(Precision::FP32, Shape(shape));
+
+        tiNode = std::make_shared<TensorIteratorNode>(ti, context);
+        std::vector<NodePtr> nodes;
+        for (size_t i = 0; i < params.size(); i++) {
+            auto inputNode = std::make_shared<node::Input>(desc.clone(), "Input" + std::to_string(i), "Parameter", context);
+            edges.push_back(std::make_shared<Edge>(inputNode, tiNode, 0, static_cast<int>(i)));
+            inputs.push_back(std::make_shared<Memory>(engine, desc));
+            edges.back()->reuse(inputs.back());
+            nodes.push_back(inputNode);
+        }
+        auto outputNode = std::make_shared<node::Input>(desc.clone(), "Output", "Result", context);
+        edges.push_back(std::make_shared<Edge>(tiNode, outputNode, 0, 0));
+        output = std::make_shared<Memory>(engine, desc);
+        edges.back()->reuse(output);
+        nodes.push_back(tiNode);
+        nodes.push_back(outputNode);
+
+        for (const auto& edge : edges) {
+            edge->changeStatus(Edge::Status::NeedAllocation);
+            tiNode->addEdge(edge);
+        }
+        for (const auto& node : nodes) {
+            node->init();
+            node->getSupportedDescriptors();
+            node->initSupportedPrimitiveDescriptors();
+            node->selectPrimitiveDescriptorByIndex(0);
+        }
+        tiNode->createPrimitive();
+    }
+
+    void infer() {
+        for (size_t i = 0; i < inputs.size(); i++) {
+            auto data = static_cast<float*>(inputs[i]->getData());
+            for (size_t j = 0; j < ov::shape_size(shape); j++)
+                data[j] = static_cast<float>(static_cast<int>((j * (i + 3)) % 17) - 8) / 4.0f;
+        }
+        const auto before = values(*inputs[0]);
+
+        dnnl::stream stream{context->getEngine()};
+        tiNode->execute(stream);
+
+        // the body must never write to the inputs of the node
+        ASSERT_EQ(before, values(*inputs[0]));
+    }
+
+    static std::vector<float> values(const IMemory& mem) {
+        const auto data = static_cast<const float*>(mem.getData());
+        return std::vector<float>(data, data + mem.getShape().getElementsCount());
+    }
+
+    // after the last iteration the body memory is bound to the last chunk of the node memory
+    static bool isBoundToLastChunk(const IMemory& body, const IMemory& node) {
+        const auto lastChunk = static_cast<const uint8_t*>(node.getData()) + node.getSize() - body.getSize();
+        return body.getData() == lastChunk;
+    }
+
+    const ov::Shape shape{1, 12, 10};
+    GraphContext::CPtr context;
+    std::shared_ptr<TensorIteratorNode> tiNode;
+    std::vector<EdgePtr> edges;
+    std::vector<MemoryPtr> inputs;
+    MemoryPtr output;
+};
+
+}  // namespace
+
+TEST_F(TensorIteratorZeroCopyTest, ViewsOfSlicedInputsAreBoundInPlace) {
+    // the body reads the inputs through in-place Squeeze views only
+    build([](const ov::ParameterVector& params) {
+        const auto axis = ov::opset5::Constant::create(ov::element::i64, ov::Shape{1}, {1});
+        const auto add = std::make_shared<ov::opset5::Add>(std::make_shared<ov::opset5::Squeeze>(params[0], axis),
+                                                           std::make_shared<ov::opset5::Squeeze>(params[1], axis));
+        return std::make_shared<ov::opset5::Unsqueeze>(add, axis)->output(0);
+    });
+    ASSERT_NO_FATAL_FAILURE(infer());
+
+    for (size_t i = 0; i < inputs.size(); i++) {
+        ASSERT_TRUE(isBoundToLastChunk(*tiNode->input_mems[i].front(), *inputs[i])) << "input " << i;
+    }
+    ASSERT_TRUE(isBoundToLastChunk(*tiNode->output_mem[0], *output));
+
+    const auto x = values(*inputs[0]);
+    const auto y = values(*inputs[1]);
+    const auto actual = values(*output);
+    for (size_t i = 0; i < actual.size(); i++) {
+        ASSERT_EQ(x[i] + y[i], actual[i]) << "index " << i;
+    }
+}
+
+TEST_F(TensorIteratorZeroCopyTest, InputsOverwrittenInPlaceAreCopied) {
+    // Relu has the only consumer of the first input, so it may compute in place and overwrite the body input
+    build([](const ov::ParameterVector& params) {
+        const auto relu = std::make_shared<ov::opset5::Relu>(params[0]);
+        return std::make_shared<ov::opset5::Add>(relu, std::make_shared<ov::opset5::Multiply>(relu, params[1]))->output(0);
+    });
+    ASSERT_NO_FATAL_FAILURE(infer());
+
+    ASSERT_TRUE(isBoundToLastChunk(*tiNode->output_mem[0], *output));
+
+    const auto x = values(*inputs[0]);
+    const auto y = values(*inputs[1]);
+    const auto actual = values(*output);
+    for (size_t i = 0; i < actual.size(); i++) {
+        const auto relu = std::max(x[i], 0.0f);
+        ASSERT_FLOAT_EQ(relu + relu * y[i], actual[i]) << "index " << i;
+    }
+}
@@ -0,0 +1,130 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "nodes/common/topk_radix_select.h"
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+// stable top K: the equal values are ordered by the index
+template <typename T>
+void topk_reference(const std::vector<T>& src, size_t rows, size_t axisDim, size_t topK, bool modeMax, bool sortIndex,
+                    std::vector<T>& dst, std::vector<int32_t>& dstIdx) {
+    dst.resize(rows * topK);
+    dstIdx.resize(rows * topK);
+    for (size_t r = 0; r < rows; r++) {
+        const T* row = src.data() + r * axisDim;
+        std::vector<int32_t> idx(axisDim);
+        std::iota(idx.begin(), idx.end(), 0);
+        std::partial_sort(idx.begin(), idx.begin() + topK, idx.end(), [&](int32_t a, int32_t b) {
+            const float va = static_cast<float>(row[a]);
+            const float vb = static_cast<float>(row[b]);
+            if (va != vb)
+                return modeMax ? va > vb : va < vb;
+            return a < b;
+        });
+        if (sortIndex)
+            std::sort(idx.begin(), idx.begin() + topK);
+        for (size_t k = 0; k < topK; k++) {
+            dst[r * topK + k] = row[idx[k]];
+            dstIdx[r * topK + k] = idx[k];
+        }
+    }
+}
+
+template <typename T>
+void check_topk(const std::vector<T>& src, size_t rows, size_t axisDim, size_t topK, bool modeMax, bool sortIndex,
+                const WorkSplitter& parallel) {
+    std::vector<T> expected, actual(rows * topK);
+    std::vector<int32_t> expectedIdx, actualIdx(rows * topK);
+    topk_reference(src, rows, axisDim, topK, modeMax, sortIndex, expected, expectedIdx);
+
+    TopKRadixSelect topk(axisDim, topK, modeMax, sortIndex);
+    topk.execute(src.data(), actual.data(), actualIdx.data(), rows, parallel);
+    ASSERT_EQ(expectedIdx, actualIdx) << "rows " << rows << " axis " << axisDim << " k " << topK;
+    for (size_t i = 0; i < expected.size(); i++)
+        ASSERT_EQ(static_cast<float>(expected[i]), static_cast<float>(actual[i]));
+}
+
+}  // namespace
+
+TEST(TopKRadixSelectTest, Applicability) {
+    ASSERT_FALSE(TopKRadixSelect::isApplicable(1024, 1));
+    ASSERT_TRUE(TopKRadixSelect::isApplicable(50272, 1));
+    ASSERT_TRUE(TopKRadixSelect::isApplicable(50272, 4096));
+    ASSERT_FALSE(TopKRadixSelect::isApplicable(50272, 0));
+    ASSERT_FALSE(TopKRadixSelect::isApplicable(8192, 4096));
+}
+
+TEST(TopKRadixSelectTest, Float) {
+    std::mt19937 gen(0);
+    std::normal_distribution<float> dist(0.f, 4.f);
+    for (size_t rows : {size_t(1), size_t(3), size_t(64)}) {
+        const size_t axisDim = 32000;
+        std::vector<float> src(rows * axisDim);
+        for (auto& v : src)
+            v = dist(gen);
+        for (size_t topK : {size_t(1), size_t(50), size_t(2000)}) {
+            for (bool modeMax : {true, false}) {
+                check_topk(src, rows, axisDim, topK, modeMax, false, WorkSplitter());
+                check_topk(src, rows, axisDim, topK, modeMax, true, WorkSplitter());
+                check_topk(src, rows, axisDim, topK, modeMax, false, WorkSplitter(1));
+            }
+        }
+    }
+}
+
+TEST(TopKRadixSelectTest, RepeatedValues) {
+    // the K-th value is repeated, the lower indices of it must be selected
+    const size_t axisDim = 10000;
+    std::vector<float> src(axisDim);
+    for (size_t i = 0; i < axisDim; i++)
+        src[i] = static_cast<float>(i % 7) - 3.f;
+    src[42] = -0.f;
+    for (size_t topK : {size_t(1), size_t(100), size_t(1500), size_t(2500)}) {
+        check_topk(src, 1, axisDim, topK, true, false, WorkSplitter());
+        check_topk(src, 1, axisDim, topK, false, false, WorkSplitter());
+        check_topk(src, 1, axisDim, topK, true, true, WorkSplitter());
+    }
+}
+
+TEST(TopKRadixSelectTest, Integer) {
+    std::mt19937 gen(1);
+    const size_t axisDim = 50272;
+    std::vector<int32_t> src(2 * axisDim);
+    std::uniform_int_distribution<int32_t> dist(std::numeric_limits<int32_t>::min(), std::numeric_limits<int32_t>::max());
+    for (auto& v : src)
+        v = dist(gen);
+    check_topk(src, 2, axisDim, 10, true, false, WorkSplitter());
+    check_topk(src, 2, axisDim, 10, false, false, WorkSplitter());
+
+    std::vector<int8_t> src_i8(axisDim);
+    std::vector<uint8_t> src_u8(axisDim);
+    for (size_t i = 0; i < axisDim; i++) {
+        src_i8[i] = static_cast<int8_t>(gen());
+        src_u8[i] = static_cast<uint8_t>(gen());
+    }
+    check_topk(src_i8, 1, axisDim, 300, true, false, WorkSplitter());
+    check_topk(src_u8, 1, axisDim, 300, false, true, WorkSplitter());
+}
+
+TEST(TopKRadixSelectTest, BFloat16) {
+    std::mt19937 gen(2);
+    std::uniform_real_distribution<float> dist(-100.f, 100.f);
+    const size_t axisDim = 8192;
+    std::vector<bfloat16_t> src(axisDim);
+    for (auto& v : src)
+        v = bfloat16_t(dist(gen));
+    check_topk(src, 1, axisDim, 64, true, false, WorkSplitter());
+    check_topk(src, 1, axisDim, 64, false, true, WorkSplitter());
+}
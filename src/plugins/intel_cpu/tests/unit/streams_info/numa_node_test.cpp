@@ -0,0 +1,88 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <ie_system_conf.h>
+
+#include <common_test_utils/test_common.hpp>
+
+#include "cpu_map_scheduling.hpp"
+
+using namespace testing;
+using namespace ov;
+
+namespace {
+
+struct NumaNodeTestCase {
+    int numa_node_index;
+    std::vector<std::vector<int>> proc_type_table;
+    std::vector<std::vector<int>> result_table;
+};
+
+class NumaNodeTests : public ov::test::TestsCommon, public testing::WithParamInterface<std::tuple<NumaNodeTestCase>> {
+public:
+    void SetUp() override {
+        const auto& test_data = std::get<0>(GetParam());
+
+        std::vector<std::vector<int>> test_result_table =
+            ov::intel_cpu::apply_numa_node(test_data.numa_node_index, test_data.proc_type_table);
+
+        ASSERT_EQ(test_data.result_table, test_result_table);
+    }
+};
+
+NumaNodeTestCase _2sockets_all_nodes = {
+    -1,
+    {{208, 104, 0, 104, -1, -1}, {104, 52, 0, 52, 0, 0}, {104, 52, 0, 52, 1, 1}},
+    {{208, 104, 0, 104, -1, -1}, {104, 52, 0, 52, 0, 0}, {104, 52, 0, 52, 1, 1}},
+};
+
+NumaNodeTestCase _2sockets_node_0 = {
+    0,
+    {{208, 104, 0, 104, -1, -1}, {104, 52, 0, 52, 0, 0}, {104, 52, 0, 52, 1, 1}},
+    {{104, 52, 0, 52, 0, 0}},
+};
+
+NumaNodeTestCase _2sockets_node_1 = {
+    1,
+    {{208, 104, 0, 104, -1, -1}, {104, 52, 0, 52, 0, 0}, {104, 52, 0, 52, 1, 1}},
+    {{104, 52, 0, 52, 1, 1}},
+};
+
+NumaNodeTestCase _1socket_2nodes_node_1 = {
+    1,
+    {{96, 48, 0, 48, -1, 0}, {48, 24, 0, 24, 0, 0}, {48, 24, 0, 24, 1, 0}},
+    {{48, 24, 0, 24, 1, 0}},
+};
+
+NumaNodeTestCase _2sockets_unordered_node_0 = {
+    0,
+    {{208, 104, 0, 104, -1, -1}, {104, 52, 0, 52, 1, 1}, {104, 52, 0, 52, 0, 0}},
+    {{104, 52, 0, 52, 0, 0}},
+};
+
+NumaNodeTestCase _2sockets_sparse_node_2 = {
+    2,
+    {{208, 104, 0, 104, -1, -1}, {104, 52, 0, 52, 0, 0}, {104, 52, 0, 52, 2, 1}},
+    {{104, 52, 0, 52, 2, 1}},
+};
+
+NumaNodeTestCase _1socket_node_0 = {
+    0,
+    {{20, 6, 8, 6, 0, 0}},
+    {{20, 6, 8, 6, 0, 0}},
+};
+
+TEST_P(NumaNodeTests, NumaNode) {}
+
+INSTANTIATE_TEST_SUITE_P(NumaNodeTable,
+                         NumaNodeTests,
+                         testing::Values(_2sockets_all_nodes,
+                                         _2sockets_node_0,
+                                         _2sockets_node_1,
+                                         _1socket_2nodes_node_1,
+                                         _2sockets_unordered_node_0,
+                                         _2sockets_sparse_node_2,
+                                         _1socket_node_0));
+}  // namespace
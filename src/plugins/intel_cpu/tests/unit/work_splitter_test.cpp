@@ -0,0 +1,96 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "utils/work_splitter.hpp"
+
+using namespace ov::intel_cpu;
+
+TEST(WorkSplitterTest, NumThreadsIsLimitedByWork) {
+    WorkSplitter parallel;
+    const int maxThreads = parallel.getNumThreads();
+    ASSERT_GE(maxThreads, 1);
+    ASSERT_EQ(parallel.getNumThreads(0), 1);
+    ASSERT_EQ(parallel.getNumThreads(1), 1);
+    ASSERT_EQ(parallel.getNumThreads(100, 100), 1);
+    ASSERT_EQ(parallel.getNumThreads(101, 100), std::min(maxThreads, 2));
+    ASSERT_EQ(parallel.getNumThreads(1000000), maxThreads);
+
+    WorkSplitter limited(1);
+    ASSERT_EQ(limited.getNumThreads(), 1);
+    ASSERT_EQ(limited.getNumThreads(1000000), 1);
+}
+
+TEST(WorkSplitterTest, RangesCoverWorkOnce) {
+    WorkSplitter parallel;
+    for (size_t work : {size_t(1), size_t(7), size_t(64), size_t(1001)}) {
+        std::vector<std::atomic<int>> visited(work);
+        for (auto& v : visited)
+            v = 0;
+        parallel.parallelForRange(work, 3, [&](size_t start, size_t end) {
+            ASSERT_LT(start, end);
+            for (size_t i = start; i < end; i++)
+                visited[i]++;
+        });
+        for (size_t i = 0; i < work; i++)
+            ASSERT_EQ(visited[i], 1) << "work " << work << " item " << i;
+    }
+}
+
+TEST(WorkSplitterTest, SmallWorkRunsInCallingThread) {
+    WorkSplitter parallel;
+    const auto caller = std::this_thread::get_id();
+    size_t calls = 0;
+    parallel.parallelFor(4, [&](size_t) {
+        ASSERT_EQ(std::this_thread::get_id(), caller);
+        calls++;
+    }, 4);
+    ASSERT_EQ(calls, 4u);
+}
+
+// Microbenchmark of the dispatch latency, run it with --gtest_also_run_disabled_tests.
+// Work of a single thread doesn't enter a parallel region, so its dispatch has to stay below 1us.
+TEST(WorkSplitterTest, DISABLED_DispatchLatency) {
+    WorkSplitter parallel;
+    std::atomic<size_t> sink{0};
+
+    const auto measure = [](size_t iterations, const std::function<void()>& dispatch) {
+        // wakes up the workers
+        dispatch();
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < iterations; i++)
+            dispatch();
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        return std::chrono::duration<double, std::nano>(elapsed).count() / iterations;
+    };
+
+    const int nthr = parallel.getNumThreads();
+    const double inlineNs = measure(100000, [&] {
+        parallel.parallelFor(1, [&](size_t i) {
+            sink += i;
+        });
+    });
+    const double parallelNs = measure(10000, [&] {
+        parallel.parallelFor(static_cast<size_t>(nthr), [&](size_t i) {
+            sink += i;
+        });
+    });
+    const double parallelNtNs = measure(10000, [&] {
+        ov::parallel_nt(nthr, [&](const int ithr, const int) {
+            sink += ithr;
+        });
+    });
+
+    std::cout << "[ DISPATCH ] threads: " << nthr << ", single thread work: " << inlineNs
+              << " ns, WorkSplitter: " << parallelNs << " ns, parallel_nt: " << parallelNtNs << " ns" << std::endl;
+    EXPECT_LT(inlineNs, 1000.0);
+}
@@ -8,6 +8,7 @@
 #include <cstdint>
 #include <cstdio>
 #include <limits>
+#include <utility>
 
 #include "backend/dnn_types.hpp"
 #include "backend/gna_limitations.hpp"
@@ -15,6 +16,8 @@
 #include "gna_lib_ver_selector.hpp"
 #include "layers/gna_convolution_layer.hpp"
 #include "log/debug.hpp"
+#include "openvino/core/parallel.hpp"
+#include "runtime/floatmath.h"
 
 using namespace ov::intel_gna::gna_convolution_layer;
 using namespace ov::intel_gna::limitations;
@@ -40,15 +43,13 @@ void CNNFilter32(intel_dnn_component_t* component) {
         THROW_GNA_EXCEPTION << "Bad num_columns_out in CNNFilter32!" << layer_name;
     }
 
-    for (uint32_t j = 0; j < numberOfOutputsPerFilter; j++, input += convolutionStride, output += numberOfFilters) {
-        auto filter = filters;
-        for (uint32_t i = 0; i < numberOfFilters; i++, filter += filterSize) {
-            output[i] = biases[i];
-            for (uint32_t k = 0; k < filterSize; k++) {
-                output[i] += input[k] * filter[k];
-            }
+    ov::parallel_for(numberOfOutputsPerFilter, [&](uint32_t j) {
+        const auto window = input + j * convolutionStride;
+        const auto outputs = output + j * numberOfFilters;
+        for (uint32_t i = 0; i < numberOfFilters; i++) {
+            outputs[i] = biases[i] + sdot(filterSize, window, filters + i * filterSize);
         }
-    }
+    });
 }
 
 namespace {
@@ -200,60 +201,16 @@ void CNNMaxPool2DFloat(intel_dnn_component_t* component) {
 
 namespace {
 
-bool matchesPaddedArea(unsigned filterIndex,
-                       unsigned outputIndex,
-                       unsigned inputSize,
-                       unsigned paddingSize,
-                       unsigned stride) {
-    const auto paddedIndex = stride * outputIndex + filterIndex;
-    if (paddedIndex >= inputSize + 2 * paddingSize) {
-        THROW_GNA_EXCEPTION << "In: isZeroPaddingCase, paddedIndex >= inputSize + 2 * paddingSize";
-    }
-    if (paddedIndex < paddingSize || paddedIndex >= inputSize + paddingSize) {
-        return true;
-    }
-    return false;
-}
-
-float CNN2DFilter32SingleHWC(const float bias,
-                             const float* filter,
-                             const unsigned KH,
-                             const unsigned KW,
-                             const unsigned KC,
-                             const float* image,
-                             const unsigned IH,
-                             const unsigned IW,
-                             const unsigned IC,
-                             const unsigned oh,
-                             const unsigned ow,
-                             const unsigned oc,
-                             const std::array<uint32_t, 2>& convStride,
-                             const std::array<uint32_t, 2>& zeroPadding) {
-    const auto cSH = convStride[0];
-    const auto cSW = convStride[1];
-
-    const auto zPH = zeroPadding[0];
-    const auto zPW = zeroPadding[1];
-    float output = 0;
-    for (unsigned kh = 0; kh < KH; kh++) {
-        for (unsigned kw = 0; kw < KW; kw++) {
-            for (unsigned kc = 0; kc < KC; kc++) {
-                if (!matchesPaddedArea(kh, oh, IH, zPH, cSH) && !matchesPaddedArea(kw, ow, IW, zPW, cSW)) {
-                    const auto ih = (cSH * oh + kh) - zPH;
-                    const auto iw = (cSW * ow + kw) - zPW;
-                    const auto ic = kc;
-                    const auto imageIndex = getQubeIndex(ih, iw, ic, IW, IC);
-                    const auto imageElement = image[imageIndex];
-                    const auto filterIndex = getQubeIndex(kh, kw, kc, KW, KC);
-                    const auto filterElement = filter[filterIndex];
-                    const auto product = imageElement * filterElement;
-                    output += product;
-                }
-            }
-        }
-    }
-    output += bias;
-    return output;
+// Range [begin, end) of filter indices which fall into the input for the given output index
+std::pair<uint32_t, uint32_t> validFilterRange(uint32_t outputIndex,
+                                               uint32_t filterSize,
+                                               uint32_t inputSize,
+                                               uint32_t paddingSize,
+                                               uint32_t stride) {
+    const auto start = outputIndex * stride;
+    const auto begin = start < paddingSize ? paddingSize - start : 0;
+    const auto end = std::min(filterSize, inputSize + paddingSize > start ? inputSize + paddingSize - start : 0);
+    return {begin, std::max(begin, end)};
 }
 
 }  // namespace
@@ -286,30 +243,36 @@ void CNN2DFilter32(intel_dnn_component_t* component) {
     if (kc != IC) {
         THROW_GNA_EXCEPTION << "Depth of filter should be equal to input depth!" << layer_name;
     }
-    auto kernelIndex = 0;
-    for (unsigned oc = 0; oc < OC; oc++) {
-        for (unsigned ow = 0; ow < OW; ow++) {
-            for (unsigned oh = 0; oh < OH; oh++) {
-                const auto outputIndex = getQubeIndex(oh, ow, oc, OW, OC);
-                ptr_outputs[outputIndex] = CNN2DFilter32SingleHWC(*(ptr_biases + oc),
-                                                                  ptr_filters + kernelIndex,
-                                                                  kh,
-                                                                  kw,
-                                                                  kc,
-                                                                  ptr_inputs,
-                                                                  IH,
-                                                                  IW,
-                                                                  IC,
-                                                                  oh,
-                                                                  ow,
-                                                                  oc,
-                                                                  component->op.conv2D.convStride,
-                                                                  component->op.conv2D.zeroPadding);
+    const auto cSH = component->op.conv2D.convStride[0];
+    const auto cSW = component->op.conv2D.convStride[1];
+    const auto zPH = component->op.conv2D.zeroPadding[0];
+    const auto zPW = component->op.conv2D.zeroPadding[1];
+    if ((OH - 1) * cSH + kh > IH + 2 * zPH || (OW - 1) * cSW + kw > IW + 2 * zPW) {
+        THROW_GNA_EXCEPTION << "Convolution window exceeds the padded input!" << layer_name;
+    }
+    // kernel padded to 16B = 4 * sizeof(float)
+    const auto kernelStride = ALIGN(kh * kw * kc, Limitations::kConvEachKernelByteAlignment / sizeof(float));
+
+    // HWC layout makes the innermost channel loop a contiguous dot product,
+    // the input window of an output position is reused by all filters
+    ov::parallel_for2d(OH, OW, [&](uint32_t oh, uint32_t ow) {
+        const auto rangeH = validFilterRange(oh, kh, IH, zPH, cSH);
+        const auto rangeW = validFilterRange(ow, kw, IW, zPW, cSW);
+        for (uint32_t oc = 0; oc < OC; oc++) {
+            const float* filter = ptr_filters + oc * kernelStride;
+            float output = 0;
+            for (auto fh = rangeH.first; fh < rangeH.second; fh++) {
+                for (auto fw = rangeW.first; fw < rangeW.second; fw++) {
+                    const auto ih = cSH * oh + fh - zPH;
+                    const auto iw = cSW * ow + fw - zPW;
+                    output += sdot(kc,
+                                   ptr_inputs + getQubeIndex(ih, iw, 0u, IW, IC),
+                                   filter + getQubeIndex(fh, fw, 0u, kw, kc));
+                }
             }
+            ptr_outputs[getQubeIndex(oh, ow, oc, OW, OC)] = output + ptr_biases[oc];
         }
-        // kernel padded to 16B = 4 * sizeof(float)
-        kernelIndex += ALIGN(kh * kw * kc, Limitations::kConvEachKernelByteAlignment / sizeof(float));
-    }
+    });
 }
 
 namespace {
@@ -1,13 +1,85 @@
 // Copyright (C) 2018-2023 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 //
-// floatmath.cpp : unoptimized floating point math routines (for reference)
+// floatmath.cpp : floating point math routines of the software emulation
 //
 
 #include "floatmath.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <cstdio>
+#include <vector>
+
+#include "openvino/core/parallel.hpp"
+
+namespace {
+
+constexpr uint32_t kDotLanes = 8;
+
+// Rows of B are transposed in blocks, so a block of A rows is multiplied by B columns kept in cache
+constexpr uint32_t kColumnsBlock = 8;
+
+// C[l * ldc + j] = (beta == 1 ? C[l * ldc + j] : 0) + A[rows[l]] * B[:, j] for l in [0, L)
+void sgemm_rows(const uint32_t N,
+                const uint32_t K,
+                const float* A,
+                const uint32_t lda,
+                const float* B,
+                const uint32_t ldb,
+                const bool accumulate,
+                float* C,
+                const uint32_t ldc,
+                const uint32_t* rows,
+                const uint32_t L) {
+    if (N == 1 && ldb == 1) {
+        // matrix by vector, B column is contiguous
+        ov::parallel_for(L, [&](uint32_t l) {
+            const auto i = rows ? rows[l] : l;
+            const auto sum = sdot(K, A + i * lda, B);
+            C[l * ldc] = accumulate ? C[l * ldc] + sum : sum;
+        });
+        return;
+    }
+    for (uint32_t j0 = 0; j0 < N; j0 += kColumnsBlock) {
+        const auto columns = std::min(kColumnsBlock, N - j0);
+        std::vector<float> Bt(static_cast<size_t>(columns) * K);
+        for (uint32_t k = 0; k < K; k++) {
+            for (uint32_t j = 0; j < columns; j++) {
+                Bt[j * K + k] = B[k * ldb + j0 + j];
+            }
+        }
+        ov::parallel_for(L, [&](uint32_t l) {
+            const auto i = rows ? rows[l] : l;
+            for (uint32_t j = 0; j < columns; j++) {
+                const auto sum = sdot(K, A + i * lda, Bt.data() + j * K);
+                auto& c = C[l * ldc + j0 + j];
+                c = accumulate ? c + sum : sum;
+            }
+        });
+    }
+}
+
+}  // namespace
+
+float sdot(const uint32_t K, const float* A, const float* B) {
+    // independent partial sums let the compiler vectorize the loop without relaxed floating point semantics
+    float partial[kDotLanes] = {};
+    uint32_t k = 0;
+    for (; k + kDotLanes <= K; k += kDotLanes) {
+        for (uint32_t lane = 0; lane < kDotLanes; lane++) {
+            partial[lane] += A[k + lane] * B[k + lane];
+        }
+    }
+    float sum = 0.0f;
+    for (uint32_t lane = 0; lane < kDotLanes; lane++) {
+        sum += partial[lane];
+    }
+    for (; k < K; k++) {
+        sum += A[k] * B[k];
+    }
+    return sum;
+}
 
 #ifdef _NO_MKL_
 void cblas_sgemm1(const CBLAS_LAYOUT Layout,
@@ -32,15 +104,17 @@ void cblas_sgemm1(const CBLAS_LAYOUT Layout,
     }
 
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
-        for (i = 0; i < M; i++) {
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[i * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
-                }
-                C[i * ldc + j] = sum;
-            }
-        }
+        sgemm_rows(static_cast<uint32_t>(N),
+                   static_cast<uint32_t>(K),
+                   A,
+                   static_cast<uint32_t>(lda),
+                   B,
+                   static_cast<uint32_t>(ldb),
+                   beta == 1.0,
+                   C,
+                   static_cast<uint32_t>(ldc),
+                   nullptr,
+                   static_cast<uint32_t>(M));
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
         for (i = 0; i < M; i++) {
             for (j = 0; j < N; j++) {
@@ -128,16 +202,17 @@ void cblas_sgemm_subset(const CBLAS_LAYOUT Layout,
     }
 
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
-        for (l = 0; l < L; l++) {
-            i = OutputList[l];
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[l * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
-                }
-                C[l * ldc + j] = sum;
-            }
-        }
+        sgemm_rows(static_cast<uint32_t>(N),
+                   static_cast<uint32_t>(K),
+                   A,
+                   static_cast<uint32_t>(lda),
+                   B,
+                   static_cast<uint32_t>(ldb),
+                   beta == 1.0,
+                   C,
+                   static_cast<uint32_t>(ldc),
+                   OutputList,
+                   static_cast<uint32_t>(L));
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
         for (i = 0; i < M; i++) {
             for (l = 0; l < L; l++) {
@@ -176,18 +251,10 @@ void sgemv_split(const uint32_t N,
                  const float* X,
                  const float* B,
                  float* C) {
-    uint32_t num_columns = K1 + K2;
-    uint32_t num_rows = N;
-    uint32_t i, j;
-
-    for (i = 0; i < num_rows; i++) {
-        float sum = B[i];
-        for (j = 0; j < K1; j++) {
-            sum += A1[j] * X[i * num_columns + j];
-        }
-        for (j = K1; j < num_columns; j++) {
-            sum += A2[j - K1] * X[i * num_columns + j];
-        }
-        C[i] = sum;
-    }
+    const uint32_t num_columns = K1 + K2;
+
+    ov::parallel_for(N, [&](uint32_t i) {
+        const float* row = X + i * num_columns;
+        C[i] = B[i] + sdot(K1, A1, row) + sdot(K2, A2, row + K1);
+    });
 }
@@ -74,6 +74,10 @@ void cblas_sgemm_subset(const CBLAS_LAYOUT Layout,
                         const MKL_INT ldc,
                         const uint32_t* OutputList,
                         const MKL_INT L);
+/**
+ * @brief Dot product of two float vectors of length K
+ */
+float sdot(const uint32_t K, const float* A, const float* B);
 void sgemv_split(const uint32_t N,
                  const uint32_t K1,
                  const uint32_t K2,
@@ -11,6 +11,7 @@
 #include <vector>
 
 #include "frontend/quantization.hpp"
+#include "openvino/core/parallel.hpp"
 
 #ifdef _NO_MKL_
 #    include <cmath>
@@ -402,149 +403,133 @@ void PwlApply32(intel_dnn_component_t* component, uint32_t num_subset_size) {
     }
 }
 
+namespace {
+
+// Number of columns processed by a single task, so a long row is still split between threads
+constexpr uint32_t kPwlColumnsBlock = 1024;
+
+// Computes out = f(row, in) for rows and columns in the inclusive ranges,
+// the inner loop goes over contiguous columns so it can be vectorized by the compiler
+template <typename F>
+void PwlApplyRows(intel_dnn_component_t* component,
+                  const uint32_t num_row_start,
+                  const uint32_t num_row_end,
+                  const uint32_t num_col_start,
+                  const uint32_t num_col_end,
+                  const F& f) {
+    const float* ptr_in = reinterpret_cast<float*>(component->ptr_inputs);
+    float* ptr_out = reinterpret_cast<float*>(component->ptr_outputs);
+    const uint32_t num_columns = component->num_columns_in;
+    const uint32_t num_rows = num_row_end - num_row_start + 1;
+    const uint32_t num_blocks = (num_col_end - num_col_start + kPwlColumnsBlock) / kPwlColumnsBlock;
+    ov::parallel_for2d(num_rows, num_blocks, [&](uint32_t r, uint32_t b) {
+        const uint32_t i = num_row_start + r;
+        const uint32_t col_begin = num_col_start + b * kPwlColumnsBlock;
+        const uint32_t col_end = (std::min)(num_col_end + 1, col_begin + kPwlColumnsBlock);
+        const float* in = ptr_in + i * num_columns;
+        float* out = ptr_out + i * num_columns;
+        for (uint32_t j = col_begin; j < col_end; j++) {
+            out[j] = f(i, in[j]);
+        }
+    });
+}
+
+}  // namespace
+
 void PwlApply32(intel_dnn_component_t* component,
                 uint32_t num_row_start,
                 uint32_t num_row_end,
                 uint32_t num_col_start,
                 uint32_t num_col_end) {
     intel_piecewiselinear_t* transform = reinterpret_cast<intel_piecewiselinear_t*>(&component->op.pwl);
-    float* ptr_in = reinterpret_cast<float*>(component->ptr_inputs);
-    float* ptr_out = reinterpret_cast<float*>(component->ptr_outputs);
-    uint32_t num_columns = component->num_columns_in;
     switch (transform->func_id.type) {
     case kActSigmoid:
-        for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-            for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                ptr_out[i * num_columns + j] = 0.5f * (1.0f + tanh(0.5f * ptr_in[i * num_columns + j]));
-            }
-        }
+        PwlApplyRows(component, num_row_start, num_row_end, num_col_start, num_col_end, [](uint32_t, float x) {
+            return 0.5f * (1.0f + tanh(0.5f * x));
+        });
         break;
     case kActTanh:
-        for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-            for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                ptr_out[i * num_columns + j] = tanh(ptr_in[i * num_columns + j]);
-            }
-        }
+        PwlApplyRows(component, num_row_start, num_row_end, num_col_start, num_col_end, [](uint32_t, float x) {
+            return tanh(x);
+        });
         break;
     case kActSoftSign:
-        for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-            for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                ptr_out[i * num_columns + j] =
-                    static_cast<float>(ptr_in[i * num_columns + j] / (1.0 + fabs(ptr_in[i * num_columns + j])));
-            }
-        }
+        PwlApplyRows(component, num_row_start, num_row_end, num_col_start, num_col_end, [](uint32_t, float x) {
+            return static_cast<float>(x / (1.0 + fabs(x)));
+        });
         break;
-    case kActRelu:
-        for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-            for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                ptr_out[i * num_columns + j] =
-                    (ptr_in[i * num_columns + j] < 0.0f)
-                        ? ptr_in[i * num_columns + j] * transform->func_id.args.lrelu.negative_slope
-                        : ptr_in[i * num_columns + j];
-            }
-        }
+    case kActRelu: {
+        const float negative_slope = transform->func_id.args.lrelu.negative_slope;
+        PwlApplyRows(component, num_row_start, num_row_end, num_col_start, num_col_end, [=](uint32_t, float x) {
+            return x < 0.0f ? x * negative_slope : x;
+        });
         break;
+    }
     case kActIdentity:
-        for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-            for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                ptr_out[i * num_columns + j] = ptr_in[i * num_columns + j];
-            }
-        }
+        PwlApplyRows(component, num_row_start, num_row_end, num_col_start, num_col_end, [](uint32_t, float x) {
+            return x;
+        });
         break;
     case kActKaldiLstmClipping: {
-        float upper_limit = component->op.pwl.func_id.args.clamp.high;
-        float lower_limit = component->op.pwl.func_id.args.clamp.low;
-        for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-            for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                float val = ptr_in[i * num_columns + j];
-                if (val > upper_limit) {
-                    ptr_out[i * num_columns + j] = upper_limit;
-                } else if (val < lower_limit) {
-                    ptr_out[i * num_columns + j] = lower_limit;
-                } else {
-                    ptr_out[i * num_columns + j] = val;
-                }
-            }
-        }
+        const float upper_limit = component->op.pwl.func_id.args.clamp.high;
+        const float lower_limit = component->op.pwl.func_id.args.clamp.low;
+        PwlApplyRows(component, num_row_start, num_row_end, num_col_start, num_col_end, [=](uint32_t, float x) {
+            return x > upper_limit ? upper_limit : (x < lower_limit ? lower_limit : x);
+        });
         break;
     }
     case kActExp:
-        for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-            for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                ptr_out[i * num_columns + j] = exp(ptr_in[i * num_columns + j]);
-            }
-        }
+        PwlApplyRows(component, num_row_start, num_row_end, num_col_start, num_col_end, [](uint32_t, float x) {
+            return exp(x);
+        });
         break;
     case kActLog:
-        for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-            for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                ptr_out[i * num_columns + j] = std::log(ptr_in[i * num_columns + j]);
-            }
-        }
+        PwlApplyRows(component, num_row_start, num_row_end, num_col_start, num_col_end, [](uint32_t, float x) {
+            return std::log(x);
+        });
         break;
     case kActAbs:
-        for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-            for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                ptr_out[i * num_columns + j] = fabs(ptr_in[i * num_columns + j]);
-            }
-        }
+        PwlApplyRows(component, num_row_start, num_row_end, num_col_start, num_col_end, [](uint32_t, float x) {
+            return fabs(x);
+        });
         break;
     case kActSign:
-        for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-            for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                ptr_out[i * num_columns + j] =
-                    (ptr_in[i * num_columns + j] == 0.f) ? 0.0f : ((ptr_in[i * num_columns + j] > 0) ? 1.0f : -1.0f);
-            }
-        }
+        PwlApplyRows(component, num_row_start, num_row_end, num_col_start, num_col_end, [](uint32_t, float x) {
+            return (x == 0.f) ? 0.0f : ((x > 0) ? 1.0f : -1.0f);
+        });
         break;
     case kActNegLog:
-        for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-            for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                ptr_out[i * num_columns + j] = static_cast<float>(-1.0 * std::log(ptr_in[i * num_columns + j]));
-            }
-        }
+        PwlApplyRows(component, num_row_start, num_row_end, num_col_start, num_col_end, [](uint32_t, float x) {
+            return static_cast<float>(-1.0 * std::log(x));
+        });
         break;
     case kActNegHalfLog:
-        for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-            for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                ptr_out[i * num_columns + j] = static_cast<float>(-0.5 * std::log(ptr_in[i * num_columns + j]));
-            }
-        }
+        PwlApplyRows(component, num_row_start, num_row_end, num_col_start, num_col_end, [](uint32_t, float x) {
+            return static_cast<float>(-0.5 * std::log(x));
+        });
         break;
     case kActPow: {
-        float exponent = transform->func_id.args.pow.exponent;
-        float scale = transform->func_id.args.pow.scale;
-        float offset = transform->func_id.args.pow.offset;
-        for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-            for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                ptr_out[i * num_columns + j] =
-                    static_cast<float>(pow(offset + scale * ptr_in[i * num_columns + j], exponent));
-            }
-        }
-    } break;
+        const float exponent = transform->func_id.args.pow.exponent;
+        const float scale = transform->func_id.args.pow.scale;
+        const float offset = transform->func_id.args.pow.offset;
+        PwlApplyRows(component, num_row_start, num_row_end, num_col_start, num_col_end, [=](uint32_t, float x) {
+            return static_cast<float>(pow(offset + scale * x, exponent));
+        });
+        break;
+    }
     case kActFakeQuantize: {
-        auto levels = static_cast<uint32_t>(transform->func_id.fqParams.levels);
-
-        for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-            auto inputChannel = transform->func_id.fqParams.inputPerChannel ? i : 0;
-            auto outputChannel = transform->func_id.fqParams.outputPerChannel ? i : 0;
-
-            float input_low = transform->func_id.fqParams.input_low[inputChannel];
-            float input_high = transform->func_id.fqParams.input_high[inputChannel];
-            float output_low = transform->func_id.fqParams.output_low[outputChannel];
-            float output_high = transform->func_id.fqParams.output_high[outputChannel];
-
-            for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                auto offset = i * num_columns + j;
-
-                ptr_out[offset] = ov::intel_gna::frontend::ApplyFQ(ptr_in[offset],
-                                                                   input_low,
-                                                                   input_high,
-                                                                   output_low,
-                                                                   output_high,
-                                                                   levels);
-            }
-        }
+        const auto& fqParams = transform->func_id.fqParams;
+        const auto levels = static_cast<uint32_t>(fqParams.levels);
+        PwlApplyRows(component, num_row_start, num_row_end, num_col_start, num_col_end, [&](uint32_t i, float x) {
+            const auto inputChannel = fqParams.inputPerChannel ? i : 0;
+            const auto outputChannel = fqParams.outputPerChannel ? i : 0;
+            return ov::intel_gna::frontend::ApplyFQ(x,
+                                                    fqParams.input_low[inputChannel],
+                                                    fqParams.input_high[inputChannel],
+                                                    fqParams.output_low[outputChannel],
+                                                    fqParams.output_high[outputChannel],
+                                                    levels);
+        });
         break;
     }
     case kActCustom:
@@ -0,0 +1,294 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+// to suppress deprecated definition errors
+#define IMPLEMENT_INFERENCE_ENGINE_PLUGIN
+#include "backend/gna_limitations.hpp"
+#include "runtime/cnn.h"
+#include "runtime/floatmath.h"
+#include "runtime/pwl.h"
+
+using namespace ov::intel_gna::limitations;
+
+namespace {
+
+std::vector<float> RandomData(size_t size, std::mt19937& generator) {
+    std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+    std::vector<float> data(size);
+    for (auto& value : data) {
+        value = distribution(generator);
+    }
+    return data;
+}
+
+TEST(GnaFloatRuntimeKernelsTest, sgemmMatchesReference) {
+    std::mt19937 generator(1);
+    for (uint32_t m : {1, 13, 64}) {
+        for (uint32_t n : {1, 4, 11}) {
+            for (uint32_t k : {3, 8, 100}) {
+                const auto A = RandomData(m * k, generator);
+                const auto B = RandomData(k * n, generator);
+                auto C = RandomData(m * n, generator);
+                auto expected = C;
+                for (uint32_t i = 0; i < m; i++) {
+                    for (uint32_t j = 0; j < n; j++) {
+                        for (uint32_t l = 0; l < k; l++) {
+                            expected[i * n + j] += A[i * k + l] * B[l * n + j];
+                        }
+                    }
+                }
+
+                cblas_sgemm1(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k, 1.0, A.data(), k, B.data(), n, 1.0,
+                             C.data(), n);
+
+                for (size_t i = 0; i < C.size(); i++) {
+                    ASSERT_NEAR(C[i], expected[i], 1e-4f) << "m=" << m << " n=" << n << " k=" << k;
+                }
+            }
+        }
+    }
+}
+
+TEST(GnaFloatRuntimeKernelsTest, sgemmSubsetMatchesReference) {
+    std::mt19937 generator(2);
+    const uint32_t m = 20, n = 3, k = 37;
+    const std::vector<uint32_t> rows = {19, 0, 7};
+    const auto A = RandomData(m * k, generator);
+    const auto B = RandomData(k * n, generator);
+    std::vector<float> C(rows.size() * n, 0.0f);
+
+    cblas_sgemm_subset(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k, 1.0, A.data(), k, B.data(), n, 1.0,
+                       C.data(), n, rows.data(), static_cast<MKL_INT>(rows.size()));
+
+    for (size_t l = 0; l < rows.size(); l++) {
+        for (uint32_t j = 0; j < n; j++) {
+            float expected = 0.0f;
+            for (uint32_t i = 0; i < k; i++) {
+                expected += A[rows[l] * k + i] * B[i * n + j];
+            }
+            ASSERT_NEAR(C[l * n + j], expected, 1e-4f);
+        }
+    }
+}
+
+TEST(GnaFloatRuntimeKernelsTest, convolution2DWithPaddingMatchesReference) {
+    std::mt19937 generator(3);
+    const uint32_t IH = 7, IW = 9, IC = 5, KH = 3, KW = 2, OC = 4;
+    const uint32_t strideH = 2, strideW = 1, padH = 1, padW = 1;
+    const uint32_t OH = (IH + 2 * padH - KH) / strideH + 1;
+    const uint32_t OW = (IW + 2 * padW - KW) / strideW + 1;
+    const uint32_t kernelAlignment = Limitations::kConvEachKernelByteAlignment / sizeof(float);
+    const uint32_t kernelStride = (KH * KW * IC + kernelAlignment - 1) / kernelAlignment * kernelAlignment;
+
+    auto input = RandomData(IH * IW * IC, generator);
+    auto filters = RandomData(OC * kernelStride, generator);
+    auto biases = RandomData(OC, generator);
+    std::vector<float> output(OH * OW * OC);
+
+    intel_dnn_component_t component{};
+    component.tensors.resize(3);
+    component.tensors[0].dimensions = {1, IH, IW, IC};
+    component.tensors[1].dimensions = {1, OH, OW, OC};
+    component.tensors[2].dimensions = {OC, KH, KW, IC};
+    component.op.conv2D.convStride = {strideH, strideW};
+    component.op.conv2D.zeroPadding = {padH, padW};
+    component.op.conv2D.ptr_filters = filters.data();
+    component.op.conv2D.ptr_biases = biases.data();
+    component.ptr_inputs = input.data();
+    component.ptr_outputs = output.data();
+    component.original_layer_name = "conv";
+
+    CNN2DFilter32(&component);
+
+    for (uint32_t oh = 0; oh < OH; oh++) {
+        for (uint32_t ow = 0; ow < OW; ow++) {
+            for (uint32_t oc = 0; oc < OC; oc++) {
+                float expected = biases[oc];
+                for (uint32_t kh = 0; kh < KH; kh++) {
+                    for (uint32_t kw = 0; kw < KW; kw++) {
+                        const int ih = static_cast<int>(oh * strideH + kh) - static_cast<int>(padH);
+                        const int iw = static_cast<int>(ow * strideW + kw) - static_cast<int>(padW);
+                        if (ih < 0 || iw < 0 || ih >= static_cast<int>(IH) || iw >= static_cast<int>(IW)) {
+                            continue;
+                        }
+                        for (uint32_t c = 0; c < IC; c++) {
+                            expected += input[(ih * IW + iw) * IC + c] *
+                                        filters[oc * kernelStride + (kh * KW + kw) * IC + c];
+                        }
+                    }
+                }
+                ASSERT_NEAR(output[(oh * OW + ow) * OC + oc], expected, 1e-4f);
+            }
+        }
+    }
+}
+
+TEST(GnaFloatRuntimeKernelsTest, sgemvSplitMatchesReference) {
+    std::mt19937 generator(4);
+    for (uint32_t n : {1, 6, 31}) {
+        for (uint32_t k1 : {1, 7, 16}) {
+            for (uint32_t k2 : {0, 5, 33}) {
+                const auto A1 = RandomData(k1, generator);
+                const auto A2 = RandomData(k2, generator);
+                const auto X = RandomData(n * (k1 + k2), generator);
+                const auto B = RandomData(n, generator);
+                std::vector<float> C(n);
+
+                sgemv_split(n, k1, k2, A1.data(), A2.data(), X.data(), B.data(), C.data());
+
+                for (uint32_t i = 0; i < n; i++) {
+                    float expected = B[i];
+                    for (uint32_t j = 0; j < k1; j++) {
+                        expected += A1[j] * X[i * (k1 + k2) + j];
+                    }
+                    for (uint32_t j = 0; j < k2; j++) {
+                        expected += A2[j] * X[i * (k1 + k2) + k1 + j];
+                    }
+                    ASSERT_NEAR(C[i], expected, 1e-4f) << "n=" << n << " k1=" << k1 << " k2=" << k2;
+                }
+            }
+        }
+    }
+}
+
+TEST(GnaFloatRuntimeKernelsTest, convolution1DMatchesReference) {
+    std::mt19937 generator(5);
+    // the last inputs do not fill a whole window, so they produce no outputs
+    const uint32_t numberOfInputs = 50, filterSize = 8, stride = 3, numberOfFilters = 5;
+    const uint32_t numberOfOutputsPerFilter = (numberOfInputs - filterSize) / stride + 1;
+    const uint32_t numberOfSpareOutputs = 7;
+    const float sentinel = 42.0f;
+
+    auto input = RandomData(numberOfInputs, generator);
+    auto filters = RandomData(numberOfFilters * filterSize, generator);
+    auto biases = RandomData(numberOfFilters, generator);
+    std::vector<float> output(numberOfOutputsPerFilter * numberOfFilters + numberOfSpareOutputs, sentinel);
+
+    intel_dnn_component_t component{};
+    component.num_rows_in = 1;
+    component.num_rows_out = 1;
+    component.num_columns_in = numberOfInputs;
+    component.num_columns_out = static_cast<uint32_t>(output.size());
+    component.op.conv1D.convStride = stride;
+    component.op.conv1D.num_filter_coefficients = filterSize;
+    component.op.conv1D.num_filters = numberOfFilters;
+    component.op.conv1D.ptr_filters = filters.data();
+    component.op.conv1D.ptr_biases = biases.data();
+    component.ptr_inputs = input.data();
+    component.ptr_outputs = output.data();
+    component.original_layer_name = "conv1d";
+
+    CNNFilter32(&component);
+
+    for (uint32_t j = 0; j < numberOfOutputsPerFilter; j++) {
+        for (uint32_t i = 0; i < numberOfFilters; i++) {
+            float expected = biases[i];
+            for (uint32_t k = 0; k < filterSize; k++) {
+                expected += input[j * stride + k] * filters[i * filterSize + k];
+            }
+            ASSERT_NEAR(output[j * numberOfFilters + i], expected, 1e-4f) << "output=" << j << " filter=" << i;
+        }
+    }
+    for (size_t i = numberOfOutputsPerFilter * numberOfFilters; i < output.size(); i++) {
+        ASSERT_EQ(output[i], sentinel) << "output " << i << " is out of the convolution range";
+    }
+}
+
+TEST(GnaFloatRuntimeKernelsTest, convolution1DClippedByPaddingMatchesReference) {
+    std::mt19937 generator(6);
+    // padding is as wide as the filter, so the first window lies in the padding only
+    // and the last one overlaps a single input
+    const uint32_t IW = 6, IC = 3, KW = 3, OC = 2, strideW = 2, padW = 3;
+    const uint32_t OW = (IW + 2 * padW - KW) / strideW + 1;
+    const uint32_t kernelAlignment = Limitations::kConvEachKernelByteAlignment / sizeof(float);
+    const uint32_t kernelStride = (KW * IC + kernelAlignment - 1) / kernelAlignment * kernelAlignment;
+
+    auto input = RandomData(IW * IC, generator);
+    auto filters = RandomData(OC * kernelStride, generator);
+    auto biases = RandomData(OC, generator);
+    std::vector<float> output(OW * OC);
+
+    intel_dnn_component_t component{};
+    component.tensors.resize(3);
+    component.tensors[0].dimensions = {1, 1, IW, IC};
+    component.tensors[1].dimensions = {1, 1, OW, OC};
+    component.tensors[2].dimensions = {OC, 1, KW, IC};
+    component.op.conv2D.convStride = {1, strideW};
+    component.op.conv2D.zeroPadding = {0, padW};
+    component.op.conv2D.ptr_filters = filters.data();
+    component.op.conv2D.ptr_biases = biases.data();
+    component.ptr_inputs = input.data();
+    component.ptr_outputs = output.data();
+    component.original_layer_name = "conv1d_padded";
+
+    CNN2DFilter32(&component);
+
+    for (uint32_t ow = 0; ow < OW; ow++) {
+        for (uint32_t oc = 0; oc < OC; oc++) {
+            float expected = biases[oc];
+            for (uint32_t kw = 0; kw < KW; kw++) {
+                const int iw = static_cast<int>(ow * strideW + kw) - static_cast<int>(padW);
+                if (iw < 0 || iw >= static_cast<int>(IW)) {
+                    continue;
+                }
+                for (uint32_t c = 0; c < IC; c++) {
+                    expected += input[iw * IC + c] * filters[oc * kernelStride + kw * IC + c];
+                }
+            }
+            ASSERT_NEAR(output[ow * OC + oc], expected, 1e-4f) << "ow=" << ow << " oc=" << oc;
+        }
+    }
+    ASSERT_EQ(output[0], biases[0]);
+    ASSERT_EQ(output[1], biases[1]);
+}
+
+TEST(GnaFloatRuntimeKernelsTest, pwlApplyMatchesReference) {
+    std::mt19937 generator(7);
+    // rows are longer than a column block, so a row is split between tasks
+    const uint32_t rows = 5, columns = 2500;
+    const uint32_t rowStart = 1, rowEnd = 3, colStart = 3, colEnd = 2400;
+    const float sentinel = 42.0f;
+    const float negativeSlope = 0.1f;
+
+    auto input = RandomData(rows * columns, generator);
+    std::vector<float> output(rows * columns, sentinel);
+
+    intel_dnn_component_t component{};
+    component.num_rows_in = rows;
+    component.num_columns_in = columns;
+    component.orientation_in = kDnnNonInterleavedOrientation;
+    component.ptr_inputs = input.data();
+    component.ptr_outputs = output.data();
+    component.original_layer_name = "pwl";
+
+    component.op.pwl.func_id.type = kActRelu;
+    component.op.pwl.func_id.args.lrelu.negative_slope = negativeSlope;
+    PwlApply32(&component, rowStart, rowEnd, colStart, colEnd);
+
+    for (uint32_t i = 0; i < rows; i++) {
+        for (uint32_t j = 0; j < columns; j++) {
+            const auto index = i * columns + j;
+            if (i < rowStart || i > rowEnd || j < colStart || j > colEnd) {
+                ASSERT_EQ(output[index], sentinel) << "row=" << i << " column=" << j;
+            } else {
+                const float x = input[index];
+                ASSERT_EQ(output[index], x < 0.0f ? x * negativeSlope : x) << "row=" << i << " column=" << j;
+            }
+        }
+    }
+
+    component.op.pwl.func_id.type = kActSigmoid;
+    PwlApply32(&component, 0);
+
+    for (size_t i = 0; i < output.size(); i++) {
+        ASSERT_NEAR(output[i], 1.0f / (1.0f + std::exp(-input[i])), 1e-5f) << "index=" << i;
+    }
+}
+
+}  // namespace
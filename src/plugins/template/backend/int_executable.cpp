@@ -4,14 +4,18 @@
 
 #include "int_executable.hpp"
 
+#include <algorithm>
 #include <cstring>
 #include <limits>
 #include <openvino/op/util/variable_context.hpp>
 
 #include "evaluates_map.hpp"
 #include "openvino/core/except.hpp"
+#include "openvino/core/parallel.hpp"
+#include "openvino/op/constant.hpp"
 #include "openvino/op/parameter.hpp"
 #include "openvino/op/result.hpp"
+#include "openvino/op/util/multi_subgraph_base.hpp"
 #include "openvino/op/util/op_types.hpp"
 #include "perf_counter.hpp"
 #include "tensor_conversion_util.hpp"
@@ -74,24 +78,23 @@ inline void update_output_tensors(ov::TensorVector& output_values, const ngraph:
 
 class TemporaryOverrideOutputs {
     std::shared_ptr<ov::Model> model;
-    std::unordered_map<std::shared_ptr<ov::descriptor::Tensor>, ov::PartialShape> orig_paramter_shapes_map;
+    std::vector<ov::PartialShape> orig_parameter_shapes;
 
 public:
-    TemporaryOverrideOutputs(std::shared_ptr<ov::Model>& model,
-                             const std::unordered_map<std::shared_ptr<ov::descriptor::Tensor>, ov::Tensor>& tensor_map)
+    TemporaryOverrideOutputs(std::shared_ptr<ov::Model>& model, const std::vector<ov::Tensor>& inputs)
         : model(model) {
-        for (const auto& param : model->get_parameters()) {
-            auto output_tensor = param->output(0).get_tensor_ptr();
-            orig_paramter_shapes_map.insert({output_tensor, param->get_partial_shape()});
-            param->set_partial_shape(tensor_map.at(output_tensor).get_shape());
+        const auto& params = model->get_parameters();
+        for (size_t i = 0; i < params.size(); i++) {
+            orig_parameter_shapes.push_back(params[i]->get_partial_shape());
+            params[i]->set_partial_shape(inputs[i].get_shape());
         }
         model->validate_nodes_and_infer_types();
     }
 
     ~TemporaryOverrideOutputs() {
-        for (const auto& param : model->get_parameters()) {
-            auto output_tensor = param->output(0).get_tensor_ptr();
-            param->set_partial_shape(orig_paramter_shapes_map.at(output_tensor));
+        const auto& params = model->get_parameters();
+        for (size_t i = 0; i < params.size(); i++) {
+            params[i]->set_partial_shape(orig_parameter_shapes[i]);
         }
         model->validate_nodes_and_infer_types();
     }
@@ -103,6 +106,200 @@ ov::runtime::interpreter::INTExecutable::INTExecutable(const std::shared_ptr<ov:
         m_nodes.push_back(node);
     }
     set_parameters_and_results(*m_model);
+    build_execution_plan();
+}
+
+void ov::runtime::interpreter::INTExecutable::build_execution_plan() {
+    auto& evaluators = ngraph::runtime::interpreter::get_evaluators_map();
+
+    std::unordered_map<const ov::descriptor::Tensor*, size_t> tensor_indices;
+    std::vector<std::shared_ptr<Node>> tensor_producers;
+    for (const auto& node : m_nodes) {
+        for (const auto& output : node->outputs()) {
+            tensor_indices.emplace(&output.get_tensor(), tensor_producers.size());
+            tensor_producers.push_back(node);
+        }
+    }
+    const size_t tensors_count = tensor_producers.size();
+    m_tensors.resize(tensors_count);
+
+    std::unordered_map<std::shared_ptr<ov::descriptor::Tensor>, size_t> results_map;
+    for (size_t output_count = 0; output_count < get_results().size(); ++output_count) {
+        auto output = get_results()[output_count]->output(0).get_tensor_ptr();
+        if (!results_map.count(output))
+            results_map.emplace(output, output_count);
+    }
+
+    // Stage of an operation follows the stages of its inputs, the operations with variables or bodies keep
+    // their relative order as they may share the variables
+    constexpr size_t not_evaluated = std::numeric_limits<size_t>::max();
+    std::unordered_map<const Node*, size_t> node_stages;
+    std::vector<size_t> first_stages(tensors_count, not_evaluated);
+    std::vector<size_t> last_stages(tensors_count, not_evaluated);
+    size_t next_serial_stage = 0;
+    for (const auto& node : m_nodes) {
+        if (ov::op::util::is_parameter(node)) {
+            for (const auto& output : node->outputs()) {
+                m_parameter_tensors.push_back(tensor_indices.at(&output.get_tensor()));
+            }
+            continue;
+        }
+        if (const auto constant = std::dynamic_pointer_cast<ov::op::v0::Constant>(node)) {
+            m_tensors[tensor_indices.at(&constant->output(0).get_tensor())] =
+                ov::Tensor(constant->get_element_type(),
+                           constant->get_shape(),
+                           const_cast<void*>(constant->get_data_ptr()));
+            continue;
+        }
+
+        ExecNode exec_node;
+        exec_node.node = node;
+        size_t stage = 0;
+        for (const auto& input : node->inputs()) {
+            const auto index = tensor_indices.at(&input.get_tensor());
+            exec_node.inputs.push_back(index);
+            const auto producer = node_stages.find(tensor_producers[index].get());
+            if (producer != node_stages.end()) {
+                stage = std::max(stage, producer->second + 1);
+            }
+        }
+        for (const auto& dependency : node->get_control_dependencies()) {
+            const auto producer = node_stages.find(dependency.get());
+            if (producer != node_stages.end()) {
+                stage = std::max(stage, producer->second + 1);
+            }
+        }
+        if (std::dynamic_pointer_cast<ov::op::util::VariableExtension>(node) ||
+            std::dynamic_pointer_cast<ov::op::util::MultiSubGraphOp>(node)) {
+            stage = std::max(stage, next_serial_stage);
+            next_serial_stage = stage + 1;
+        }
+        node_stages.emplace(node.get(), stage);
+
+        for (const auto& output : node->outputs()) {
+            const auto index = tensor_indices.at(&output.get_tensor());
+            exec_node.outputs.push_back(index);
+            first_stages[index] = last_stages[index] = stage;
+        }
+        if (ov::op::util::is_output(node)) {
+            exec_node.result_index = static_cast<int64_t>(results_map.at(node->output(0).get_tensor_ptr()));
+        }
+        const auto evaluator = evaluators.find(node->get_type_info());
+        if (evaluator != evaluators.end()) {
+            exec_node.evaluator = &evaluator->second;
+        }
+        for (const auto index : exec_node.inputs) {
+            last_stages[index] = last_stages[index] == not_evaluated ? stage : std::max(last_stages[index], stage);
+        }
+
+        if (m_stages.size() <= stage) {
+            m_stages.resize(stage + 1);
+        }
+        m_stages[stage].push_back(m_exec_nodes.size());
+        m_exec_nodes.push_back(std::move(exec_node));
+    }
+
+    m_stage_releases.resize(m_stages.size());
+    for (size_t index = 0; index < tensors_count; index++) {
+        if (last_stages[index] != not_evaluated) {
+            m_stage_releases[last_stages[index]].push_back(index);
+        }
+    }
+    m_use_evaluator.reset(new std::atomic<bool>[m_exec_nodes.size()]);
+    for (size_t i = 0; i < m_exec_nodes.size(); i++) {
+        m_use_evaluator[i] = false;
+    }
+
+    plan_memory(first_stages, last_stages);
+}
+
+void ov::runtime::interpreter::INTExecutable::plan_memory(const std::vector<size_t>& first_stages,
+                                                          const std::vector<size_t>& last_stages) {
+    struct Buffer {
+        size_t tensor;
+        size_t size;
+        size_t offset;
+    };
+    constexpr size_t alignment = 64;
+    std::vector<Buffer> buffers;
+    for (const auto& exec_node : m_exec_nodes) {
+        // the outputs of the model are handed over to the caller, so they own their memory
+        if (exec_node.result_index >= 0) {
+            continue;
+        }
+        for (size_t i = 0; i < exec_node.outputs.size(); i++) {
+            const auto output = exec_node.node->output(i);
+            if (output.get_partial_shape().is_dynamic() || output.get_element_type().is_dynamic()) {
+                return;
+            }
+            const auto size = (output.get_element_type().bitwidth() * ov::shape_size(output.get_shape()) + 7) / 8;
+            buffers.push_back({exec_node.outputs[i], (size + alignment - 1) / alignment * alignment, 0});
+        }
+    }
+    for (const auto& param : get_parameters()) {
+        if (param->get_output_partial_shape(0).is_dynamic()) {
+            return;
+        }
+    }
+
+    // Greedy by size: the largest buffers are placed first at the lowest offset not used by the buffers alive at
+    // the same stages. A buffer is alive from the stage of its producer to the stage of its last consumer inclusive.
+    std::stable_sort(buffers.begin(), buffers.end(), [](const Buffer& a, const Buffer& b) {
+        return a.size > b.size;
+    });
+    size_t arena_size = 0;
+    std::vector<const Buffer*> placed;
+    for (auto& buffer : buffers) {
+        std::vector<const Buffer*> alive;
+        for (const auto other : placed) {
+            if (first_stages[other->tensor] <= last_stages[buffer.tensor] &&
+                first_stages[buffer.tensor] <= last_stages[other->tensor]) {
+                alive.push_back(other);
+            }
+        }
+        std::sort(alive.begin(), alive.end(), [](const Buffer* a, const Buffer* b) {
+            return a->offset < b->offset;
+        });
+        size_t offset = 0;
+        for (const auto other : alive) {
+            if (offset + buffer.size <= other->offset) {
+                break;
+            }
+            offset = std::max(offset, other->offset + other->size);
+        }
+        buffer.offset = offset;
+        arena_size = std::max(arena_size, offset + buffer.size);
+        placed.push_back(&buffer);
+    }
+
+    m_arena = ov::Tensor(ov::element::u8, ov::Shape{arena_size});
+    m_planned_tensors = m_tensors;
+    std::vector<size_t> offsets(m_tensors.size());
+    for (const auto& buffer : buffers) {
+        offsets[buffer.tensor] = buffer.offset;
+    }
+    for (const auto& exec_node : m_exec_nodes) {
+        if (exec_node.result_index >= 0) {
+            continue;
+        }
+        for (size_t i = 0; i < exec_node.outputs.size(); i++) {
+            const auto index = exec_node.outputs[i];
+            m_planned_tensors[index] = ov::Tensor(exec_node.node->get_output_element_type(i),
+                                                  exec_node.node->get_output_shape(i),
+                                                  static_cast<uint8_t*>(m_arena.data()) + offsets[index]);
+        }
+    }
+}
+
+bool ov::runtime::interpreter::INTExecutable::is_plan_applicable(const std::vector<ov::Tensor>& inputs) const {
+    const auto& params = get_parameters();
+    for (size_t i = 0; i < params.size(); i++) {
+        const auto& shape = params[i]->get_output_partial_shape(0);
+        if (shape.is_dynamic() || shape.to_shape() != inputs[i].get_shape()) {
+            return false;
+        }
+    }
+    return true;
 }
 
 void ov::runtime::interpreter::INTExecutable::cancel() {
@@ -142,81 +339,121 @@ bool ov::runtime::interpreter::INTExecutable::call(std::vector<ov::Tensor>& outp
     }
 
     CHECK_TERMINATE()
-    // map function params -> ov::Tensor
-    std::unordered_map<std::shared_ptr<ov::descriptor::Tensor>, ov::Tensor> tensor_map;
-    size_t input_count = 0;
-    for (const auto& param : get_parameters()) {
-        for (size_t i = 0; i < param->get_output_size(); ++i) {
-            auto tensor = param->output(i).get_tensor_ptr();
-            tensor_map.insert({tensor, inputs[input_count++]});
-        }
+    // the shapes are propagated from the inputs only if they differ from the shapes of the model
+    std::unique_ptr<TemporaryOverrideOutputs> overrider;
+    const bool static_shapes = is_plan_applicable(inputs);
+    if (!static_shapes) {
+        overrider.reset(new TemporaryOverrideOutputs(m_model, inputs));
     }
 
-    std::unordered_map<std::shared_ptr<ov::descriptor::Tensor>, size_t> results_map;
-    // map function outputs -> ov::Tensor
-    for (size_t output_count = 0; output_count < get_results().size(); ++output_count) {
-        auto output = get_results()[output_count]->output(0).get_tensor_ptr();
-        if (!results_map.count(output))
-            results_map.emplace(output, output_count);
+    // the planned buffers are taken by one call at a time, a concurrent call allocates its own tensors
+    std::unique_lock<std::mutex> arena_lock(m_arena_mutex, std::defer_lock);
+    const bool use_plan = static_shapes && !m_planned_tensors.empty() && arena_lock.try_lock();
+    auto tensors = use_plan ? m_planned_tensors : m_tensors;
+    for (size_t i = 0; i < m_parameter_tensors.size(); i++) {
+        tensors[m_parameter_tensors[i]] = inputs[i];
     }
 
-    auto overrider = TemporaryOverrideOutputs(m_model, tensor_map);
-
-    // for each ordered op in the graph
-    for (const auto& op : m_nodes) {
+    for (size_t stage = 0; stage < m_stages.size(); stage++) {
         CHECK_TERMINATE()
-        if (std::dynamic_pointer_cast<ov::op::v0::Parameter>(op)) {
-            continue;
+        const auto& exec_indices = m_stages[stage];
+        if (exec_indices.size() == 1) {
+            evaluate(exec_indices[0], tensors, outputs, use_plan, context, collect_performance);
+        } else {
+            std::exception_ptr exception;
+            std::mutex exception_mutex;
+            ov::parallel_for(exec_indices.size(), [&](size_t i) {
+                try {
+                    evaluate(exec_indices[i], tensors, outputs, use_plan, context, collect_performance);
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(exception_mutex);
+                    if (!exception) {
+                        exception = std::current_exception();
+                    }
+                }
+            });
+            if (exception) {
+                std::rethrow_exception(exception);
+            }
         }
-        // get op inputs from map
-        std::vector<ov::Tensor> op_inputs;
-        for (auto input : op->inputs()) {
-            auto tensor = input.get_tensor_ptr();
-            op_inputs.push_back(tensor_map.at(tensor));
+        if (!use_plan) {
+            for (const auto index : m_stage_releases[stage]) {
+                tensors[index] = {};
+            }
         }
+    }
 
-        // get op outputs from map or create
-        std::vector<ov::Tensor> op_outputs;
-        for (size_t i = 0; i < op->get_output_size(); ++i) {
-            auto tensor = op->output(i).get_tensor_ptr();
-            ov::Tensor host_tensor;
-            auto it = tensor_map.find(tensor);
-            auto output = op->output(i);
-            if (op::util::is_output(op) || it == tensor_map.end() || !it->second) {
-                host_tensor = ov::Tensor(output.get_element_type(),
-                                         output.get_partial_shape().is_dynamic()
-                                             ? ov::Shape{0, std::numeric_limits<size_t>::max()}
-                                             : output.get_shape());
-            } else {
-                host_tensor = it->second;
-            }
-            op_outputs.push_back(host_tensor);
+    return true;
+}
+
+void ov::runtime::interpreter::INTExecutable::evaluate(size_t exec_index,
+                                                       std::vector<ov::Tensor>& tensors,
+                                                       std::vector<ov::Tensor>& outputs,
+                                                       bool use_plan,
+                                                       const ov::EvaluationContext& context,
+                                                       bool collect_performance) {
+    const auto& exec_node = m_exec_nodes[exec_index];
+    const auto& op = exec_node.node;
+
+    // get op inputs
+    ov::TensorVector op_inputs;
+    op_inputs.reserve(exec_node.inputs.size());
+    for (const auto index : exec_node.inputs) {
+        op_inputs.push_back(tensors[index]);
+    }
+
+    // get op outputs from the plan or create
+    ov::TensorVector op_outputs;
+    op_outputs.reserve(exec_node.outputs.size());
+    for (size_t i = 0; i < exec_node.outputs.size(); ++i) {
+        const auto output = op->output(i);
+        if (use_plan && exec_node.result_index < 0) {
+            op_outputs.push_back(tensors[exec_node.outputs[i]]);
+        } else if (exec_node.result_index >= 0 && outputs[exec_node.result_index] &&
+                   output.get_partial_shape().is_static() &&
+                   outputs[exec_node.result_index].get_shape() == output.get_shape() &&
+                   outputs[exec_node.result_index].get_element_type() == output.get_element_type()) {
+            // Result writes to the output of the caller directly
+            op_outputs.push_back(outputs[exec_node.result_index]);
+        } else {
+            op_outputs.emplace_back(output.get_element_type(),
+                                    output.get_partial_shape().is_dynamic()
+                                        ? ov::Shape{0, std::numeric_limits<size_t>::max()}
+                                        : output.get_shape());
+        }
+    }
+
+    {
+        PERF(op, collect_performance);
+        // Call evaluate for cloned_node with static shapes
+        auto& use_evaluator = m_use_evaluator[exec_index];
+        if (use_evaluator || !op->evaluate(op_outputs, op_inputs, context)) {
+            // TODO: extend evaluate map for the context
+            use_evaluator = exec_node.evaluator != nullptr;
+            evaluate_node(exec_node, op_outputs, op_inputs);
         }
+    }
 
-        {
-            PERF(op, collect_performance);
-            // Call evaluate for cloned_node with static shapes
-            if (!op->evaluate(op_outputs, op_inputs, context)) {
-                // TODO: extend evaluate map for the context
-                evaluate_node(op, op_outputs, op_inputs);
+    // Update tensors
+    for (size_t i = 0; i < exec_node.outputs.size(); ++i) {
+        auto& tensor = tensors[exec_node.outputs[i]];
+        if (use_plan && exec_node.result_index < 0) {
+            // the operation replaced the planned tensor, the consumers expect the data in the plan
+            if (op_outputs[i].data() != tensor.data()) {
+                op_outputs[i].copy_to(tensor);
             }
+        } else {
+            tensor = op_outputs[i];
         }
-        // Update tensors in tensor map
-        for (size_t i = 0; i < op->get_output_size(); ++i) {
-            auto tensor = op->output(i).get_tensor_ptr();
-            tensor_map.insert({tensor, op_outputs[i]});
-            if (op::util::is_output(op)) {
-                auto& output = outputs[results_map[tensor]];
-                if (!output || output.get_shape() != op_outputs[i].get_shape()) {
-                    outputs[results_map[tensor]] = op_outputs[i];
-                } else {
-                    op_outputs[i].copy_to(output);
-                }
+        if (exec_node.result_index >= 0) {
+            auto& output = outputs[exec_node.result_index];
+            if (!output || output.get_shape() != op_outputs[i].get_shape()) {
+                output = op_outputs[i];
+            } else if (output.data() != op_outputs[i].data()) {
+                op_outputs[i].copy_to(output);
             }
         }
     }
-
-    return true;
 }
 
 std::shared_ptr<ov::op::v0::Parameter> ov::runtime::interpreter::INTExecutable::get_parameter(size_t index) const {
@@ -264,18 +501,16 @@ std::vector<ov::Tensor> ov::runtime::interpreter::INTExecutable::create_output_t
     return tensors;
 }
 
-bool ov::runtime::interpreter::INTExecutable::evaluate_node(const std::shared_ptr<Node>& node,
+bool ov::runtime::interpreter::INTExecutable::evaluate_node(const ExecNode& exec_node,
                                                             ov::TensorVector& outputs,
                                                             const ov::TensorVector& inputs) const {
-    auto& map = ngraph::runtime::interpreter::get_evaluators_map();
-    auto it = map.find(node->get_type_info());
-    bool res = false;
-    const auto tensor_inputs = create_tmp_tensors(inputs);
-    auto tensor_outputs = create_tmp_tensors(outputs);
-    OPENVINO_ASSERT(it != map.end(),
+    const auto& node = exec_node.node;
+    OPENVINO_ASSERT(exec_node.evaluator,
                     "Interpreter backend doesn't implement evaluate method for OP ",
                     node->get_type_info().name);
-    res = it->second(node, tensor_outputs, tensor_inputs);
+    const auto tensor_inputs = create_tmp_tensors(inputs);
+    auto tensor_outputs = create_tmp_tensors(outputs);
+    const auto res = (*exec_node.evaluator)(node, tensor_outputs, tensor_inputs);
     OPENVINO_ASSERT(res, "Running evaluate method for OP ", node->get_type_info().name, " failed!");
     update_output_tensors(outputs, tensor_outputs);
     return res;
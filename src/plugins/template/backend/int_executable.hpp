@@ -4,14 +4,17 @@
 
 #pragma once
 
+#include <atomic>
 #include <initializer_list>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <vector>
 
 #include "backend.hpp"
+#include "evaluates_map.hpp"
 #include "openvino/core/model.hpp"
 #include "openvino/op/non_max_suppression.hpp"
 #include "openvino/op/parameter.hpp"
@@ -49,17 +52,53 @@ public:
     std::shared_ptr<ov::Model> get_model() const override;
 
 protected:
+    // Operation of the model with its inputs and outputs resolved to the indices of the tensors of a call
+    struct ExecNode {
+        std::shared_ptr<Node> node;
+        std::vector<size_t> inputs;
+        std::vector<size_t> outputs;
+        // evaluator of the backend, nullptr if the backend doesn't implement the operation
+        const ngraph::runtime::interpreter::EvaluatorsMap::mapped_type* evaluator = nullptr;
+        // index of the model output for Result
+        int64_t result_index = -1;
+    };
+
     std::shared_ptr<ov::op::v0::Parameter> get_parameter(size_t index) const;
     std::shared_ptr<ov::op::v0::Result> get_result(size_t index) const;
-    bool evaluate_node(const std::shared_ptr<Node>& node,
-                       ov::TensorVector& outputs,
-                       const ov::TensorVector& inputs) const;
+    bool evaluate_node(const ExecNode& exec_node, ov::TensorVector& outputs, const ov::TensorVector& inputs) const;
+    void build_execution_plan();
+    void plan_memory(const std::vector<size_t>& first_stages, const std::vector<size_t>& last_stages);
+    bool is_plan_applicable(const std::vector<ov::Tensor>& inputs) const;
+    void evaluate(size_t exec_index,
+                  std::vector<ov::Tensor>& tensors,
+                  std::vector<ov::Tensor>& outputs,
+                  bool use_plan,
+                  const ov::EvaluationContext& context,
+                  bool collect_performance);
     bool m_is_compiled = false;
     std::shared_ptr<ov::Model> m_model;
     std::vector<std::shared_ptr<Node>> m_nodes;
     std::atomic_bool m_cancel_execution{false};
     std::mutex m_mutex;
 
+    // Operations to evaluate in topological order, Parameters and Constants are bound to tensors instead
+    std::vector<ExecNode> m_exec_nodes;
+    // Indices of the tensors of the Parameters in the order of the inputs
+    std::vector<size_t> m_parameter_tensors;
+    // Each stage holds operations independent of each other, the stages are evaluated one by one
+    std::vector<std::vector<size_t>> m_stages;
+    // Tensors which aren't used after the stage
+    std::vector<std::vector<size_t>> m_stage_releases;
+    // Set once op->evaluate() refused the operation, then the backend evaluator is called directly
+    std::unique_ptr<std::atomic<bool>[]> m_use_evaluator;
+    // Tensors bound before the call: Constants and, for static models, views into the memory arena
+    std::vector<ov::Tensor> m_tensors;
+    // Tensors with the arena views, empty if the model has dynamic shapes
+    std::vector<ov::Tensor> m_planned_tensors;
+    ov::Tensor m_arena;
+    // The arena is used by one call at a time
+    std::mutex m_arena_mutex;
+
     struct InfoForNMS5 {
         int64_t max_output_boxes_per_class;
         float iou_threshold;
@@ -0,0 +1,131 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "base_reference_test.hpp"
+#include "openvino/opsets/opset13.hpp"
+
+using namespace ov;
+
+namespace reference_tests {
+namespace {
+
+struct SamplingParams {
+    SamplingParams(const reference_tests::Tensor& paramLogits,
+                   float paramTemperature,
+                   int64_t paramTopK,
+                   float paramTopP,
+                   int64_t paramGlobalSeed,
+                   int64_t paramOpSeed,
+                   const reference_tests::Tensor& paramExpected,
+                   const std::string& test_name)
+        : logits(paramLogits),
+          temperature(paramTemperature),
+          top_k(paramTopK),
+          top_p(paramTopP),
+          global_seed(paramGlobalSeed),
+          op_seed(paramOpSeed),
+          expected(paramExpected),
+          test_case_name(test_name) {}
+    reference_tests::Tensor logits;
+    float temperature;
+    int64_t top_k;
+    float top_p;
+    int64_t global_seed;
+    int64_t op_seed;
+    reference_tests::Tensor expected;
+    std::string test_case_name;
+};
+
+class ReferenceSamplingLayerTest : public testing::TestWithParam<SamplingParams>, public CommonReferenceTest {
+public:
+    void SetUp() override {
+        auto params = GetParam();
+        function = CreateFunction(params);
+        inputData = {params.logits.data};
+        refOutData = {params.expected.data};
+    }
+    static std::string getTestCaseName(const testing::TestParamInfo<SamplingParams>& obj) {
+        auto param = obj.param;
+        return param.test_case_name;
+    }
+
+private:
+    static std::shared_ptr<Model> CreateFunction(const SamplingParams& params) {
+        const auto logits = std::make_shared<opset13::Parameter>(params.logits.type, params.logits.shape);
+        const auto sampling = std::make_shared<opset13::Sampling>(logits,
+                                                                  params.temperature,
+                                                                  params.top_k,
+                                                                  params.top_p,
+                                                                  params.expected.type,
+                                                                  params.global_seed,
+                                                                  params.op_seed);
+        return std::make_shared<ov::Model>(NodeVector{sampling}, ParameterVector{logits});
+    }
+};
+
+TEST_P(ReferenceSamplingLayerTest, SamplingWithHardcodedRefs) {
+    Exec();
+}
+
+// the probabilities of the tokens of each row are 0.1, 0.2, 0.3, 0.4, the uniform numbers of the rows generated
+// with the seeds 150 and 10 are 0.70112360, 0.30539632, 0.93931055, 0.94560349 (see the RandomUniform tests)
+std::vector<float> logits_f32() {
+    std::vector<float> logits;
+    for (size_t row = 0; row < 4; row++) {
+        for (float p : {0.1f, 0.2f, 0.3f, 0.4f})
+            logits.push_back(std::log(p));
+    }
+    return logits;
+}
+
+template <typename T>
+std::vector<T> logits_as() {
+    const auto logits = logits_f32();
+    return std::vector<T>(logits.begin(), logits.end());
+}
+
+}  // namespace
+
+INSTANTIATE_TEST_SUITE_P(
+    smoke_Sampling_With_Hardcoded_Refs,
+    ReferenceSamplingLayerTest,
+    ::testing::Values(
+        SamplingParams(reference_tests::Tensor{{4, 4}, element::f32, logits_f32()},
+                       1.0f, 0, 1.0f, 150, 10,
+                       reference_tests::Tensor{{4, 1}, element::i64, std::vector<int64_t>{3, 2, 3, 3}},
+                       "all_tokens"),
+        SamplingParams(reference_tests::Tensor{{4, 4}, element::f32, logits_f32()},
+                       1.0f, 2, 1.0f, 150, 10,
+                       reference_tests::Tensor{{4, 1}, element::i64, std::vector<int64_t>{2, 3, 2, 2}},
+                       "top_k"),
+        SamplingParams(reference_tests::Tensor{{4, 4}, element::f32, logits_f32()},
+                       1.0f, 0, 0.5f, 150, 10,
+                       reference_tests::Tensor{{4, 1}, element::i64, std::vector<int64_t>{2, 3, 2, 2}},
+                       "top_p"),
+        SamplingParams(reference_tests::Tensor{{4, 4}, element::f32, logits_f32()},
+                       1.0f, 3, 0.6f, 150, 10,
+                       reference_tests::Tensor{{4, 1}, element::i64, std::vector<int64_t>{2, 3, 2, 2}},
+                       "top_k_top_p"),
+        SamplingParams(reference_tests::Tensor{{4, 4}, element::f32, logits_f32()},
+                       2.0f, 0, 1.0f, 150, 10,
+                       reference_tests::Tensor{{4, 1}, element::i64, std::vector<int64_t>{3, 1, 3, 3}},
+                       "temperature"),
+        SamplingParams(reference_tests::Tensor{{4, 4}, element::f32, logits_f32()},
+                       1.0f, 0, 0.01f, 150, 10,
+                       reference_tests::Tensor{{4, 1}, element::i32, std::vector<int32_t>{3, 3, 3, 3}},
+                       "greedy_top_p"),
+        SamplingParams(reference_tests::Tensor{{4, 4}, element::f16, logits_as<float16>()},
+                       1.0f, 1, 1.0f, 0, 0,
+                       reference_tests::Tensor{{4, 1}, element::i32, std::vector<int32_t>{3, 3, 3, 3}},
+                       "greedy_f16"),
+        SamplingParams(reference_tests::Tensor{{4, 4}, element::bf16, logits_as<bfloat16>()},
+                       1.0f, 1, 1.0f, 0, 0,
+                       reference_tests::Tensor{{4, 1}, element::i64, std::vector<int64_t>{3, 3, 3, 3}},
+                       "greedy_bf16")),
+    ReferenceSamplingLayerTest::getTestCaseName);
+}  // namespace reference_tests
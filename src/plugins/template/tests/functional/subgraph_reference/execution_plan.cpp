@@ -0,0 +1,106 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "functional_test_utils/ov_plugin_cache.hpp"
+#include "openvino/core/model.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/assign.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/read_value.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/op/subtract.hpp"
+#include "openvino/op/util/variable.hpp"
+
+using namespace ov;
+
+namespace {
+
+std::shared_ptr<Core> get_core() {
+    return test::utils::PluginCache::get().core("TEMPLATE");
+}
+
+Tensor make_tensor(const Shape& shape, float start) {
+    Tensor tensor(element::f32, shape);
+    auto data = tensor.data<float>();
+    for (size_t i = 0; i < tensor.get_size(); i++) {
+        data[i] = start + static_cast<float>(i) - static_cast<float>(tensor.get_size()) / 2;
+    }
+    return tensor;
+}
+
+// Independent branches are evaluated concurrently and the intermediate tensors share the planned memory,
+// the results must not depend on the previous inference
+TEST(TemplateExecutionPlan, IndependentBranchesRepeatedInfer) {
+    const Shape shape{2, 8};
+    auto param = std::make_shared<op::v0::Parameter>(element::f32, shape);
+    auto relu = std::make_shared<op::v0::Relu>(param);
+    auto twice = std::make_shared<op::v1::Multiply>(param, op::v0::Constant::create(element::f32, {}, {2.f}));
+    auto sum = std::make_shared<op::v1::Add>(relu, twice);
+    auto diff = std::make_shared<op::v1::Subtract>(sum, param);
+    auto model = std::make_shared<Model>(OutputVector{diff, relu}, ParameterVector{param});
+
+    auto request = get_core()->compile_model(model, "TEMPLATE").create_infer_request();
+    for (float start : {0.f, 100.f, -3.f}) {
+        const auto input = make_tensor(shape, start);
+        request.set_input_tensor(input);
+        request.infer();
+        const auto in = input.data<float>();
+        const auto out_diff = request.get_output_tensor(0).data<float>();
+        const auto out_relu = request.get_output_tensor(1).data<float>();
+        for (size_t i = 0; i < shape_size(shape); i++) {
+            const float expected_relu = std::max(in[i], 0.f);
+            ASSERT_EQ(out_relu[i], expected_relu);
+            ASSERT_EQ(out_diff[i], expected_relu + 2.f * in[i] - in[i]);
+        }
+    }
+}
+
+TEST(TemplateExecutionPlan, DynamicShapes) {
+    auto param = std::make_shared<op::v0::Parameter>(element::f32, PartialShape{-1, 4});
+    auto relu = std::make_shared<op::v0::Relu>(param);
+    auto add = std::make_shared<op::v1::Add>(relu, op::v0::Constant::create(element::f32, {}, {1.f}));
+    auto model = std::make_shared<Model>(OutputVector{add}, ParameterVector{param});
+
+    auto request = get_core()->compile_model(model, "TEMPLATE").create_infer_request();
+    for (size_t batch : {1, 3, 2}) {
+        const auto input = make_tensor(Shape{batch, 4}, 0.f);
+        request.set_input_tensor(input);
+        request.infer();
+        const auto output = request.get_output_tensor(0);
+        ASSERT_EQ(output.get_shape(), (Shape{batch, 4}));
+        for (size_t i = 0; i < output.get_size(); i++) {
+            ASSERT_EQ(output.data<float>()[i], std::max(input.data<float>()[i], 0.f) + 1.f);
+        }
+    }
+}
+
+TEST(TemplateExecutionPlan, StatefulModel) {
+    const Shape shape{1, 4};
+    auto variable = std::make_shared<op::util::Variable>(op::util::VariableInfo{shape, element::f32, "state"});
+    auto param = std::make_shared<op::v0::Parameter>(element::f32, shape);
+    auto read = std::make_shared<op::v6::ReadValue>(op::v0::Constant::create(element::f32, shape, {0.f}), variable);
+    auto add = std::make_shared<op::v1::Add>(param, read);
+    auto assign = std::make_shared<op::v6::Assign>(add, variable);
+    auto model = std::make_shared<Model>(ResultVector{std::make_shared<op::v0::Result>(add)},
+                                         SinkVector{assign},
+                                         ParameterVector{param});
+
+    auto request = get_core()->compile_model(model, "TEMPLATE").create_infer_request();
+    const auto input = make_tensor(shape, 1.f);
+    request.set_input_tensor(input);
+    for (float step = 1.f; step <= 3.f; step++) {
+        request.infer();
+        const auto output = request.get_output_tensor(0);
+        for (size_t i = 0; i < output.get_size(); i++) {
+            ASSERT_EQ(output.data<float>()[i], step * input.data<float>()[i]);
+        }
+    }
+}
+
+}  // namespace
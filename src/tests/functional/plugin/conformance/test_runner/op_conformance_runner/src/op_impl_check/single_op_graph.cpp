@@ -870,6 +870,13 @@ std::shared_ptr<ov::Model> generate(const std::shared_ptr<ov::op::v8::RandomUnif
     return std::make_shared<ov::Model>(results, params, "RandomUniformGraph");
 }
 
+std::shared_ptr<ov::Model> generate(const std::shared_ptr<ov::op::v13::Sampling> &node) {
+    const auto params = ngraph::builder::makeDynamicParams(ov::element::f32, {{2, 100}});
+    auto Node = std::make_shared<ov::op::v13::Sampling>(params.at(0), 0.7f, 10, 0.9f, ov::element::i64, 10, 10);
+    ov::ResultVector results{std::make_shared<ov::op::v0::Result>(Node)};
+    return std::make_shared<ov::Model>(results, params, "SamplingGraph");
+}
+
 std::shared_ptr<ov::Model> generate(const std::shared_ptr<ov::op::v0::Range> &node) {
     const auto params = ngraph::builder::makeParams(ov::element::f32, {std::vector<size_t>(), std::vector<size_t>(), std::vector<size_t>()});
     auto Node = std::make_shared<ov::op::v0::Range>(params.at(0), params.at(1), params.at(2));
@@ -1920,6 +1927,7 @@ OpGenerator getOpGeneratorMap() {
 #include "openvino/opsets/opset10_tbl.hpp"
 #include "openvino/opsets/opset11_tbl.hpp"
 #include "openvino/opsets/opset12_tbl.hpp"
+#include "openvino/opsets/opset13_tbl.hpp"
 #undef _OPENVINO_OP_REG
     };
     return opGeneratorMap;
@@ -0,0 +1,44 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base/ov_behavior_test_utils.hpp"
+#include "openvino/core/model.hpp"
+#include "openvino/runtime/streaming_session.hpp"
+#include "openvino/runtime/tensor.hpp"
+
+namespace ov {
+namespace test {
+namespace behavior {
+
+struct OVStreamingSessionTest : public OVInferRequestTests {
+    static std::string getTestCaseName(const testing::TestParamInfo<InferRequestParams>& obj);
+
+    void SetUp() override;
+    void TearDown() override;
+
+    // Accumulates frames of [1, frameLength, channels] input in the state, the output is the sum of the frames
+    static std::shared_ptr<ov::Model> getAccumulatingFunction();
+
+    static constexpr size_t frameLength = 4;
+    static constexpr size_t channels = 3;
+
+    ov::StreamingSession session;
+    std::vector<std::vector<float>> outputs;
+    std::vector<size_t> frames;
+
+protected:
+    ov::Tensor makeChunk(size_t length, float start) const;
+};
+
+}  // namespace behavior
+}  // namespace test
+}  // namespace ov
@@ -0,0 +1,156 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "behavior/ov_infer_request/streaming_session.hpp"
+
+#include "openvino/op/add.hpp"
+#include "openvino/op/assign.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/read_value.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/op/util/variable.hpp"
+
+namespace ov {
+namespace test {
+namespace behavior {
+
+constexpr size_t OVStreamingSessionTest::frameLength;
+constexpr size_t OVStreamingSessionTest::channels;
+
+std::string OVStreamingSessionTest::getTestCaseName(const testing::TestParamInfo<InferRequestParams>& obj) {
+    return OVInferRequestTests::getTestCaseName(obj);
+}
+
+std::shared_ptr<ov::Model> OVStreamingSessionTest::getAccumulatingFunction() {
+    const ov::Shape shape{1, frameLength, channels};
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape);
+    param->get_output_tensor(0).set_names({"input"});
+    auto variable = std::make_shared<ov::op::util::Variable>(
+        ov::op::util::VariableInfo{shape, ov::element::f32, "accumulator"});
+    auto init = ov::op::v0::Constant::create(ov::element::f32, shape, {0});
+    auto read = std::make_shared<ov::op::v6::ReadValue>(init, variable);
+    auto add = std::make_shared<ov::op::v1::Add>(read, param);
+    auto assign = std::make_shared<ov::op::v6::Assign>(add, variable);
+    auto result = std::make_shared<ov::op::v0::Result>(add);
+    return std::make_shared<ov::Model>(ov::ResultVector{result},
+                                       ov::SinkVector{assign},
+                                       ov::ParameterVector{param},
+                                       "accumulator");
+}
+
+void OVStreamingSessionTest::SetUp() {
+    std::tie(target_device, configuration) = this->GetParam();
+    // Skip test according to plugin specific disabledTestPatterns() (if any)
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    APIBaseTest::SetUp();
+    function = getAccumulatingFunction();
+    execNet = core->compile_model(function, target_device, configuration);
+    OV_ASSERT_NO_THROW(session = execNet.create_streaming_session(1));
+    session.set_callback([this](ov::InferRequest& request, size_t valid) {
+        const auto output = request.get_output_tensor();
+        const auto data = output.data<const float>();
+        outputs.emplace_back(data, data + output.get_size());
+        frames.push_back(valid);
+    });
+}
+
+void OVStreamingSessionTest::TearDown() {
+    session = {};
+    OVInferRequestTests::TearDown();
+}
+
+ov::Tensor OVStreamingSessionTest::makeChunk(size_t length, float start) const {
+    ov::Tensor chunk(ov::element::f32, {1, length, channels});
+    auto data = chunk.data<float>();
+    for (size_t i = 0; i < chunk.get_size(); i++) {
+        data[i] = start + static_cast<float>(i);
+    }
+    return chunk;
+}
+
+TEST_P(OVStreamingSessionTest, chunksOfArbitraryLengthAreSplitIntoFrames) {
+    // 10 time steps: 2 complete frames and a padded one
+    OV_ASSERT_NO_THROW(session.push(makeChunk(3, 0)));
+    OV_ASSERT_NO_THROW(session.push(makeChunk(5, 9)));
+    OV_ASSERT_NO_THROW(session.push(makeChunk(2, 24)));
+    OV_ASSERT_NO_THROW(session.flush());
+
+    ASSERT_EQ(frames, (std::vector<size_t>{frameLength, frameLength, 2}));
+    std::vector<float> sum(frameLength * channels, 0.f);
+    for (size_t frame = 0; frame < outputs.size(); frame++) {
+        for (size_t i = 0; i < sum.size(); i++) {
+            const auto step = frame * frameLength * channels + i;
+            sum[i] += step < 10 * channels ? static_cast<float>(step) : 0.f;
+            EXPECT_EQ(sum[i], outputs[frame][i]) << "frame " << frame << " element " << i;
+        }
+    }
+}
+
+TEST_P(OVStreamingSessionTest, restoreSnapshot) {
+    OV_ASSERT_NO_THROW(session.push(makeChunk(frameLength, 0)));
+    ov::StreamingSession::Snapshot snapshot;
+    OV_ASSERT_NO_THROW(snapshot = session.snapshot());
+    OV_ASSERT_NO_THROW(session.push(makeChunk(frameLength, 100)));
+    OV_ASSERT_NO_THROW(session.wait());
+
+    OV_ASSERT_NO_THROW(session.restore(snapshot));
+    OV_ASSERT_NO_THROW(session.push(makeChunk(frameLength, 100)));
+    OV_ASSERT_NO_THROW(session.wait());
+
+    ASSERT_EQ(outputs.size(), 3u);
+    EXPECT_EQ(outputs[1], outputs[2]);
+
+    OV_ASSERT_NO_THROW(session.reset());
+    OV_ASSERT_NO_THROW(session.push(makeChunk(frameLength, 0)));
+    OV_ASSERT_NO_THROW(session.wait());
+    EXPECT_EQ(outputs[0], outputs[3]);
+}
+
+TEST_P(OVStreamingSessionTest, snapshotCanBeRestoredTwice) {
+    OV_ASSERT_NO_THROW(session.push(makeChunk(frameLength, 0)));
+    ov::StreamingSession::Snapshot snapshot;
+    OV_ASSERT_NO_THROW(snapshot = session.snapshot());
+
+    // two branches continued from the same point
+    OV_ASSERT_NO_THROW(session.push(makeChunk(frameLength, 100)));
+    OV_ASSERT_NO_THROW(session.restore(snapshot));
+    OV_ASSERT_NO_THROW(session.push(makeChunk(frameLength, 200)));
+    OV_ASSERT_NO_THROW(session.restore(snapshot));
+    OV_ASSERT_NO_THROW(session.push(makeChunk(frameLength, 100)));
+    OV_ASSERT_NO_THROW(session.wait());
+
+    ASSERT_EQ(outputs.size(), 4u);
+    EXPECT_EQ(outputs[1], outputs[3]);
+    for (size_t i = 0; i < outputs[2].size(); i++) {
+        EXPECT_EQ(outputs[0][i] + 200.f + static_cast<float>(i), outputs[2][i]) << "element " << i;
+    }
+}
+
+TEST_P(OVStreamingSessionTest, flushDoesNotChangeStates) {
+    OV_ASSERT_NO_THROW(session.push(makeChunk(frameLength, 0)));
+    OV_ASSERT_NO_THROW(session.push(makeChunk(2, 100)));
+    OV_ASSERT_NO_THROW(session.flush());
+    // the rest of the frame completes the flushed one, the padding of the flush isn't accumulated in the state
+    OV_ASSERT_NO_THROW(session.push(makeChunk(frameLength - 2, 100 + 2 * channels)));
+    OV_ASSERT_NO_THROW(session.wait());
+
+    ASSERT_EQ(frames, (std::vector<size_t>{frameLength, 2, frameLength}));
+    for (size_t i = 0; i < outputs[2].size(); i++) {
+        const auto padded = i < 2 * channels ? 100.f + static_cast<float>(i) : 0.f;
+        EXPECT_EQ(outputs[0][i] + padded, outputs[1][i]) << "element " << i;
+        EXPECT_EQ(outputs[0][i] + 100.f + static_cast<float>(i), outputs[2][i]) << "element " << i;
+    }
+}
+
+TEST_P(OVStreamingSessionTest, chunkOfWrongShapeThrows) {
+    ov::Tensor chunk(ov::element::f32, {1, 2, channels + 1});
+    ASSERT_THROW(session.push(chunk), ov::Exception);
+    ov::Tensor wrongType(ov::element::i32, {1, 2, channels});
+    ASSERT_THROW(session.push(wrongType), ov::Exception);
+}
+
+}  // namespace behavior
+}  // namespace test
+}  // namespace ov
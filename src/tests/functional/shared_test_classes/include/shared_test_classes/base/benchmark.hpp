@@ -18,6 +18,7 @@ class BenchmarkLayerTestReporter {
 public:
     static constexpr const char* const benchmarkReportFileName = "benchmark_layers.xml";
     static constexpr const char* const timeAttributeName = "time";
+    static constexpr const char* const execTypeAttributeName = "exec_type";
 
     explicit BenchmarkLayerTestReporter(bool is_readonly) : is_readonly_{is_readonly} {
         report_xml_.load_file(benchmarkReportFileName);
@@ -48,6 +49,21 @@ public:
         timeAttribute.set_value(static_cast<unsigned long long>(time));
     }
 
+    void report(const std::string& nodeTypeName,
+                const std::string& testCaseName,
+                const uint64_t time,
+                const std::string& execType) {
+        report(nodeTypeName, testCaseName, time);
+
+        pugi::xml_node testCaseNode = report_xml_.child(nodeTypeName.c_str()).child(testCaseName.c_str());
+        pugi::xml_attribute execTypeAttribute = testCaseNode.attribute(execTypeAttributeName);
+        if (!execTypeAttribute) {
+            execTypeAttribute = testCaseNode.append_attribute(execTypeAttributeName);
+        }
+
+        execTypeAttribute.set_value(execType.c_str());
+    }
+
     uint64_t get_time(const std::string& nodeTypeName, const std::string& testCaseName) {
         pugi::xml_attribute timeAttribute =
             report_xml_.child(nodeTypeName.c_str()).child(testCaseName.c_str()).attribute(timeAttributeName);
@@ -278,6 +294,7 @@ class BenchmarkLayerTest : public BaseLayerTest {
         }
 
         // Benchmark
+        std::map<std::string, std::string> exec_types{};
         for (int i = 0; i < num_attempts_; ++i) {
             this->inferRequest.infer();
             const auto& profiling_info = this->inferRequest.get_profiling_info();
@@ -292,6 +309,7 @@ class BenchmarkLayerTest : public BaseLayerTest {
                     IE_THROW() << "Cannot find operator by node type: " << node_type_name;
                 }
                 time += found_profile->real_time.count();
+                exec_types[node_type_name] = found_profile->exec_type;
             }
         }
 
@@ -302,10 +320,11 @@ class BenchmarkLayerTest : public BaseLayerTest {
             uint64_t time = res.second;
             time /= num_attempts_;
             total_us += time;
-            report << std::fixed << std::setfill('0') << node_type_name << ": " << time << " us\n";
+            report << std::fixed << std::setfill('0') << node_type_name << " (" << exec_types[node_type_name]
+                   << "): " << time << " us\n";
 #ifdef ENABLE_BENCHMARK_FILE_REPORT
             curr_bench_results_[node_type_name] = time;
-            reporter_->report(node_type_name, BaseLayerTest::GetTestName(), time);
+            reporter_->report(node_type_name, BaseLayerTest::GetTestName(), time, exec_types[node_type_name]);
 #endif
         }
         report << std::fixed << std::setfill('0') << "Total time: " << total_us << " us\n";